@@ -0,0 +1,244 @@
+/**
+ * @file ascii.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Locale-free ASCII character classification and case folding for the SWE library.
+ *
+ * This header provides constexpr 256-entry tables and the functions built on them. Unlike the
+ * <cctype> functions they never consult the C locale, never have undefined behavior for negative
+ * char values, and can be evaluated at compile time. Bytes outside the ASCII range are never
+ * letters, digits or whitespace and are left unchanged by case conversion, so the functions are
+ * safe to use on UTF-8 text.
+ *
+ * The same tables back string_compare_type::ordinal_ignore_case_ascii, which compares eight bytes
+ * at a time with a SWAR (SIMD within a register) fold.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "string_view.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace swe
+{
+    /**
+     * @brief Character classes stored in the ASCII classification table.
+     */
+    enum ascii_class : unsigned char
+    {
+        ascii_upper = 1,      ///< 'A' to 'Z'.
+        ascii_lower = 2,      ///< 'a' to 'z'.
+        ascii_digit = 4,      ///< '0' to '9'.
+        ascii_space = 8,      ///< ' ', '\t', '\n', '\v', '\f' and '\r'.
+        ascii_punct = 16,     ///< Printable characters that are not letters, digits or space.
+        ascii_xdigit = 32,    ///< '0' to '9', 'A' to 'F' and 'a' to 'f'.
+        ascii_cntrl = 64,     ///< 0x00 to 0x1F and 0x7F.
+        ascii_alpha = ascii_upper | ascii_lower,
+        ascii_alnum = ascii_alpha | ascii_digit,
+    };
+
+    namespace detail
+    {
+        template <std::size_t... I>
+        struct index_sequence
+        {
+            using type = index_sequence;
+        };
+
+        template <std::size_t N, std::size_t... I>
+        struct make_index_sequence : make_index_sequence<N - 1, N - 1, I...>
+        {
+        };
+
+        template <std::size_t... I>
+        struct make_index_sequence<0, I...> : index_sequence<I...>
+        {
+        };
+
+        constexpr unsigned char ascii_lower_value(std::size_t c) noexcept
+        {
+            return static_cast<unsigned char>(c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c);
+        }
+
+        constexpr unsigned char ascii_upper_value(std::size_t c) noexcept
+        {
+            return static_cast<unsigned char>(c >= 'a' && c <= 'z' ? c - ('a' - 'A') : c);
+        }
+
+        constexpr unsigned char ascii_class_value(std::size_t c) noexcept
+        {
+            return static_cast<unsigned char>((c >= 'A' && c <= 'Z' ? ascii_upper : 0) | (c >= 'a' && c <= 'z' ? ascii_lower : 0) |
+                                              (c >= '0' && c <= '9' ? ascii_digit : 0) | (c == ' ' || (c >= '\t' && c <= '\r') ? ascii_space : 0) |
+                                              ((c >= '!' && c <= '/') || (c >= ':' && c <= '@') || (c >= '[' && c <= '`') || (c >= '{' && c <= '~') ? ascii_punct : 0) |
+                                              ((c >= '0' && c <= '9') || (c >= 'A' && c <= 'F') || (c >= 'a' && c <= 'f') ? ascii_xdigit : 0) |
+                                              (c < 0x20 || c == 0x7F ? ascii_cntrl : 0));
+        }
+
+        template <typename Sequence>
+        struct ascii_table_data;
+
+        template <std::size_t... I>
+        struct ascii_table_data<index_sequence<I...>>
+        {
+            static constexpr unsigned char lower[sizeof...(I)] = {ascii_lower_value(I)...};
+            static constexpr unsigned char upper[sizeof...(I)] = {ascii_upper_value(I)...};
+            static constexpr unsigned char classes[sizeof...(I)] = {ascii_class_value(I)...};
+        };
+
+        template <std::size_t... I>
+        constexpr unsigned char ascii_table_data<index_sequence<I...>>::lower[sizeof...(I)];
+
+        template <std::size_t... I>
+        constexpr unsigned char ascii_table_data<index_sequence<I...>>::upper[sizeof...(I)];
+
+        template <std::size_t... I>
+        constexpr unsigned char ascii_table_data<index_sequence<I...>>::classes[sizeof...(I)];
+
+        /**
+         * @brief The 256-entry lower-case, upper-case and class tables, indexed by unsigned byte value.
+         */
+        using ascii_tables = ascii_table_data<make_index_sequence<256>::type>;
+
+        /**
+         * @brief Folds every ASCII upper-case byte of an 8-byte word to lower case, leaving other bytes unchanged.
+         */
+        inline std::uint64_t ascii_fold_word(std::uint64_t word) noexcept
+        {
+            const std::uint64_t high_bits = 0x8080808080808080ull;
+            const std::uint64_t low_bits = word & ~high_bits;
+            // Adding to the low seven bits sets each byte's high bit when the byte is >= 'A' or > 'Z'
+            const std::uint64_t at_least_a = low_bits + 0x3F3F3F3F3F3F3F3Full;
+            const std::uint64_t above_z = low_bits + 0x2525252525252525ull;
+            const std::uint64_t upper = (at_least_a ^ above_z) & ~word & high_bits;
+            return word | (upper >> 2);
+        }
+
+        /**
+         * @brief Compares count bytes case-insensitively for ASCII letters, eight bytes at a time.
+         */
+        inline bool ascii_equal_ignore_case(const char* lhs, const char* rhs, std::size_t count) noexcept
+        {
+            for (; count >= 8; count -= 8, lhs += 8, rhs += 8)
+            {
+                std::uint64_t a, b;
+                std::memcpy(&a, lhs, 8);
+                std::memcpy(&b, rhs, 8);
+                if (a != b && ascii_fold_word(a) != ascii_fold_word(b))
+                    return false;
+            }
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if (ascii_tables::lower[static_cast<unsigned char>(lhs[i])] != ascii_tables::lower[static_cast<unsigned char>(rhs[i])])
+                    return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Compares count wide (wchar_t, char16_t, char32_t or char8_t) characters case-insensitively for ASCII letters only.
+         */
+        template <typename CharT>
+        bool ascii_equal_ignore_case(const CharT* lhs, const CharT* rhs, std::size_t count) noexcept
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const CharT a = lhs[i], b = rhs[i];
+                if (a != b && (static_cast<unsigned long>(a) > 0x7F || static_cast<unsigned long>(b) > 0x7F ||
+                               ascii_tables::lower[static_cast<unsigned char>(a)] != ascii_tables::lower[static_cast<unsigned char>(b)]))
+                    return false;
+            }
+            return true;
+        }
+    } // namespace detail
+
+    /**
+     * @brief Checks whether a character belongs to any of the given ASCII classes.
+     * @param c Character to classify.
+     * @param classes Bitwise OR of ascii_class values.
+     */
+    constexpr bool ascii_is(char c, unsigned char classes) noexcept
+    {
+        return (detail::ascii_tables::classes[static_cast<unsigned char>(c)] & classes) != 0;
+    }
+
+    /**
+     * @brief Checks whether a character is an ASCII letter.
+     */
+    constexpr bool ascii_is_alpha(char c) noexcept
+    {
+        return ascii_is(c, ascii_alpha);
+    }
+
+    /**
+     * @brief Checks whether a character is an ASCII decimal digit.
+     */
+    constexpr bool ascii_is_digit(char c) noexcept
+    {
+        return ascii_is(c, ascii_digit);
+    }
+
+    /**
+     * @brief Checks whether a character is an ASCII letter or decimal digit.
+     */
+    constexpr bool ascii_is_alnum(char c) noexcept
+    {
+        return ascii_is(c, ascii_alnum);
+    }
+
+    /**
+     * @brief Checks whether a character is ASCII whitespace (space, \\t, \\n, \\v, \\f or \\r).
+     */
+    constexpr bool ascii_is_space(char c) noexcept
+    {
+        return ascii_is(c, ascii_space);
+    }
+
+    /**
+     * @brief Checks whether a character is an ASCII upper-case letter.
+     */
+    constexpr bool ascii_is_upper(char c) noexcept
+    {
+        return ascii_is(c, ascii_upper);
+    }
+
+    /**
+     * @brief Checks whether a character is an ASCII lower-case letter.
+     */
+    constexpr bool ascii_is_lower(char c) noexcept
+    {
+        return ascii_is(c, ascii_lower);
+    }
+
+    /**
+     * @brief Converts an ASCII upper-case letter to lower case; any other character is returned unchanged.
+     */
+    constexpr char ascii_to_lower(char c) noexcept
+    {
+        return static_cast<char>(detail::ascii_tables::lower[static_cast<unsigned char>(c)]);
+    }
+
+    /**
+     * @brief Converts an ASCII lower-case letter to upper case; any other character is returned unchanged.
+     */
+    constexpr char ascii_to_upper(char c) noexcept
+    {
+        return static_cast<char>(detail::ascii_tables::upper[static_cast<unsigned char>(c)]);
+    }
+
+    /**
+     * @brief Compares two strings for equality, ignoring the case of ASCII letters only.
+     * @param lhs First string.
+     * @param rhs Second string.
+     * @return True if the strings are equal after folding ASCII letters to lower case.
+     */
+    inline bool ascii_equals_ignore_case(string_view lhs, string_view rhs) noexcept
+    {
+        return lhs.size() == rhs.size() && detail::ascii_equal_ignore_case(lhs.data(), rhs.data(), lhs.size());
+    }
+
+} // namespace swe
\ No newline at end of file
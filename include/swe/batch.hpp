@@ -0,0 +1,514 @@
+/**
+ * @file batch.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Batch string transforms over containers, optionally spread across threads.
+ *
+ * This header provides batch forms of the case, trim and slug conversions. The *_batch functions
+ * transform every string of a container in place, which reuses each string's storage. The *_packed
+ * functions write the transformed strings back to back into one swe::basic_packed_strings buffer,
+ * so the results need one growing allocation instead of one per string. With batch_execution::parallel
+ * the container is cut into cache-line-aligned chunks that worker threads claim until the batch is done.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "string.hpp"
+#include "string_view.hpp"
+#include "detail/parallel.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace swe
+{
+    /**
+     * @brief How a batch transform runs.
+     */
+    enum class batch_execution
+    {
+        sequential, ///< Run on the calling thread.
+        parallel,   ///< Split the batch across std::thread::hardware_concurrency() threads; needs random access iterators.
+    };
+
+    /**
+     * @brief Sequence of strings stored back to back in a single buffer.
+     *
+     * Element i spans offsets()[i] to offsets()[i + 1] of buffer(). Elements are returned as views into
+     * the buffer, which stay valid until the object is modified or destroyed.
+     *
+     * @tparam CharT Character type.
+     * @tparam Traits Character traits type.
+     */
+    template <typename CharT, typename Traits = std::char_traits<CharT>>
+    class basic_packed_strings
+    {
+      public:
+        using view_type = basic_string_view<CharT, Traits>;
+        using string_type = std::basic_string<CharT, Traits>;
+        using size_type = std::size_t;
+
+        /**
+         * @brief Creates an empty sequence.
+         */
+        basic_packed_strings() : _offsets(1, 0)
+        {
+        }
+
+        /**
+         * @brief Number of strings in the sequence.
+         */
+        size_type size() const noexcept
+        {
+            return _offsets.size() - 1;
+        }
+
+        /**
+         * @brief Whether the sequence holds no strings.
+         */
+        bool empty() const noexcept
+        {
+            return _offsets.size() == 1;
+        }
+
+        /**
+         * @brief View of the string at index. No bounds checking is performed.
+         */
+        view_type operator[](size_type index) const noexcept
+        {
+            return view_type(_buffer.data() + _offsets[index], _offsets[index + 1] - _offsets[index]);
+        }
+
+        /**
+         * @brief All strings, concatenated without separators.
+         */
+        view_type buffer() const noexcept
+        {
+            return view_type(_buffer.data(), _buffer.size());
+        }
+
+        /**
+         * @brief Start offset of every string in buffer(), followed by the total length.
+         */
+        const std::vector<size_type>& offsets() const noexcept
+        {
+            return _offsets;
+        }
+
+        /**
+         * @brief Reserves room for count strings with chars characters in total.
+         */
+        void reserve(size_type count, size_type chars)
+        {
+            _offsets.reserve(count + 1);
+            _buffer.reserve(chars);
+        }
+
+        /**
+         * @brief Appends a string to the sequence.
+         */
+        void push_back(view_type str)
+        {
+            _buffer.append(str.data(), str.size());
+            _offsets.push_back(_buffer.size());
+        }
+
+        /**
+         * @brief Appends every string of another sequence.
+         */
+        void append(const basic_packed_strings& other)
+        {
+            const size_type base = _buffer.size();
+            _buffer.append(other._buffer);
+            _offsets.reserve(_offsets.size() + other.size());
+            for (size_type i = 1; i < other._offsets.size(); ++i)
+                _offsets.push_back(base + other._offsets[i]);
+        }
+
+        /**
+         * @brief Removes every string.
+         */
+        void clear() noexcept
+        {
+            _buffer.clear();
+            _offsets.resize(1);
+        }
+
+      private:
+        string_type _buffer;
+        std::vector<size_type> _offsets;
+    };
+
+    /**
+     * @brief Packed narrow strings.
+     */
+    using packed_strings = basic_packed_strings<char>;
+
+    /**
+     * @brief Packed wide strings.
+     */
+    using wpacked_strings = basic_packed_strings<wchar_t>;
+
+    namespace detail
+    {
+        /**
+         * @brief Element type of a range.
+         */
+        template <typename Range>
+        using range_value_t = typename std::decay<decltype(*std::begin(std::declval<Range&>()))>::type;
+
+        /**
+         * @brief Packed sequence type for the strings of a range.
+         */
+        template <typename Range>
+        using packed_range_t = basic_packed_strings<typename range_value_t<const Range>::value_type, typename range_value_t<const Range>::traits_type>;
+
+        /**
+         * @brief Character type of the strings an iterator refers to.
+         */
+        template <typename It>
+        using iterator_char_t = typename std::iterator_traits<It>::value_type::value_type;
+
+        /**
+         * @brief Character traits of the strings an iterator refers to.
+         */
+        template <typename It>
+        using iterator_traits_t = typename std::iterator_traits<It>::value_type::traits_type;
+
+        template <typename It, typename Fn>
+        void transform_batch(It first, It last, Fn& fn, std::false_type)
+        {
+            for (; first != last; ++first)
+                fn(*first);
+        }
+
+        template <typename It, typename Fn>
+        void transform_batch(It first, It last, Fn& fn, std::true_type)
+        {
+            using value_type = typename std::iterator_traits<It>::value_type;
+            const std::size_t count = static_cast<std::size_t>(last - first);
+            const unsigned threads = parallel_thread_count();
+            parallel_for_chunks(count, parallel_chunk_size<sizeof(value_type)>(count, threads), threads,
+                                [&](std::size_t, std::size_t begin, std::size_t end) {
+                                    for (It it = first + static_cast<std::ptrdiff_t>(begin), stop = first + static_cast<std::ptrdiff_t>(end); it != stop; ++it)
+                                        fn(*it);
+                                });
+        }
+
+        /**
+         * @brief Transforms [first, last) into packed, reusing one scratch string for every element.
+         */
+        template <typename It, typename Fn, typename CharT, typename Traits>
+        void transform_packed_into(It first, It last, Fn& fn, basic_packed_strings<CharT, Traits>& packed)
+        {
+            std::basic_string<CharT, Traits> scratch;
+            for (; first != last; ++first)
+            {
+                const basic_string_view<CharT, Traits> source(*first);
+                scratch.assign(source.data(), source.size());
+                fn(scratch);
+                packed.push_back(basic_string_view<CharT, Traits>(scratch.data(), scratch.size()));
+            }
+        }
+
+        template <typename It, typename Fn, typename CharT, typename Traits>
+        void transform_packed(It first, It last, Fn& fn, basic_packed_strings<CharT, Traits>& packed, std::false_type)
+        {
+            transform_packed_into(first, last, fn, packed);
+        }
+
+        template <typename It, typename Fn, typename CharT, typename Traits>
+        void transform_packed(It first, It last, Fn& fn, basic_packed_strings<CharT, Traits>& packed, std::true_type)
+        {
+            using value_type = typename std::iterator_traits<It>::value_type;
+            const std::size_t count = static_cast<std::size_t>(last - first);
+            const unsigned threads = parallel_thread_count();
+            const std::size_t chunk = parallel_chunk_size<sizeof(value_type)>(count, threads);
+            std::vector<basic_packed_strings<CharT, Traits>> parts((count + chunk - 1) / chunk);
+            parallel_for_chunks(count, chunk, threads, [&](std::size_t index, std::size_t begin, std::size_t end) {
+                transform_packed_into(first + static_cast<std::ptrdiff_t>(begin), first + static_cast<std::ptrdiff_t>(end), fn, parts[index]);
+            });
+
+            std::size_t chars = 0;
+            for (const auto& part : parts)
+                chars += part.buffer().size();
+            packed.reserve(count, chars);
+            for (const auto& part : parts)
+                packed.append(part);
+        }
+
+        /**
+         * @brief Whether a batch over It runs in parallel: it was requested and It is random access.
+         */
+        template <typename It>
+        using is_parallel_iterator = std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<It>::iterator_category>;
+
+        struct to_lower_op
+        {
+            template <typename String>
+            void operator()(String& str) const
+            {
+                basic_str_to_lower_inplace(str);
+            }
+        };
+
+        struct to_upper_op
+        {
+            template <typename String>
+            void operator()(String& str) const
+            {
+                basic_str_to_upper_inplace(str);
+            }
+        };
+
+        struct to_title_op
+        {
+            template <typename String>
+            void operator()(String& str) const
+            {
+                basic_str_to_title_inplace(str);
+            }
+        };
+
+        template <typename CharT, typename Traits>
+        struct trim_op
+        {
+            // Compiled once per batch rather than once per string
+            char_set_view<CharT, Traits> whitespace;
+
+            template <typename String>
+            void operator()(String& str) const
+            {
+                trim_inplace(str, whitespace, true, true);
+            }
+        };
+
+        template <typename CharT>
+        struct to_slug_op
+        {
+            CharT separator;
+
+            template <typename String>
+            void operator()(String& str) const
+            {
+                basic_str_to_slug_inplace(str, separator);
+            }
+        };
+    } // namespace detail
+
+    /**
+     * @brief Applies an in-place transform to every string of [first, last).
+     *
+     * With batch_execution::parallel and random access iterators, fn is called concurrently for different
+     * elements, so it must be safe to call from several threads. Other iterators always run sequentially.
+     * If fn throws, the first exception is rethrown after the other threads have stopped, and some elements
+     * may be left untransformed.
+     *
+     * @param first Iterator to the first string.
+     * @param last Iterator past the last string.
+     * @param fn Callable invoked as fn(element) for every element.
+     * @param execution Whether to run on the calling thread or in parallel.
+     */
+    template <typename It, typename Fn>
+    void str_transform_batch(It first, It last, Fn fn, batch_execution execution = batch_execution::sequential)
+    {
+        if (execution == batch_execution::parallel)
+            detail::transform_batch(first, last, fn, detail::is_parallel_iterator<It>());
+        else
+            detail::transform_batch(first, last, fn, std::false_type());
+    }
+
+    /**
+     * @brief Copies every string of [first, last) into a packed sequence and transforms the copy.
+     *
+     * Each element is copied into a scratch string that is reused for the whole batch, passed to fn, and
+     * appended to the result, so the input is left unchanged and no allocation is made per element. In
+     * parallel, every chunk is packed separately and the chunks are concatenated in order.
+     *
+     * @param first Iterator to the first string. Elements must be std::basic_string or basic_string_view.
+     * @param last Iterator past the last string.
+     * @param fn Callable invoked as fn(scratch) with a std::basic_string holding a copy of each element.
+     * @param execution Whether to run on the calling thread or in parallel.
+     * @return The transformed strings, in input order.
+     */
+    template <typename It, typename Fn>
+    basic_packed_strings<detail::iterator_char_t<It>, detail::iterator_traits_t<It>> str_transform_packed(It first, It last, Fn fn,
+                                                                                                        batch_execution execution = batch_execution::sequential)
+    {
+        basic_packed_strings<detail::iterator_char_t<It>, detail::iterator_traits_t<It>> packed;
+        if (execution == batch_execution::parallel)
+            detail::transform_packed(first, last, fn, packed, detail::is_parallel_iterator<It>());
+        else
+            detail::transform_packed(first, last, fn, packed, std::false_type());
+        return packed;
+    }
+
+    /**
+     * @brief Converts every string of a container to lowercase in place, as basic_str_to_lower_inplace does.
+     * @param strings Container of std::basic_string.
+     * @param execution Whether to run on the calling thread or in parallel.
+     */
+    template <typename Range>
+    void str_to_lower_batch(Range& strings, batch_execution execution = batch_execution::sequential)
+    {
+        str_transform_batch(std::begin(strings), std::end(strings), detail::to_lower_op(), execution);
+    }
+
+    /**
+     * @brief Converts every string of a container to uppercase in place, as basic_str_to_upper_inplace does.
+     * @param strings Container of std::basic_string.
+     * @param execution Whether to run on the calling thread or in parallel.
+     */
+    template <typename Range>
+    void str_to_upper_batch(Range& strings, batch_execution execution = batch_execution::sequential)
+    {
+        str_transform_batch(std::begin(strings), std::end(strings), detail::to_upper_op(), execution);
+    }
+
+    /**
+     * @brief Converts every string of a container to title case in place, as basic_str_to_title_inplace does.
+     * @param strings Container of std::basic_string.
+     * @param execution Whether to run on the calling thread or in parallel.
+     */
+    template <typename Range>
+    void str_to_title_batch(Range& strings, batch_execution execution = batch_execution::sequential)
+    {
+        str_transform_batch(std::begin(strings), std::end(strings), detail::to_title_op(), execution);
+    }
+
+    /**
+     * @brief Trims whitespace from both ends of every string of a container in place.
+     * @param strings Container of std::basic_string.
+     * @param whitespace Characters to trim. Must outlive the call.
+     * @param execution Whether to run on the calling thread or in parallel.
+     */
+    template <typename Range>
+    void str_trim_batch(Range& strings,
+                        detail::type_identity_t<basic_string_view<typename detail::range_value_t<Range>::value_type, typename detail::range_value_t<Range>::traits_type>>
+                            whitespace,
+                        batch_execution execution = batch_execution::sequential)
+    {
+        using value_type = detail::range_value_t<Range>;
+        str_transform_batch(std::begin(strings), std::end(strings), detail::trim_op<typename value_type::value_type, typename value_type::traits_type>{
+                                detail::char_set_view<typename value_type::value_type, typename value_type::traits_type>(whitespace)},
+                            execution);
+    }
+
+    /**
+     * @brief Trims the default whitespace (space, tab, newline, etc.) from both ends of every string of a container in place.
+     * @param strings Container of std::basic_string.
+     * @param execution Whether to run on the calling thread or in parallel.
+     */
+    template <typename Range>
+    void str_trim_batch(Range& strings, batch_execution execution = batch_execution::sequential)
+    {
+        using value_type = detail::range_value_t<Range>;
+        str_trim_batch(strings, detail::default_whitespace<typename value_type::value_type, typename value_type::traits_type>(), execution);
+    }
+
+    /**
+     * @brief Converts every string of a container to a slug in place, as basic_str_to_slug_inplace does.
+     * @param strings Container of std::basic_string.
+     * @param separator Character to use as separator.
+     * @param execution Whether to run on the calling thread or in parallel.
+     */
+    template <typename Range>
+    void str_to_slug_batch(Range& strings, detail::type_identity_t<typename detail::range_value_t<Range>::value_type> separator,
+                           batch_execution execution = batch_execution::sequential)
+    {
+        using char_type = typename detail::range_value_t<Range>::value_type;
+        str_transform_batch(std::begin(strings), std::end(strings), detail::to_slug_op<char_type>{separator}, execution);
+    }
+
+    /**
+     * @brief Converts every string of a container to a slug with '_' separators in place.
+     * @param strings Container of std::basic_string.
+     * @param execution Whether to run on the calling thread or in parallel.
+     */
+    template <typename Range>
+    void str_to_slug_batch(Range& strings, batch_execution execution = batch_execution::sequential)
+    {
+        using char_type = typename detail::range_value_t<Range>::value_type;
+        str_to_slug_batch(strings, char_type('_'), execution);
+    }
+
+    /**
+     * @brief Lowercase copies of every string of a container, packed into one buffer.
+     * @param strings Container of std::basic_string or basic_string_view.
+     * @param execution Whether to run on the calling thread or in parallel.
+     */
+    template <typename Range>
+    detail::packed_range_t<Range> str_to_lower_packed(const Range& strings, batch_execution execution = batch_execution::sequential)
+    {
+        return str_transform_packed(std::begin(strings), std::end(strings), detail::to_lower_op(), execution);
+    }
+
+    /**
+     * @brief Uppercase copies of every string of a container, packed into one buffer.
+     * @param strings Container of std::basic_string or basic_string_view.
+     * @param execution Whether to run on the calling thread or in parallel.
+     */
+    template <typename Range>
+    detail::packed_range_t<Range> str_to_upper_packed(const Range& strings, batch_execution execution = batch_execution::sequential)
+    {
+        return str_transform_packed(std::begin(strings), std::end(strings), detail::to_upper_op(), execution);
+    }
+
+    /**
+     * @brief Title case copies of every string of a container, packed into one buffer.
+     * @param strings Container of std::basic_string or basic_string_view.
+     * @param execution Whether to run on the calling thread or in parallel.
+     */
+    template <typename Range>
+    detail::packed_range_t<Range> str_to_title_packed(const Range& strings, batch_execution execution = batch_execution::sequential)
+    {
+        return str_transform_packed(std::begin(strings), std::end(strings), detail::to_title_op(), execution);
+    }
+
+    /**
+     * @brief Trimmed copies of every string of a container, packed into one buffer.
+     * @param strings Container of std::basic_string or basic_string_view.
+     * @param execution Whether to run on the calling thread or in parallel.
+     */
+    template <typename Range>
+    detail::packed_range_t<Range> str_trim_packed(const Range& strings, batch_execution execution = batch_execution::sequential)
+    {
+        using value_type = detail::range_value_t<const Range>;
+        using char_type = typename value_type::value_type;
+        using traits_type = typename value_type::traits_type;
+        return str_transform_packed(std::begin(strings), std::end(strings),
+                                    detail::trim_op<char_type, traits_type>{basic_char_set<char_type, traits_type>::whitespace().view()}, execution);
+    }
+
+    /**
+     * @brief Slug copies of every string of a container, packed into one buffer.
+     * @param strings Container of std::basic_string or basic_string_view.
+     * @param separator Character to use as separator.
+     * @param execution Whether to run on the calling thread or in parallel.
+     */
+    template <typename Range>
+    detail::packed_range_t<Range> str_to_slug_packed(const Range& strings, detail::type_identity_t<typename detail::range_value_t<const Range>::value_type> separator,
+                            batch_execution execution = batch_execution::sequential)
+    {
+        using char_type = typename detail::range_value_t<const Range>::value_type;
+        return str_transform_packed(std::begin(strings), std::end(strings), detail::to_slug_op<char_type>{separator}, execution);
+    }
+
+    /**
+     * @brief Slug copies with '_' separators of every string of a container, packed into one buffer.
+     * @param strings Container of std::basic_string or basic_string_view.
+     * @param execution Whether to run on the calling thread or in parallel.
+     */
+    template <typename Range>
+    detail::packed_range_t<Range> str_to_slug_packed(const Range& strings, batch_execution execution = batch_execution::sequential)
+    {
+        using char_type = typename detail::range_value_t<const Range>::value_type;
+        return str_to_slug_packed(strings, char_type('_'), execution);
+    }
+} // namespace swe
\ No newline at end of file
@@ -0,0 +1,357 @@
+/**
+ * @file char_set.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Precompiled character sets for trimming and find-any searches in the SWE library.
+ *
+ * This header provides swe::basic_char_set, which compiles a set of characters once into a 256-bit
+ * bitmap and the nibble tables used by the SIMD byte-set kernels. Narrow strings are then scanned
+ * forwards or backwards 16 to 64 bytes per step instead of testing every character against every
+ * member of the set, which is what find_first_not_of and find_last_not_of do. Where wchar_t is 32
+ * bits, wide strings are narrowed to bytes in registers and classified by the same tables. Characters
+ * above 0xFF, which only occur in wide sets, are kept in a short list and looked up one by one.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "string_view.hpp"
+#include "detail/byte_set.hpp"
+#include "detail/wide_kernels.hpp"
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+namespace swe
+{
+    namespace detail
+    {
+        /**
+         * @brief Default whitespace set used when trimming.
+         */
+        template <typename CharT, typename Traits>
+        basic_string_view<CharT, Traits> default_whitespace() noexcept
+        {
+            static const CharT whitespace[] = {CharT(' '), CharT('\t'), CharT('\n'), CharT('\r'), CharT('\f'), CharT('\v')};
+            return basic_string_view<CharT, Traits>(whitespace, sizeof(whitespace) / sizeof(whitespace[0]));
+        }
+
+        /**
+         * @brief Non-owning character set searched by trimming and by basic_split_any_view.
+         *
+         * Characters that fit in a byte live in a byte_set, so narrow strings are scanned with the SIMD
+         * byte-set kernels. Wider characters are looked up in the (non-owning) list of wide characters.
+         */
+        template <typename CharT, typename Traits>
+        class char_set_view
+        {
+          public:
+            using view_type = basic_string_view<CharT, Traits>;
+
+            char_set_view() noexcept : _bytes(make_byte_set()), _wide()
+            {
+            }
+
+            explicit char_set_view(view_type chars) noexcept : _bytes(make_byte_set()), _wide(chars)
+            {
+                for (CharT c : chars)
+                {
+                    if (is_byte(c))
+                        byte_set_insert(_bytes, static_cast<unsigned char>(c));
+                }
+            }
+
+            /**
+             * @brief Builds a view over an already compiled set; wide must hold its characters above 0xFF.
+             */
+            char_set_view(const byte_set& bytes, view_type wide) noexcept : _bytes(bytes), _wide(wide)
+            {
+            }
+
+            static bool is_byte(CharT c) noexcept
+            {
+                return static_cast<typename std::make_unsigned<CharT>::type>(c) <= 0xFF;
+            }
+
+            bool contains(CharT c) const noexcept
+            {
+                return is_byte(c) ? _bytes.contains(static_cast<unsigned char>(c)) : _wide.find(c) != view_type::npos;
+            }
+
+            /**
+             * @brief Returns the first position in [first, last) whose membership equals member, or last.
+             */
+            const CharT* find(const CharT* first, const CharT* last, bool member) const noexcept
+            {
+                return find(first, last, member, std::integral_constant<bool, sizeof(CharT) == 1>());
+            }
+
+            /**
+             * @brief Returns one past the last position in [first, last) whose membership equals member, or first.
+             */
+            const CharT* rfind(const CharT* first, const CharT* last, bool member) const noexcept
+            {
+                return rfind(first, last, member, std::integral_constant<bool, sizeof(CharT) == 1>());
+            }
+
+          private:
+            const CharT* find(const CharT* first, const CharT* last, bool member, std::true_type) const noexcept
+            {
+                const std::size_t count = static_cast<std::size_t>(last - first);
+                return first + byte_set_dispatch()(reinterpret_cast<const char*>(first), count, _bytes, member);
+            }
+
+            const CharT* find(const CharT* first, const CharT* last, bool member, std::false_type) const noexcept
+            {
+                return find_units(first, last, member);
+            }
+
+            const wchar_t* find_units(const wchar_t* first, const wchar_t* last, bool member) const noexcept
+            {
+                while (first != last)
+                {
+                    first += wide_set_dispatch()(first, static_cast<std::size_t>(last - first), _bytes, member);
+                    if (first == last || is_byte(*first))
+                        return first;
+                    // The kernel stops at every character above 0xFF; look up the whole run of them here
+                    for (; first != last && !is_byte(*first); ++first)
+                    {
+                        if (contains(*first) == member)
+                            return first;
+                    }
+                }
+                return last;
+            }
+
+            template <typename UnitT>
+            const UnitT* find_units(const UnitT* first, const UnitT* last, bool member) const noexcept
+            {
+                for (; first != last; ++first)
+                {
+                    if (contains(*first) == member)
+                        return first;
+                }
+                return last;
+            }
+
+            const CharT* rfind(const CharT* first, const CharT* last, bool member, std::true_type) const noexcept
+            {
+                const std::size_t count = static_cast<std::size_t>(last - first);
+                return first + byte_set_reverse_dispatch()(reinterpret_cast<const char*>(first), count, _bytes, member);
+            }
+
+            const CharT* rfind(const CharT* first, const CharT* last, bool member, std::false_type) const noexcept
+            {
+                return rfind_units(first, last, member);
+            }
+
+            const wchar_t* rfind_units(const wchar_t* first, const wchar_t* last, bool member) const noexcept
+            {
+                while (last != first)
+                {
+                    last = first + wide_set_reverse_dispatch()(first, static_cast<std::size_t>(last - first), _bytes, member);
+                    if (last == first || is_byte(last[-1]))
+                        return last;
+                    for (; last != first && !is_byte(last[-1]); --last)
+                    {
+                        if (contains(last[-1]) == member)
+                            return last;
+                    }
+                }
+                return first;
+            }
+
+            template <typename UnitT>
+            const UnitT* rfind_units(const UnitT* first, const UnitT* last, bool member) const noexcept
+            {
+                for (; last != first; --last)
+                {
+                    if (contains(last[-1]) == member)
+                        return last;
+                }
+                return first;
+            }
+
+            byte_set _bytes;
+            view_type _wide;
+        };
+
+        /**
+         * @brief Trims the members of set from the ends of str selected by left and right.
+         */
+        template <typename CharT, typename Traits>
+        basic_string_view<CharT, Traits> trim_view(basic_string_view<CharT, Traits> str, const char_set_view<CharT, Traits>& set, bool left,
+                                                   bool right) noexcept
+        {
+            const CharT* first = str.data();
+            const CharT* last = first + str.size();
+            if (right)
+                last = set.rfind(first, last, false);
+            if (left)
+                first = set.find(first, last, false);
+            return basic_string_view<CharT, Traits>(first, static_cast<std::size_t>(last - first));
+        }
+    } // namespace detail
+
+    /**
+     * @brief Precompiled set of characters for trimming and find-any searches.
+     *
+     * Building the set does the per-character work once, so it pays off when the same set is used
+     * on many strings, e.g. a user-provided whitespace set applied to every field of a file. The set
+     * owns its data and can be shared between threads.
+     *
+     * @tparam CharT Character type.
+     * @tparam Traits Character traits type.
+     */
+    template <typename CharT, typename Traits = std::char_traits<CharT>>
+    class basic_char_set
+    {
+      public:
+        using view_type = basic_string_view<CharT, Traits>;
+        using size_type = std::size_t;
+
+        /**
+         * @brief Value returned by the find functions when no character matches.
+         */
+        static constexpr size_type npos = size_type(-1);
+
+        /**
+         * @brief Builds a set holding every character of chars.
+         * @param chars Characters of the set, in any order; duplicates are ignored.
+         */
+        explicit basic_char_set(view_type chars) : _bytes(detail::make_byte_set()), _wide()
+        {
+            for (CharT c : chars)
+            {
+                if (detail::char_set_view<CharT, Traits>::is_byte(c))
+                    detail::byte_set_insert(_bytes, static_cast<unsigned char>(c));
+                else
+                    _wide.push_back(c);
+            }
+        }
+
+        /**
+         * @brief The default whitespace set (space, tab, newline, carriage return, form feed, vertical tab).
+         */
+        static const basic_char_set& whitespace()
+        {
+            static const basic_char_set set(detail::default_whitespace<CharT, Traits>());
+            return set;
+        }
+
+        /**
+         * @brief Checks whether c is a member of the set.
+         */
+        bool contains(CharT c) const noexcept
+        {
+            return view().contains(c);
+        }
+
+        /**
+         * @brief Finds the first character of str at or after pos that is a member of the set.
+         * @return Its position, or npos.
+         */
+        size_type find_first_of(view_type str, size_type pos = 0) const noexcept
+        {
+            return find(str, pos, true);
+        }
+
+        /**
+         * @brief Finds the first character of str at or after pos that is not a member of the set.
+         * @return Its position, or npos.
+         */
+        size_type find_first_not_of(view_type str, size_type pos = 0) const noexcept
+        {
+            return find(str, pos, false);
+        }
+
+        /**
+         * @brief Finds the last character of str at or before pos that is a member of the set.
+         * @return Its position, or npos.
+         */
+        size_type find_last_of(view_type str, size_type pos = npos) const noexcept
+        {
+            return rfind(str, pos, true);
+        }
+
+        /**
+         * @brief Finds the last character of str at or before pos that is not a member of the set.
+         * @return Its position, or npos.
+         */
+        size_type find_last_not_of(view_type str, size_type pos = npos) const noexcept
+        {
+            return rfind(str, pos, false);
+        }
+
+        /**
+         * @brief Removes the members of the set from both ends of str.
+         * @return View of the trimmed range of str; it refers to the same storage as str.
+         */
+        view_type trim(view_type str) const noexcept
+        {
+            return detail::trim_view(str, view(), true, true);
+        }
+
+        /**
+         * @brief Removes the members of the set from the start of str.
+         * @return View of the left-trimmed range of str; it refers to the same storage as str.
+         */
+        view_type trim_left(view_type str) const noexcept
+        {
+            return detail::trim_view(str, view(), true, false);
+        }
+
+        /**
+         * @brief Removes the members of the set from the end of str.
+         * @return View of the right-trimmed range of str; it refers to the same storage as str.
+         */
+        view_type trim_right(view_type str) const noexcept
+        {
+            return detail::trim_view(str, view(), false, true);
+        }
+
+        /**
+         * @brief Non-owning searcher over this set, valid while the set is alive.
+         */
+        detail::char_set_view<CharT, Traits> view() const noexcept
+        {
+            return detail::char_set_view<CharT, Traits>(_bytes, view_type(_wide.data(), _wide.size()));
+        }
+
+      private:
+        size_type find(view_type str, size_type pos, bool member) const noexcept
+        {
+            if (pos >= str.size())
+                return npos;
+            const CharT* last = str.data() + str.size();
+            const CharT* found = view().find(str.data() + pos, last, member);
+            return found == last ? npos : static_cast<size_type>(found - str.data());
+        }
+
+        size_type rfind(view_type str, size_type pos, bool member) const noexcept
+        {
+            const size_type end = pos < str.size() ? pos + 1 : str.size();
+            const CharT* found = view().rfind(str.data(), str.data() + end, member);
+            return found == str.data() ? npos : static_cast<size_type>(found - str.data()) - 1;
+        }
+
+        detail::byte_set _bytes;
+        std::basic_string<CharT, Traits> _wide;
+    };
+
+    template <typename CharT, typename Traits>
+    constexpr typename basic_char_set<CharT, Traits>::size_type basic_char_set<CharT, Traits>::npos;
+
+    /**
+     * @brief Precompiled character set for narrow strings.
+     */
+    using char_set = basic_char_set<char>;
+
+    /**
+     * @brief Precompiled character set for wide strings.
+     */
+    using wchar_set = basic_char_set<wchar_t>;
+
+} // namespace swe
@@ -8,6 +8,14 @@
  * for case-insensitive string comparison. Useful for settings, lookups, or any data where case-insensitive
  * string or wstring keys are required.
  *
+ * The hash and equality functors are transparent: they take string views, so C strings and slices of a
+ * larger buffer can be hashed and compared without building a std::string. C++20 unordered maps use them
+ * for heterogeneous find() directly; find_as() gives the same allocation-free lookup in C++11 to C++17.
+ *
+ * The ordered maps sort keys by their case-folded characters with ci_less and wci_less, so keys that start
+ * with the same prefix (ignoring case) are adjacent and equal_prefix_range() finds them with two tree
+ * descents.
+ *
  * @copyright MIT License
  * @date created 2025-05-16
  * @version 1.0
@@ -15,29 +23,33 @@
 
 #pragma once
 
+#include "ascii.hpp"
 #include "string.hpp"
+#include "string_view.hpp"
+#include "detail/case_fold.hpp"
+#include "detail/unicode_case.hpp"
 
 #include <algorithm>
 #include <functional>
 #include <map>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
 namespace swe
 {
     /**
      * @brief Case-insensitive hash functor for std::unordered_map with std::string keys.
+     *
+     * Keys are hashed as UTF-8 after Unicode simple case folding, matching ci_equal.
      */
     struct ci_hash
     {
-        inline size_t operator()(const std::string& str) const noexcept
+        using is_transparent = void;
+
+        inline size_t operator()(string_view str) const noexcept
         {
-            size_t hash = 0;
-            for (char c : str)
-            {
-                hash = (hash << 5) + hash + std::tolower(c);
-            }
-            return hash;
+            return detail::utf8_hash_folded(str.data(), str.size());
         }
     };
 
@@ -46,14 +58,11 @@ namespace swe
      */
     struct wci_hash
     {
-        inline size_t operator()(const std::wstring& str) const noexcept
+        using is_transparent = void;
+
+        inline size_t operator()(wstring_view str) const noexcept
         {
-            size_t hash = 0;
-            for (wchar_t c : str)
-            {
-                hash = (hash << 5) + hash + std::towlower(c);
-            }
-            return hash;
+            return detail::hash_folded(str.data(), str.size());
         }
     };
 
@@ -62,7 +71,9 @@ namespace swe
      */
     struct ci_equal
     {
-        inline bool operator()(const std::string& lhs, const std::string& rhs) const noexcept
+        using is_transparent = void;
+
+        inline bool operator()(string_view lhs, string_view rhs) const noexcept
         {
             return str_equals(lhs, rhs, string_compare_type::ordinal_ignore_case);
         }
@@ -73,12 +84,117 @@ namespace swe
      */
     struct wci_equal
     {
-        inline bool operator()(const std::wstring& lhs, const std::wstring& rhs) const noexcept
+        using is_transparent = void;
+
+        inline bool operator()(wstring_view lhs, wstring_view rhs) const noexcept
         {
             return wstr_equals(lhs, rhs, string_compare_type::ordinal_ignore_case);
         }
     };
 
+    namespace detail
+    {
+        /**
+         * @brief Lookup key of ci_less and wci_less that compares equal to every key starting with prefix.
+         */
+        template <typename CharT>
+        struct ci_prefix
+        {
+            explicit ci_prefix(basic_string_view<CharT> text) noexcept : prefix(text)
+            {
+            }
+
+            basic_string_view<CharT> prefix;
+        };
+
+        inline int compare_ci(string_view lhs, string_view rhs, bool prefix) noexcept
+        {
+            return utf8_compare_folded(lhs.data(), lhs.size(), rhs.data(), rhs.size(), prefix);
+        }
+
+        inline int compare_ci(wstring_view lhs, wstring_view rhs, bool prefix) noexcept
+        {
+            return compare_folded(lhs.data(), lhs.size(), rhs.data(), rhs.size(), prefix);
+        }
+    } // namespace detail
+
+    /**
+     * @brief Case-insensitive ordering functor for std::map with std::string keys.
+     *
+     * Orders keys by their code points after the same Unicode simple case folding ci_equal uses, so two keys
+     * are equivalent exactly when ci_equal considers them equal.
+     */
+    struct ci_less
+    {
+        using is_transparent = void;
+
+        inline bool operator()(string_view lhs, string_view rhs) const noexcept
+        {
+            return detail::compare_ci(lhs, rhs, false) < 0;
+        }
+
+        inline bool operator()(string_view key, detail::ci_prefix<char> prefix) const noexcept
+        {
+            return detail::compare_ci(key, prefix.prefix, true) < 0;
+        }
+
+        inline bool operator()(detail::ci_prefix<char> prefix, string_view key) const noexcept
+        {
+            return detail::compare_ci(key, prefix.prefix, true) > 0;
+        }
+    };
+
+    /**
+     * @brief Case-insensitive ordering functor for std::map with std::wstring keys.
+     *
+     * Orders keys by their characters after the folding wci_equal uses.
+     */
+    struct wci_less
+    {
+        using is_transparent = void;
+
+        inline bool operator()(wstring_view lhs, wstring_view rhs) const noexcept
+        {
+            return detail::compare_ci(lhs, rhs, false) < 0;
+        }
+
+        inline bool operator()(wstring_view key, detail::ci_prefix<wchar_t> prefix) const noexcept
+        {
+            return detail::compare_ci(key, prefix.prefix, true) < 0;
+        }
+
+        inline bool operator()(detail::ci_prefix<wchar_t> prefix, wstring_view key) const noexcept
+        {
+            return detail::compare_ci(key, prefix.prefix, true) > 0;
+        }
+    };
+
+    /**
+     * @brief Locale-free hash functor for std::string keys that ignores the case of ASCII letters only.
+     */
+    struct ci_ascii_hash
+    {
+        using is_transparent = void;
+
+        inline size_t operator()(string_view str) const noexcept
+        {
+            return detail::ascii_hash_folded(str.data(), str.size());
+        }
+    };
+
+    /**
+     * @brief Locale-free equality functor for std::string keys that ignores the case of ASCII letters only.
+     */
+    struct ci_ascii_equal
+    {
+        using is_transparent = void;
+
+        inline bool operator()(string_view lhs, string_view rhs) const noexcept
+        {
+            return ascii_equals_ignore_case(lhs, rhs);
+        }
+    };
+
     /**
      * @brief Case-insensitive std::unordered_map with std::string keys.
      * @tparam T Value type.
@@ -93,7 +209,18 @@ namespace swe
      * @tparam Alloc Allocator type.
      */
     template <typename T, typename Alloc = std::allocator<std::pair<const std::string, T>>>
-    using ci_map = std::map<std::string, T, ci_equal, Alloc>;
+    using ci_map = std::map<std::string, T, ci_less, Alloc>;
+
+    /**
+     * @brief std::unordered_map with std::string keys that ignores the case of ASCII letters only.
+     *
+     * Faster than unordered_ci_map because hashing and comparison never consult the C locale.
+     *
+     * @tparam T Value type.
+     * @tparam Alloc Allocator type.
+     */
+    template <typename T, typename Alloc = std::allocator<std::pair<const std::string, T>>>
+    using unordered_ci_ascii_map = std::unordered_map<std::string, T, ci_ascii_hash, ci_ascii_equal, Alloc>;
 
     /**
      * @brief Case-insensitive std::unordered_map with std::wstring keys.
@@ -109,6 +236,106 @@ namespace swe
      * @tparam Alloc Allocator type.
      */
     template <typename T, typename Alloc = std::allocator<std::pair<const std::wstring, T>>>
-    using wci_map = std::map<std::wstring, T, wci_equal, Alloc>;
+    using wci_map = std::map<std::wstring, T, wci_less, Alloc>;
+
+    namespace detail
+    {
+        template <typename Map>
+        using map_key_view = basic_string_view<typename Map::key_type::value_type, typename Map::key_type::traits_type>;
+
+        /**
+         * @brief Copies key into a per-thread key object whose capacity is reused by every later lookup.
+         */
+        template <typename Key, typename CharT, typename Traits>
+        const Key& lookup_key(basic_string_view<CharT, Traits> key)
+        {
+            static thread_local Key scratch;
+            scratch.assign(key.data(), key.size());
+            return scratch;
+        }
+
+        template <typename Iterator, typename Map>
+        std::pair<Iterator, Iterator> prefix_range(Map& map, map_key_view<Map> prefix)
+        {
+            const ci_prefix<typename Map::key_type::value_type> probe(prefix);
+#if defined(__cpp_lib_generic_associative_lookup)
+            return map.equal_range(probe);
+#else
+            // Without heterogeneous lookup the end of the range is found by walking it
+            const Iterator first = map.lower_bound(lookup_key<typename Map::key_type>(prefix));
+            Iterator last = first;
+            while (last != map.end() && !map.key_comp()(probe, last->first))
+                ++last;
+            return std::pair<Iterator, Iterator>(first, last);
+#endif
+        }
+    } // namespace detail
+
+    /**
+     * @brief Looks up a string view or C string in a case-insensitive unordered map without building a key.
+     *
+     * Works with unordered_ci_map, unordered_ci_ascii_map and unordered_wci_map. With C++20 heterogeneous
+     * lookup this is map.find(key). Before that, the key is copied into a per-thread scratch string, which
+     * only allocates when a key is longer than any key looked up before on the same thread.
+     *
+     * @param map Map to search.
+     * @param key Key to look up.
+     * @return Iterator to the matching element, or map.end().
+     */
+    template <typename Map>
+    typename Map::iterator find_as(Map& map, detail::type_identity_t<detail::map_key_view<Map>> key)
+    {
+#if defined(__cpp_lib_generic_unordered_lookup)
+        return map.find(key);
+#else
+        return map.find(detail::lookup_key<typename Map::key_type>(key));
+#endif
+    }
+
+    /**
+     * @brief Looks up a string view or C string in a case-insensitive unordered map without building a key.
+     * @param map Map to search.
+     * @param key Key to look up.
+     * @return Iterator to the matching element, or map.end().
+     */
+    template <typename Map>
+    typename Map::const_iterator find_as(const Map& map, detail::type_identity_t<detail::map_key_view<Map>> key)
+    {
+#if defined(__cpp_lib_generic_unordered_lookup)
+        return map.find(key);
+#else
+        return map.find(detail::lookup_key<typename Map::key_type>(key));
+#endif
+    }
+
+    /**
+     * @brief Finds the keys of a ci_map or wci_map that start with prefix, ignoring case.
+     *
+     * The keys are adjacent in the map's order, so the range is found with lower_bound and upper_bound
+     * (C++14 heterogeneous lookup) instead of scanning the map. In C++11 the end of the range is found by
+     * walking it, which is still proportional to the number of matches.
+     *
+     * @param map Map to search.
+     * @param prefix Prefix of the keys to find; an empty prefix selects the whole map.
+     * @return Range of the matching elements, in key order.
+     */
+    template <typename Map>
+    std::pair<typename Map::iterator, typename Map::iterator> equal_prefix_range(Map& map, detail::type_identity_t<detail::map_key_view<Map>> prefix)
+    {
+        return detail::prefix_range<typename Map::iterator>(map, prefix);
+    }
+
+    /**
+     * @brief Finds the keys of a ci_map or wci_map that start with prefix, ignoring case.
+     * @param map Map to search.
+     * @param prefix Prefix of the keys to find; an empty prefix selects the whole map.
+     * @return Range of the matching elements, in key order.
+     */
+    template <typename Map>
+    std::pair<typename Map::const_iterator, typename Map::const_iterator> equal_prefix_range(const Map& map,
+                                                                                           detail::type_identity_t<detail::map_key_view<Map>> prefix)
+    {
+        return detail::prefix_range<typename Map::const_iterator>(map, prefix);
+    }
 
-} // namespace swe
\ No newline at end of file
+} // namespace swe
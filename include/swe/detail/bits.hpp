@@ -0,0 +1,136 @@
+/**
+ * @file bits.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Portable bit manipulation helpers for the SWE SIMD kernels.
+ *
+ * This header wraps the compiler intrinsics used to walk the match masks produced by the SIMD
+ * kernels from either end and to count the bits of classification masks, along with the unaligned word load
+ * of the SWAR loops. It is an implementation detail and should not be included directly by user code.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace swe
+{
+    namespace detail
+    {
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+        /**
+         * @brief Unaligned load of the eight bytes at data, in memory order.
+         *
+         * Callers check that eight bytes remain first. GCC's -O3 unrolling still keeps the load on paths that
+         * the check rules out and reports it against short arrays, so -Warray-bounds is silenced here only.
+         */
+        inline std::uint64_t load_u64(const char* data) noexcept
+        {
+            std::uint64_t word;
+            std::memcpy(&word, data, 8);
+            return word;
+        }
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+        /**
+         * @brief Index of the lowest set bit of a non-zero 32-bit mask.
+         */
+        inline unsigned count_trailing_zeros(std::uint32_t mask) noexcept
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            unsigned long index;
+            _BitScanForward(&index, mask);
+            return static_cast<unsigned>(index);
+#else
+            return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+        }
+
+        /**
+         * @brief Index of the lowest set bit of a non-zero 64-bit mask.
+         */
+        inline unsigned count_trailing_zeros(std::uint64_t mask) noexcept
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+#if defined(_M_X64) || defined(_M_ARM64)
+            unsigned long index;
+            _BitScanForward64(&index, mask);
+            return static_cast<unsigned>(index);
+#else
+            const std::uint32_t low = static_cast<std::uint32_t>(mask);
+            return low ? count_trailing_zeros(low) : 32 + count_trailing_zeros(static_cast<std::uint32_t>(mask >> 32));
+#endif
+#else
+            return static_cast<unsigned>(__builtin_ctzll(mask));
+#endif
+        }
+
+        /**
+         * @brief Index of the highest set bit of a non-zero 32-bit mask.
+         */
+        inline unsigned highest_set_bit(std::uint32_t mask) noexcept
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            unsigned long index;
+            _BitScanReverse(&index, mask);
+            return static_cast<unsigned>(index);
+#else
+            return 31u - static_cast<unsigned>(__builtin_clz(mask));
+#endif
+        }
+
+        /**
+         * @brief Index of the highest set bit of a non-zero 64-bit mask.
+         */
+        inline unsigned highest_set_bit(std::uint64_t mask) noexcept
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+#if defined(_M_X64) || defined(_M_ARM64)
+            unsigned long index;
+            _BitScanReverse64(&index, mask);
+            return static_cast<unsigned>(index);
+#else
+            const std::uint32_t high = static_cast<std::uint32_t>(mask >> 32);
+            return high ? 32 + highest_set_bit(high) : highest_set_bit(static_cast<std::uint32_t>(mask));
+#endif
+#else
+            return 63u - static_cast<unsigned>(__builtin_clzll(mask));
+#endif
+        }
+
+        /**
+         * @brief Number of set bits in a 32-bit mask.
+         */
+        inline unsigned popcount(std::uint32_t mask) noexcept
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            // __popcnt needs the POPCNT instruction, which is not guaranteed, so count portably
+            mask = mask - ((mask >> 1) & 0x55555555u);
+            mask = (mask & 0x33333333u) + ((mask >> 2) & 0x33333333u);
+            return static_cast<unsigned>((((mask + (mask >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24);
+#else
+            return static_cast<unsigned>(__builtin_popcount(mask));
+#endif
+        }
+
+        /**
+         * @brief Number of set bits in a 64-bit mask.
+         */
+        inline unsigned popcount(std::uint64_t mask) noexcept
+        {
+            return popcount(static_cast<std::uint32_t>(mask)) + popcount(static_cast<std::uint32_t>(mask >> 32));
+        }
+    } // namespace detail
+} // namespace swe
\ No newline at end of file
@@ -0,0 +1,354 @@
+/**
+ * @file byte_set.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief SIMD byte-set classification kernels for the SWE library.
+ *
+ * A byte_set stores a set of byte values twice: as a 256-bit bitmap for scalar lookups, and as a
+ * pair of 16-entry nibble tables that SIMD kernels index with byte shuffles. Each table entry holds
+ * one bit per high nibble, so a byte belongs to the set when the entry selected by its low nibble
+ * has the bit of its high nibble set. This classifies 16, 32 or 64 bytes per step against an
+ * arbitrary set. The best kernel for the running CPU is selected on first use. It is an
+ * implementation detail and should not be included directly by user code.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "bits.hpp"
+#include "config.hpp"
+#include "cpu.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#if SWE_HAS_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace swe
+{
+    namespace detail
+    {
+        /**
+         * @brief Set of byte values, usable by both the scalar and the SIMD classification kernels.
+         */
+        struct byte_set
+        {
+            std::uint64_t bitmap[4];  ///< Bit b is set when byte value b is a member.
+            std::uint8_t nibbles[32]; ///< Entry (b >> 7) * 16 + (b & 15) has bit (b >> 4) & 7 set when b is a member.
+
+            bool contains(unsigned char c) const noexcept
+            {
+                return (bitmap[c >> 6] >> (c & 63)) & 1;
+            }
+        };
+
+        /**
+         * @brief Builds an empty byte set.
+         */
+        inline byte_set make_byte_set() noexcept
+        {
+            byte_set set = {{0, 0, 0, 0}, {0}};
+            return set;
+        }
+
+        /**
+         * @brief Adds byte value c to set.
+         */
+        inline void byte_set_insert(byte_set& set, unsigned char c) noexcept
+        {
+            set.bitmap[c >> 6] |= std::uint64_t(1) << (c & 63);
+            set.nibbles[(c >> 7) * 16 + (c & 15)] |= static_cast<std::uint8_t>(1u << ((c >> 4) & 7));
+        }
+
+        /**
+         * @brief Builds a byte set holding every byte of chars.
+         */
+        inline byte_set make_byte_set(const char* chars, std::size_t count) noexcept
+        {
+            byte_set set = make_byte_set();
+            for (std::size_t i = 0; i < count; ++i)
+                byte_set_insert(set, static_cast<unsigned char>(chars[i]));
+            return set;
+        }
+
+        /**
+         * @brief Signature shared by the byte-set kernels. Returns the offset of the first byte of data
+         * whose membership in set equals member, or count if there is none.
+         */
+        using byte_set_kernel = std::size_t (*)(const char* data, std::size_t count, const byte_set& set, bool member);
+
+        inline std::size_t byte_set_scalar(const char* data, std::size_t count, const byte_set& set, bool member) noexcept
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if (set.contains(static_cast<unsigned char>(data[i])) == member)
+                    return i;
+            }
+            return count;
+        }
+
+        /**
+         * @brief Signature shared by the reverse byte-set kernels. Returns one past the offset of the last
+         * byte of data whose membership in set equals member, or 0 if there is none.
+         */
+        using byte_set_reverse_kernel = std::size_t (*)(const char* data, std::size_t count, const byte_set& set, bool member);
+
+        inline std::size_t byte_set_reverse_scalar(const char* data, std::size_t count, const byte_set& set, bool member) noexcept
+        {
+            for (std::size_t i = count; i > 0; --i)
+            {
+                if (set.contains(static_cast<unsigned char>(data[i - 1])) == member)
+                    return i;
+            }
+            return 0;
+        }
+
+#if SWE_HAS_X86_SIMD
+        // Bit of each high nibble within the low-half (0-7) and high-half (8-15) nibble tables
+        static const std::int8_t byte_set_high_bits[2][16] = {
+            {1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0},
+            {0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 4, 8, 16, 32, 64, -128},
+        };
+
+        SWE_TARGET("ssse3")
+        inline std::size_t byte_set_ssse3(const char* data, std::size_t count, const byte_set& set, bool member) noexcept
+        {
+            const __m128i low_table = _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.nibbles));
+            const __m128i high_table = _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.nibbles + 16));
+            const __m128i low_bits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(byte_set_high_bits[0]));
+            const __m128i high_bits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(byte_set_high_bits[1]));
+            const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+            const std::uint32_t flip = member ? 0xFFFFu : 0u;
+            std::size_t i = 0;
+            for (; i + 16 <= count; i += 16)
+            {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                const __m128i lo = _mm_and_si128(v, nibble_mask);
+                const __m128i hi = _mm_and_si128(_mm_srli_epi16(v, 4), nibble_mask);
+                const __m128i bits = _mm_or_si128(_mm_and_si128(_mm_shuffle_epi8(low_table, lo), _mm_shuffle_epi8(low_bits, hi)),
+                                                  _mm_and_si128(_mm_shuffle_epi8(high_table, lo), _mm_shuffle_epi8(high_bits, hi)));
+                // Bits of the movemask are set for non-members; flipping them looks for members instead
+                const std::uint32_t mask =
+                    static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bits, _mm_setzero_si128()))) ^ flip;
+                if (mask)
+                    return i + count_trailing_zeros(mask);
+            }
+            return i + byte_set_scalar(data + i, count - i, set, member);
+        }
+
+        SWE_TARGET("avx2")
+        inline std::size_t byte_set_avx2(const char* data, std::size_t count, const byte_set& set, bool member) noexcept
+        {
+            // Byte shuffles index within each 128-bit lane, so every table is repeated in both lanes
+            const __m256i low_table = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(set.nibbles)));
+            const __m256i high_table = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(set.nibbles + 16)));
+            const __m256i low_bits = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(byte_set_high_bits[0])));
+            const __m256i high_bits = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(byte_set_high_bits[1])));
+            const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+            const std::uint32_t flip = member ? 0xFFFFFFFFu : 0u;
+            std::size_t i = 0;
+            for (; i + 32 <= count; i += 32)
+            {
+                const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                const __m256i lo = _mm256_and_si256(v, nibble_mask);
+                const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble_mask);
+                const __m256i bits = _mm256_or_si256(_mm256_and_si256(_mm256_shuffle_epi8(low_table, lo), _mm256_shuffle_epi8(low_bits, hi)),
+                                                     _mm256_and_si256(_mm256_shuffle_epi8(high_table, lo), _mm256_shuffle_epi8(high_bits, hi)));
+                const std::uint32_t mask =
+                    static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(bits, _mm256_setzero_si256()))) ^ flip;
+                if (mask)
+                    return i + count_trailing_zeros(mask);
+            }
+            return i + byte_set_scalar(data + i, count - i, set, member);
+        }
+
+        SWE_TARGET("avx512f,avx512bw")
+        inline std::size_t byte_set_avx512bw(const char* data, std::size_t count, const byte_set& set, bool member) noexcept
+        {
+            // The zero-masked broadcast compiles to the plain one; the unmasked intrinsic reads an undefined source under GCC
+            const __m512i low_table = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.nibbles)));
+            const __m512i high_table = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.nibbles + 16)));
+            const __m512i low_bits = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_loadu_si128(reinterpret_cast<const __m128i*>(byte_set_high_bits[0])));
+            const __m512i high_bits = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_loadu_si128(reinterpret_cast<const __m128i*>(byte_set_high_bits[1])));
+            const __m512i nibble_mask = _mm512_set1_epi8(0x0F);
+            for (std::size_t i = 0; i < count; i += 64)
+            {
+                // The final partial block is loaded under a mask, so no scalar tail is needed
+                const std::uint64_t valid = count - i >= 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << (count - i)) - 1;
+                const __m512i v = _mm512_maskz_loadu_epi8(valid, data + i);
+                const __m512i lo = _mm512_and_si512(v, nibble_mask);
+                const __m512i hi = _mm512_and_si512(_mm512_srli_epi16(v, 4), nibble_mask);
+                const __m512i bits = _mm512_or_si512(_mm512_and_si512(_mm512_shuffle_epi8(low_table, lo), _mm512_shuffle_epi8(low_bits, hi)),
+                                                     _mm512_and_si512(_mm512_shuffle_epi8(high_table, lo), _mm512_shuffle_epi8(high_bits, hi)));
+                const std::uint64_t mask = (member ? _mm512_test_epi8_mask(bits, bits) : _mm512_testn_epi8_mask(bits, bits)) & valid;
+                if (mask)
+                    return i + count_trailing_zeros(mask);
+            }
+            return count;
+        }
+
+        SWE_TARGET("ssse3")
+        inline std::size_t byte_set_reverse_ssse3(const char* data, std::size_t count, const byte_set& set, bool member) noexcept
+        {
+            const __m128i low_table = _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.nibbles));
+            const __m128i high_table = _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.nibbles + 16));
+            const __m128i low_bits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(byte_set_high_bits[0]));
+            const __m128i high_bits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(byte_set_high_bits[1]));
+            const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+            const std::uint32_t flip = member ? 0xFFFFu : 0u;
+            std::size_t i = count;
+            for (; i >= 16; i -= 16)
+            {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i - 16));
+                const __m128i lo = _mm_and_si128(v, nibble_mask);
+                const __m128i hi = _mm_and_si128(_mm_srli_epi16(v, 4), nibble_mask);
+                const __m128i bits = _mm_or_si128(_mm_and_si128(_mm_shuffle_epi8(low_table, lo), _mm_shuffle_epi8(low_bits, hi)),
+                                                  _mm_and_si128(_mm_shuffle_epi8(high_table, lo), _mm_shuffle_epi8(high_bits, hi)));
+                const std::uint32_t mask =
+                    static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bits, _mm_setzero_si128()))) ^ flip;
+                if (mask)
+                    return i - 16 + highest_set_bit(mask) + 1;
+            }
+            return byte_set_reverse_scalar(data, i, set, member);
+        }
+
+        SWE_TARGET("avx2")
+        inline std::size_t byte_set_reverse_avx2(const char* data, std::size_t count, const byte_set& set, bool member) noexcept
+        {
+            const __m256i low_table = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(set.nibbles)));
+            const __m256i high_table = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(set.nibbles + 16)));
+            const __m256i low_bits = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(byte_set_high_bits[0])));
+            const __m256i high_bits = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(byte_set_high_bits[1])));
+            const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+            const std::uint32_t flip = member ? 0xFFFFFFFFu : 0u;
+            std::size_t i = count;
+            for (; i >= 32; i -= 32)
+            {
+                const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i - 32));
+                const __m256i lo = _mm256_and_si256(v, nibble_mask);
+                const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble_mask);
+                const __m256i bits = _mm256_or_si256(_mm256_and_si256(_mm256_shuffle_epi8(low_table, lo), _mm256_shuffle_epi8(low_bits, hi)),
+                                                     _mm256_and_si256(_mm256_shuffle_epi8(high_table, lo), _mm256_shuffle_epi8(high_bits, hi)));
+                const std::uint32_t mask =
+                    static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(bits, _mm256_setzero_si256()))) ^ flip;
+                if (mask)
+                    return i - 32 + highest_set_bit(mask) + 1;
+            }
+            return byte_set_reverse_scalar(data, i, set, member);
+        }
+
+        SWE_TARGET("avx512f,avx512bw")
+        inline std::size_t byte_set_reverse_avx512bw(const char* data, std::size_t count, const byte_set& set, bool member) noexcept
+        {
+            const __m512i low_table = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.nibbles)));
+            const __m512i high_table = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.nibbles + 16)));
+            const __m512i low_bits = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_loadu_si128(reinterpret_cast<const __m128i*>(byte_set_high_bits[0])));
+            const __m512i high_bits = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_loadu_si128(reinterpret_cast<const __m128i*>(byte_set_high_bits[1])));
+            const __m512i nibble_mask = _mm512_set1_epi8(0x0F);
+            for (std::size_t i = count; i > 0;)
+            {
+                // The block at the start of data may be partial and is loaded under a mask
+                const std::size_t start = i >= 64 ? i - 64 : 0;
+                const std::uint64_t valid = i - start == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << (i - start)) - 1;
+                const __m512i v = _mm512_maskz_loadu_epi8(valid, data + start);
+                const __m512i lo = _mm512_and_si512(v, nibble_mask);
+                const __m512i hi = _mm512_and_si512(_mm512_srli_epi16(v, 4), nibble_mask);
+                const __m512i bits = _mm512_or_si512(_mm512_and_si512(_mm512_shuffle_epi8(low_table, lo), _mm512_shuffle_epi8(low_bits, hi)),
+                                                     _mm512_and_si512(_mm512_shuffle_epi8(high_table, lo), _mm512_shuffle_epi8(high_bits, hi)));
+                const std::uint64_t mask = (member ? _mm512_test_epi8_mask(bits, bits) : _mm512_testn_epi8_mask(bits, bits)) & valid;
+                if (mask)
+                    return start + highest_set_bit(mask) + 1;
+                i = start;
+            }
+            return 0;
+        }
+#endif
+
+        /**
+         * @brief Picks the widest byte-set kernel supported by the running CPU.
+         */
+        inline byte_set_kernel select_byte_set_kernel() noexcept
+        {
+#if SWE_HAS_X86_SIMD
+            const cpu_features& features = get_cpu_features();
+            if (features.avx512bw)
+                return &byte_set_avx512bw;
+            if (features.avx2)
+                return &byte_set_avx2;
+            if (features.ssse3)
+                return &byte_set_ssse3;
+#endif
+            return &byte_set_scalar;
+        }
+
+        /**
+         * @brief Returns the byte-set kernel, selected once on first use.
+         */
+        inline byte_set_kernel byte_set_dispatch() noexcept
+        {
+            static const byte_set_kernel kernel = select_byte_set_kernel();
+            return kernel;
+        }
+
+        /**
+         * @brief Picks the widest reverse byte-set kernel supported by the running CPU.
+         */
+        inline byte_set_reverse_kernel select_byte_set_reverse_kernel() noexcept
+        {
+#if SWE_HAS_X86_SIMD
+            const cpu_features& features = get_cpu_features();
+            if (features.avx512bw)
+                return &byte_set_reverse_avx512bw;
+            if (features.avx2)
+                return &byte_set_reverse_avx2;
+            if (features.ssse3)
+                return &byte_set_reverse_ssse3;
+#endif
+            return &byte_set_reverse_scalar;
+        }
+
+        /**
+         * @brief Returns the reverse byte-set kernel, selected once on first use.
+         */
+        inline byte_set_reverse_kernel byte_set_reverse_dispatch() noexcept
+        {
+            static const byte_set_reverse_kernel kernel = select_byte_set_reverse_kernel();
+            return kernel;
+        }
+
+        /**
+         * @brief Offset of the first byte of data that belongs to set, or count.
+         */
+        inline std::size_t find_first_in(const char* data, std::size_t count, const byte_set& set) noexcept
+        {
+            return byte_set_dispatch()(data, count, set, true);
+        }
+
+        /**
+         * @brief Offset of the first byte of data that does not belong to set, or count.
+         */
+        inline std::size_t find_first_not_in(const char* data, std::size_t count, const byte_set& set) noexcept
+        {
+            return byte_set_dispatch()(data, count, set, false);
+        }
+
+        /**
+         * @brief One past the offset of the last byte of data that belongs to set, or 0.
+         */
+        inline std::size_t find_last_in(const char* data, std::size_t count, const byte_set& set) noexcept
+        {
+            return byte_set_reverse_dispatch()(data, count, set, true);
+        }
+
+        /**
+         * @brief One past the offset of the last byte of data that does not belong to set, or 0.
+         */
+        inline std::size_t find_last_not_in(const char* data, std::size_t count, const byte_set& set) noexcept
+        {
+            return byte_set_reverse_dispatch()(data, count, set, false);
+        }
+    } // namespace detail
+} // namespace swe
@@ -0,0 +1,133 @@
+/**
+ * @file case_fold.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Per-character case folding shared by the case-insensitive SWE utilities.
+ *
+ * This header defines how a single character is folded for string_compare_type::ordinal_ignore_case
+ * and string_compare_type::ordinal_ignore_case_ascii, so that every component comparing or matching
+ * case-insensitively agrees on the same rules. Narrow text is folded by UTF-8 code point for
+ * ordinal_ignore_case, see unicode_case.hpp. Runs of wide characters are folded and compared with
+ * the wide SIMD kernels, which leave only the characters beyond ASCII to std::towlower. It is an
+ * implementation detail and should not be included directly by user code.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "../ascii.hpp"
+#include "hash.hpp"
+#include "wide_kernels.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cwctype>
+
+namespace swe
+{
+    namespace detail
+    {
+        /**
+         * @brief Folds a wide character for case-insensitive comparison.
+         */
+        inline wchar_t fold_case(wchar_t c) noexcept
+        {
+            return static_cast<wchar_t>(std::towlower(static_cast<std::wint_t>(c)));
+        }
+
+        /**
+         * @brief Folds count wide characters of src into dst, which may equal src, as fold_case(wchar_t) does.
+         */
+        inline void fold_case(wchar_t* dst, const wchar_t* src, std::size_t count) noexcept
+        {
+            for (std::size_t i = 0; i < count;)
+            {
+                i += wide_ascii_to_lower(dst + i, src + i, count - i);
+                // Characters beyond ASCII tend to come in runs, so map them here before going back to the kernel
+                for (; i < count && wide_unit(src[i]) >= 0x80; ++i)
+                    dst[i] = fold_case(src[i]);
+            }
+        }
+
+        /**
+         * @brief Checks whether count wide characters of lhs and rhs are equal after fold_case.
+         */
+        inline bool equal_folded(const wchar_t* lhs, const wchar_t* rhs, std::size_t count) noexcept
+        {
+            for (std::size_t i = 0; i < count;)
+            {
+                // The kernel skips characters equal after ASCII folding; the rest are decided by the locale
+                i += wide_fold_dispatch()(lhs + i, rhs + i, count - i);
+                for (; i < count && lhs[i] != rhs[i]; ++i)
+                {
+                    if (fold_case(lhs[i]) != fold_case(rhs[i]))
+                        return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Compares two wide strings by their characters after fold_case, as unsigned code point values.
+         *
+         * Two strings compare equal exactly when equal_folded considers them equal. If prefix is true, lhs
+         * compares equal to rhs as soon as it starts with rhs.
+         *
+         * @return Negative, zero or positive when lhs orders before, with or after rhs.
+         */
+        inline int compare_folded(const wchar_t* lhs, std::size_t lhs_count, const wchar_t* rhs, std::size_t rhs_count, bool prefix = false) noexcept
+        {
+            const std::size_t count = std::min(lhs_count, rhs_count);
+            for (std::size_t i = 0; i < count;)
+            {
+                i += wide_fold_dispatch()(lhs + i, rhs + i, count - i);
+                for (; i < count && lhs[i] != rhs[i]; ++i)
+                {
+                    const std::uint32_t l = wide_unit(fold_case(lhs[i]));
+                    const std::uint32_t r = wide_unit(fold_case(rhs[i]));
+                    if (l != r)
+                        return l < r ? -1 : 1;
+                }
+            }
+            if (lhs_count < rhs_count)
+                return -1;
+            return prefix || lhs_count == rhs_count ? 0 : 1;
+        }
+
+        /**
+         * @brief Hash of a wide string that is equal for any two strings equal_folded considers equal.
+         */
+        inline std::size_t hash_folded(const wchar_t* data, std::size_t count) noexcept
+        {
+            // The folded characters are hashed as bytes, 64 characters per append
+            wchar_t folded[64];
+            hash_stream stream;
+            for (std::size_t i = 0; i < count; i += 64)
+            {
+                const std::size_t block = std::min<std::size_t>(count - i, 64);
+                fold_case(folded, data + i, block);
+                stream.append(reinterpret_cast<const char*>(folded), block * sizeof(wchar_t));
+            }
+            return stream.finish();
+        }
+
+        /**
+         * @brief Folds a character for string_compare_type::ordinal_ignore_case_ascii: only 'A' to 'Z' change.
+         */
+        template <typename CharT>
+        CharT fold_case_ascii(CharT c) noexcept
+        {
+            return c >= CharT('A') && c <= CharT('Z') ? static_cast<CharT>(c + (CharT('a') - CharT('A'))) : c;
+        }
+
+        /**
+         * @brief Folds a narrow character for string_compare_type::ordinal_ignore_case_ascii through the ASCII table.
+         */
+        inline char fold_case_ascii(char c) noexcept
+        {
+            return swe::ascii_to_lower(c);
+        }
+    } // namespace detail
+} // namespace swe
\ No newline at end of file
@@ -0,0 +1,146 @@
+/**
+ * @file char_class_kernels.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief SIMD ASCII character classification kernels for the SWE library.
+ *
+ * This header provides kernels that classify 32 bytes at a time into bit masks of ASCII letters and
+ * digits and of ASCII whitespace, using the same classes as swe::ascii_is_alnum and
+ * swe::ascii_is_space. The slug and title-case conversions walk these masks run by run instead of
+ * classifying every byte. The best kernel for the running CPU is selected on first use. It is an
+ * implementation detail and should not be included directly by user code.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "../ascii.hpp"
+#include "config.hpp"
+#include "cpu.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#if SWE_HAS_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace swe
+{
+    namespace detail
+    {
+        /**
+         * @brief Number of bytes classified per block.
+         */
+        static const std::size_t char_class_block = 32;
+
+        /**
+         * @brief Class masks of a block; bit i describes byte i.
+         */
+        struct char_class_masks
+        {
+            std::uint32_t alnum; ///< ASCII letters and digits.
+            std::uint32_t space; ///< ASCII whitespace.
+        };
+
+        /**
+         * @brief Signature shared by the classification kernels. Classifies exactly char_class_block bytes.
+         */
+        using char_class_kernel = char_class_masks (*)(const char* data);
+
+        /**
+         * @brief Classifies up to char_class_block bytes through the ASCII table; bits past count stay clear.
+         */
+        inline char_class_masks classify_chars_scalar(const char* data, std::size_t count) noexcept
+        {
+            char_class_masks masks = {0, 0};
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const unsigned char classes = ascii_tables::classes[static_cast<unsigned char>(data[i])];
+                masks.alnum |= static_cast<std::uint32_t>((classes & ascii_alnum) != 0) << i;
+                masks.space |= static_cast<std::uint32_t>((classes & ascii_space) != 0) << i;
+            }
+            return masks;
+        }
+
+        inline char_class_masks classify_block_scalar(const char* data) noexcept
+        {
+            return classify_chars_scalar(data, char_class_block);
+        }
+
+#if SWE_HAS_X86_SIMD
+        // Bytes in [first, first + span) wrap to [0, span) after subtracting first, and only those saturate to zero
+
+        SWE_TARGET("sse2")
+        inline std::uint32_t classify_half_sse2(__m128i v, __m128i& space) noexcept
+        {
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i alpha = _mm_cmpeq_epi8(_mm_subs_epu8(_mm_sub_epi8(_mm_or_si128(v, _mm_set1_epi8(0x20)), _mm_set1_epi8('a')), _mm_set1_epi8(25)), zero);
+            const __m128i digit = _mm_cmpeq_epi8(_mm_subs_epu8(_mm_sub_epi8(v, _mm_set1_epi8('0')), _mm_set1_epi8(9)), zero);
+            space = _mm_or_si128(_mm_cmpeq_epi8(_mm_subs_epu8(_mm_sub_epi8(v, _mm_set1_epi8('\t')), _mm_set1_epi8(4)), zero), _mm_cmpeq_epi8(v, _mm_set1_epi8(' ')));
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_or_si128(alpha, digit)));
+        }
+
+        SWE_TARGET("sse2")
+        inline char_class_masks classify_block_sse2(const char* data) noexcept
+        {
+            __m128i low_space, high_space;
+            const std::uint32_t low = classify_half_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), low_space);
+            const std::uint32_t high = classify_half_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16)), high_space);
+            char_class_masks masks;
+            masks.alnum = low | (high << 16);
+            masks.space = static_cast<std::uint32_t>(_mm_movemask_epi8(low_space)) | (static_cast<std::uint32_t>(_mm_movemask_epi8(high_space)) << 16);
+            return masks;
+        }
+
+        SWE_TARGET("avx2")
+        inline char_class_masks classify_block_avx2(const char* data) noexcept
+        {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+            const __m256i zero = _mm256_setzero_si256();
+            const __m256i alpha =
+                _mm256_cmpeq_epi8(_mm256_subs_epu8(_mm256_sub_epi8(_mm256_or_si256(v, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a')), _mm256_set1_epi8(25)), zero);
+            const __m256i digit = _mm256_cmpeq_epi8(_mm256_subs_epu8(_mm256_sub_epi8(v, _mm256_set1_epi8('0')), _mm256_set1_epi8(9)), zero);
+            const __m256i space = _mm256_or_si256(_mm256_cmpeq_epi8(_mm256_subs_epu8(_mm256_sub_epi8(v, _mm256_set1_epi8('\t')), _mm256_set1_epi8(4)), zero),
+                                                  _mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')));
+            char_class_masks masks;
+            masks.alnum = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(alpha, digit)));
+            masks.space = static_cast<std::uint32_t>(_mm256_movemask_epi8(space));
+            return masks;
+        }
+#endif
+
+        /**
+         * @brief Picks the widest classification kernel supported by the running CPU.
+         */
+        inline char_class_kernel select_char_class_kernel() noexcept
+        {
+#if SWE_HAS_X86_SIMD
+            const cpu_features& features = get_cpu_features();
+            if (features.avx2)
+                return &classify_block_avx2;
+            if (features.sse2)
+                return &classify_block_sse2;
+#endif
+            return &classify_block_scalar;
+        }
+
+        /**
+         * @brief Returns the classification kernel, selected once on first use.
+         */
+        inline char_class_kernel char_class_dispatch() noexcept
+        {
+            static const char_class_kernel kernel = select_char_class_kernel();
+            return kernel;
+        }
+
+        /**
+         * @brief Classifies the next min(count, char_class_block) bytes of data.
+         */
+        inline char_class_masks classify_chars(const char* data, std::size_t count) noexcept
+        {
+            return count >= char_class_block ? char_class_dispatch()(data) : classify_chars_scalar(data, count);
+        }
+    } // namespace detail
+} // namespace swe
@@ -0,0 +1,137 @@
+/**
+ * @file config.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Internal configuration macros for the SWE library.
+ *
+ * This header detects the language standard and compiler features used by the
+ * rest of the library. It is an implementation detail and should not be included
+ * directly by user code.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+/**
+ * @brief The language standard the current translation unit is compiled with.
+ *
+ * MSVC keeps __cplusplus at 199711L unless /Zc:__cplusplus is given, so _MSVC_LANG is preferred there.
+ */
+#if defined(_MSVC_LANG)
+#define SWE_CPLUSPLUS _MSVC_LANG
+#else
+#define SWE_CPLUSPLUS __cplusplus
+#endif
+
+/**
+ * @brief Defined to 1 when the standard library provides std::basic_string_view (C++17 and later).
+ */
+#if SWE_CPLUSPLUS >= 201703L && defined(__has_include)
+#if __has_include(<string_view>)
+#define SWE_HAS_STD_STRING_VIEW 1
+#endif
+#endif
+
+#if !defined(SWE_HAS_STD_STRING_VIEW)
+#define SWE_HAS_STD_STRING_VIEW 0
+#endif
+
+/**
+ * @brief Defined to 1 when swe::basic_string_view is an alias of std::basic_string_view.
+ *
+ * Can be predefined to 0 or 1 to override detection. The library and the code using it must agree on
+ * this value, since it changes the signature of the view based functions; the CMake swe target exports
+ * the value its static library was built with. With 0 in C++17 the library's own view converts from and
+ * to std::basic_string_view.
+ */
+#if !defined(SWE_USE_STD_STRING_VIEW)
+#define SWE_USE_STD_STRING_VIEW SWE_HAS_STD_STRING_VIEW
+#endif
+
+/**
+ * @brief Expands to constexpr when relaxed (C++14) constexpr functions are available.
+ */
+#if SWE_CPLUSPLUS >= 201402L
+#define SWE_CONSTEXPR14 constexpr
+#else
+#define SWE_CONSTEXPR14
+#endif
+
+/**
+ * @brief Defined to 1 when compiling for x86 / x86-64.
+ */
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define SWE_ARCH_X86 1
+#else
+#define SWE_ARCH_X86 0
+#endif
+
+/**
+ * @brief Defined to 1 when the runtime dispatched x86 SIMD kernels are compiled in.
+ *
+ * Define SWE_DISABLE_SIMD to build with the portable scalar code paths only.
+ */
+#if SWE_ARCH_X86 && !defined(SWE_DISABLE_SIMD) && (defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER))
+#define SWE_HAS_X86_SIMD 1
+#else
+#define SWE_HAS_X86_SIMD 0
+#endif
+
+/**
+ * @brief Defined to 1 when the target stores integers little-endian, so a word loaded with memcpy
+ * holds its first byte in the lowest bits.
+ */
+#if (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || defined(_MSC_VER)
+#define SWE_LITTLE_ENDIAN 1
+#else
+#define SWE_LITTLE_ENDIAN 0
+#endif
+
+/**
+ * @brief Defined to 1 when SSE2 is part of the baseline instruction set (always on x86-64).
+ *
+ * Code on a hot path that cannot afford a call through a dispatched kernel pointer, such as the
+ * control byte scan of a flat hash map probe, uses SSE2 inline when this is set.
+ */
+#if SWE_HAS_X86_SIMD && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define SWE_HAS_SSE2 1
+#else
+#define SWE_HAS_SSE2 0
+#endif
+
+/**
+ * @brief Defined to 1 when wchar_t is 32 bits wide (Linux, macOS), so that a wide string holds one
+ * code point per character and the 32-bit lane kernels apply to it. Windows' wchar_t is 16 bits.
+ */
+#if defined(__SIZEOF_WCHAR_T__) && __SIZEOF_WCHAR_T__ == 4
+#define SWE_WCHAR_IS_32BIT 1
+#else
+#define SWE_WCHAR_IS_32BIT 0
+#endif
+
+/**
+ * @brief Enables an instruction set for a single function, so that SIMD kernels can be compiled
+ * without raising the baseline architecture of the whole library.
+ *
+ * MSVC allows intrinsics of any instruction set without this, so it expands to nothing there.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define SWE_TARGET(isa) __attribute__((target(isa)))
+#else
+#define SWE_TARGET(isa)
+#endif
+
+/**
+ * @brief Prefix of the functions that are defined out of line in the .ipp implementation files.
+ *
+ * Define SWE_HEADER_ONLY (or link the swe target configured with the SWE_HEADER_ONLY CMake option) to
+ * include the implementation files from the public headers. The functions are then inline, so calls
+ * such as str_equals() inside a hash map probe can be inlined and constant folded without LTO.
+ * Otherwise they are compiled once into the swe library by the files in src/.
+ */
+#if defined(SWE_HEADER_ONLY)
+#define SWE_DECL inline
+#else
+#define SWE_DECL
+#endif
\ No newline at end of file
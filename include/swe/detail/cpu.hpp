@@ -0,0 +1,109 @@
+/**
+ * @file cpu.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Runtime CPU feature detection for the SWE library.
+ *
+ * This header queries the instruction set extensions supported by the running CPU and
+ * operating system, so that SIMD kernels can be selected once at runtime while the library
+ * itself is compiled for the baseline architecture. It is an implementation detail and should
+ * not be included directly by user code.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "config.hpp"
+
+#if SWE_HAS_X86_SIMD
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace swe
+{
+    namespace detail
+    {
+        /**
+         * @brief Instruction set extensions usable by the SWE SIMD kernels.
+         */
+        struct cpu_features
+        {
+            bool sse2;     ///< SSE2 (16-byte vectors).
+            bool ssse3;    ///< SSSE3 (16-byte byte shuffles).
+            bool avx2;     ///< AVX2 with OS support for YMM state (32-byte vectors).
+            bool avx512bw; ///< AVX-512F/BW with OS support for ZMM state (64-byte vectors).
+        };
+
+#if SWE_HAS_X86_SIMD
+        inline void cpuid(unsigned int leaf, unsigned int subleaf, unsigned int regs[4]) noexcept
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            int r[4];
+            __cpuidex(r, static_cast<int>(leaf), static_cast<int>(subleaf));
+            for (int i = 0; i < 4; ++i)
+                regs[i] = static_cast<unsigned int>(r[i]);
+#else
+            __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+        }
+
+        inline unsigned long long xgetbv0() noexcept
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            return _xgetbv(0);
+#else
+            unsigned int eax, edx;
+            __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+            return (static_cast<unsigned long long>(edx) << 32) | eax;
+#endif
+        }
+#endif
+
+        /**
+         * @brief Queries the features of the running CPU. Prefer get_cpu_features(), which caches the result.
+         */
+        inline cpu_features detect_cpu_features() noexcept
+        {
+            cpu_features features = {false, false, false, false};
+#if SWE_HAS_X86_SIMD
+            unsigned int regs[4];
+            cpuid(0, 0, regs);
+            const unsigned int max_leaf = regs[0];
+            if (max_leaf < 1)
+                return features;
+
+            cpuid(1, 0, regs);
+            features.sse2 = (regs[3] & (1u << 26)) != 0;
+            features.ssse3 = (regs[2] & (1u << 9)) != 0;
+
+            // AVX state must be enabled by the OS (OSXSAVE + XMM/YMM bits of XCR0)
+            const bool osxsave = (regs[2] & (1u << 27)) != 0;
+            const unsigned long long xcr0 = osxsave ? xgetbv0() : 0;
+            const bool ymm_state = (xcr0 & 0x6) == 0x6;
+            const bool zmm_state = (xcr0 & 0xE6) == 0xE6;
+
+            if (max_leaf >= 7)
+            {
+                cpuid(7, 0, regs);
+                features.avx2 = ymm_state && (regs[1] & (1u << 5)) != 0;
+                features.avx512bw = zmm_state && (regs[1] & (1u << 16)) != 0 && (regs[1] & (1u << 30)) != 0;
+            }
+#endif
+            return features;
+        }
+
+        /**
+         * @brief Returns the features of the running CPU, detected once on first use.
+         */
+        inline const cpu_features& get_cpu_features() noexcept
+        {
+            static const cpu_features features = detect_cpu_features();
+            return features;
+        }
+    } // namespace detail
+} // namespace swe
\ No newline at end of file
@@ -0,0 +1,454 @@
+/**
+ * @file find_kernels.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief SIMD substring search kernels for the SWE library.
+ *
+ * This header provides kernels that locate a needle in a byte buffer. The SIMD variants compare
+ * the first and last byte of the needle against 16, 32 or 64 candidate positions at once and only
+ * verify the full needle where both bytes match, which rejects almost every position without a
+ * byte-by-byte comparison. The ASCII case-insensitive kernels fold both filter bytes with a single
+ * OR, and the candidate kernels find the positions where a case-insensitive Unicode match can
+ * start. The best kernel for the running CPU is selected on first use. It is an implementation
+ * detail and should not be included directly by user code.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "../ascii.hpp"
+#include "bits.hpp"
+#include "config.hpp"
+#include "cpu.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if SWE_HAS_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace swe
+{
+    namespace detail
+    {
+        /**
+         * @brief Value returned by the find kernels when the needle does not occur.
+         */
+        static const std::size_t find_npos = static_cast<std::size_t>(-1);
+
+        /**
+         * @brief Signature shared by the find kernels. Returns the offset of the first occurrence of
+         * needle in haystack, or find_npos. An empty needle is found at offset 0.
+         */
+        using find_kernel = std::size_t (*)(const char* haystack, std::size_t count, const char* needle, std::size_t needle_count);
+
+        inline std::size_t find_scalar(const char* haystack, std::size_t count, const char* needle, std::size_t needle_count) noexcept
+        {
+            if (needle_count == 0)
+                return 0;
+            if (needle_count > count)
+                return find_npos;
+            const char* it = haystack;
+            const char* const last = haystack + (count - needle_count) + 1;
+            while (it != last)
+            {
+                it = static_cast<const char*>(std::memchr(it, needle[0], static_cast<std::size_t>(last - it)));
+                if (!it)
+                    return find_npos;
+                if (std::memcmp(it + 1, needle + 1, needle_count - 1) == 0)
+                    return static_cast<std::size_t>(it - haystack);
+                ++it;
+            }
+            return find_npos;
+        }
+
+        // Finishes a SIMD search from offset start with the scalar kernel
+        inline std::size_t find_tail(const char* haystack, std::size_t count, std::size_t start, const char* needle, std::size_t needle_count) noexcept
+        {
+            const std::size_t found = find_scalar(haystack + start, count - start, needle, needle_count);
+            return found == find_npos ? find_npos : start + found;
+        }
+
+#if SWE_HAS_X86_SIMD
+        SWE_TARGET("sse2")
+        inline std::size_t find_sse2(const char* haystack, std::size_t count, const char* needle, std::size_t needle_count) noexcept
+        {
+            if (needle_count < 2 || needle_count > count)
+                return find_scalar(haystack, count, needle, needle_count);
+            const __m128i first = _mm_set1_epi8(needle[0]);
+            const __m128i last = _mm_set1_epi8(needle[needle_count - 1]);
+            std::size_t i = 0;
+            for (; i + needle_count - 1 + 16 <= count; i += 16)
+            {
+                const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + i));
+                const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + i + needle_count - 1));
+                std::uint32_t mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last))));
+                for (; mask; mask &= mask - 1)
+                {
+                    const std::size_t candidate = i + count_trailing_zeros(mask);
+                    if (std::memcmp(haystack + candidate + 1, needle + 1, needle_count - 2) == 0)
+                        return candidate;
+                }
+            }
+            return find_tail(haystack, count, i, needle, needle_count);
+        }
+
+        SWE_TARGET("avx2")
+        inline std::size_t find_avx2(const char* haystack, std::size_t count, const char* needle, std::size_t needle_count) noexcept
+        {
+            if (needle_count < 2 || needle_count > count)
+                return find_scalar(haystack, count, needle, needle_count);
+            const __m256i first = _mm256_set1_epi8(needle[0]);
+            const __m256i last = _mm256_set1_epi8(needle[needle_count - 1]);
+            std::size_t i = 0;
+            for (; i + needle_count - 1 + 32 <= count; i += 32)
+            {
+                const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + i));
+                const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + i + needle_count - 1));
+                std::uint32_t mask =
+                    static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last))));
+                for (; mask; mask &= mask - 1)
+                {
+                    const std::size_t candidate = i + count_trailing_zeros(mask);
+                    if (std::memcmp(haystack + candidate + 1, needle + 1, needle_count - 2) == 0)
+                        return candidate;
+                }
+            }
+            return find_tail(haystack, count, i, needle, needle_count);
+        }
+
+        SWE_TARGET("avx512f,avx512bw")
+        inline std::size_t find_avx512bw(const char* haystack, std::size_t count, const char* needle, std::size_t needle_count) noexcept
+        {
+            if (needle_count < 2 || needle_count > count)
+                return find_scalar(haystack, count, needle, needle_count);
+            const __m512i first = _mm512_set1_epi8(needle[0]);
+            const __m512i last = _mm512_set1_epi8(needle[needle_count - 1]);
+            std::size_t i = 0;
+            for (; i + needle_count - 1 + 64 <= count; i += 64)
+            {
+                const __m512i a = _mm512_loadu_si512(haystack + i);
+                const __m512i b = _mm512_loadu_si512(haystack + i + needle_count - 1);
+                std::uint64_t mask = _mm512_cmpeq_epi8_mask(a, first) & _mm512_cmpeq_epi8_mask(b, last);
+                for (; mask; mask &= mask - 1)
+                {
+                    const std::size_t candidate = i + count_trailing_zeros(mask);
+                    if (std::memcmp(haystack + candidate + 1, needle + 1, needle_count - 2) == 0)
+                        return candidate;
+                }
+            }
+            return find_tail(haystack, count, i, needle, needle_count);
+        }
+#endif
+
+        /**
+         * @brief Picks the widest find kernel supported by the running CPU.
+         */
+        inline find_kernel select_find_kernel() noexcept
+        {
+#if SWE_HAS_X86_SIMD
+            const cpu_features& features = get_cpu_features();
+            if (features.avx512bw)
+                return &find_avx512bw;
+            if (features.avx2)
+                return &find_avx2;
+            if (features.sse2)
+                return &find_sse2;
+#endif
+            return &find_scalar;
+        }
+
+        /**
+         * @brief Returns the find kernel, selected once on first use.
+         */
+        inline find_kernel find_dispatch() noexcept
+        {
+            static const find_kernel kernel = select_find_kernel();
+            return kernel;
+        }
+
+        /**
+         * @brief Finds the first occurrence of needle in haystack with the selected kernel.
+         */
+        inline std::size_t find_bytes(const char* haystack, std::size_t count, const char* needle, std::size_t needle_count) noexcept
+        {
+            return find_dispatch()(haystack, count, needle, needle_count);
+        }
+
+        /**
+         * @brief Byte filter of the case-insensitive kernels: a byte b passes when (b | mask) == value.
+         */
+        struct ci_filter
+        {
+            char mask;
+            char value;
+        };
+
+        /**
+         * @brief Filter passing both cases of an ASCII letter, and only c itself for any other byte.
+         */
+        inline ci_filter ascii_ci_filter(char c) noexcept
+        {
+            // Setting bit 0x20 maps 'A'..'Z' onto 'a'..'z'; no other byte lands on a lower-case letter that way
+            return swe::ascii_is_alpha(c) ? ci_filter{'\x20', static_cast<char>(c | 0x20)} : ci_filter{'\0', c};
+        }
+
+        /**
+         * @brief Filter passing the UTF-8 lead bytes 0xC0 to 0xFF.
+         */
+        static const ci_filter utf8_lead_filter = {'\x3F', '\xFF'};
+
+        /**
+         * @brief Filter no byte passes.
+         */
+        static const ci_filter no_byte_filter = {'\xFF', '\0'};
+
+        inline std::size_t find_ascii_ci_scalar(const char* haystack, std::size_t count, const char* needle, std::size_t needle_count) noexcept
+        {
+            if (needle_count == 0)
+                return 0;
+            if (needle_count > count)
+                return find_npos;
+            const unsigned char first = ascii_tables::lower[static_cast<unsigned char>(needle[0])];
+            for (std::size_t i = 0; i <= count - needle_count; ++i)
+            {
+                if (ascii_tables::lower[static_cast<unsigned char>(haystack[i])] == first && ascii_equal_ignore_case(haystack + i + 1, needle + 1, needle_count - 1))
+                    return i;
+            }
+            return find_npos;
+        }
+
+        // Finishes a SIMD case-insensitive search from offset start with the scalar kernel
+        inline std::size_t find_ascii_ci_tail(const char* haystack, std::size_t count, std::size_t start, const char* needle, std::size_t needle_count) noexcept
+        {
+            const std::size_t found = find_ascii_ci_scalar(haystack + start, count - start, needle, needle_count);
+            return found == find_npos ? find_npos : start + found;
+        }
+
+        /**
+         * @brief Signature of the candidate kernels. Returns the offset of the first byte of haystack that
+         * passes either filter, or find_npos.
+         */
+        using find_candidate_kernel = std::size_t (*)(const char* haystack, std::size_t count, ci_filter first, ci_filter second);
+
+        inline std::size_t find_candidate_scalar(const char* haystack, std::size_t count, ci_filter first, ci_filter second) noexcept
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const char c = haystack[i];
+                if (static_cast<char>(c | first.mask) == first.value || static_cast<char>(c | second.mask) == second.value)
+                    return i;
+            }
+            return find_npos;
+        }
+
+        // Finishes a SIMD candidate scan from offset start with the scalar kernel
+        inline std::size_t find_candidate_tail(const char* haystack, std::size_t count, std::size_t start, ci_filter first, ci_filter second) noexcept
+        {
+            const std::size_t found = find_candidate_scalar(haystack + start, count - start, first, second);
+            return found == find_npos ? find_npos : start + found;
+        }
+
+#if SWE_HAS_X86_SIMD
+        SWE_TARGET("sse2")
+        inline std::size_t find_ascii_ci_sse2(const char* haystack, std::size_t count, const char* needle, std::size_t needle_count) noexcept
+        {
+            if (needle_count < 2 || needle_count > count)
+                return find_ascii_ci_scalar(haystack, count, needle, needle_count);
+            const ci_filter first = ascii_ci_filter(needle[0]);
+            const ci_filter last = ascii_ci_filter(needle[needle_count - 1]);
+            const __m128i first_mask = _mm_set1_epi8(first.mask), first_value = _mm_set1_epi8(first.value);
+            const __m128i last_mask = _mm_set1_epi8(last.mask), last_value = _mm_set1_epi8(last.value);
+            std::size_t i = 0;
+            for (; i + needle_count - 1 + 16 <= count; i += 16)
+            {
+                const __m128i a = _mm_or_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + i)), first_mask);
+                const __m128i b = _mm_or_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + i + needle_count - 1)), last_mask);
+                std::uint32_t mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first_value), _mm_cmpeq_epi8(b, last_value))));
+                for (; mask; mask &= mask - 1)
+                {
+                    const std::size_t candidate = i + count_trailing_zeros(mask);
+                    if (ascii_equal_ignore_case(haystack + candidate + 1, needle + 1, needle_count - 2))
+                        return candidate;
+                }
+            }
+            return find_ascii_ci_tail(haystack, count, i, needle, needle_count);
+        }
+
+        SWE_TARGET("avx2")
+        inline std::size_t find_ascii_ci_avx2(const char* haystack, std::size_t count, const char* needle, std::size_t needle_count) noexcept
+        {
+            if (needle_count < 2 || needle_count > count)
+                return find_ascii_ci_scalar(haystack, count, needle, needle_count);
+            const ci_filter first = ascii_ci_filter(needle[0]);
+            const ci_filter last = ascii_ci_filter(needle[needle_count - 1]);
+            const __m256i first_mask = _mm256_set1_epi8(first.mask), first_value = _mm256_set1_epi8(first.value);
+            const __m256i last_mask = _mm256_set1_epi8(last.mask), last_value = _mm256_set1_epi8(last.value);
+            std::size_t i = 0;
+            for (; i + needle_count - 1 + 32 <= count; i += 32)
+            {
+                const __m256i a = _mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + i)), first_mask);
+                const __m256i b = _mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + i + needle_count - 1)), last_mask);
+                std::uint32_t mask =
+                    static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, first_value), _mm256_cmpeq_epi8(b, last_value))));
+                for (; mask; mask &= mask - 1)
+                {
+                    const std::size_t candidate = i + count_trailing_zeros(mask);
+                    if (ascii_equal_ignore_case(haystack + candidate + 1, needle + 1, needle_count - 2))
+                        return candidate;
+                }
+            }
+            return find_ascii_ci_tail(haystack, count, i, needle, needle_count);
+        }
+
+        SWE_TARGET("avx512f,avx512bw")
+        inline std::size_t find_ascii_ci_avx512bw(const char* haystack, std::size_t count, const char* needle, std::size_t needle_count) noexcept
+        {
+            if (needle_count < 2 || needle_count > count)
+                return find_ascii_ci_scalar(haystack, count, needle, needle_count);
+            const ci_filter first = ascii_ci_filter(needle[0]);
+            const ci_filter last = ascii_ci_filter(needle[needle_count - 1]);
+            const __m512i first_mask = _mm512_set1_epi8(first.mask), first_value = _mm512_set1_epi8(first.value);
+            const __m512i last_mask = _mm512_set1_epi8(last.mask), last_value = _mm512_set1_epi8(last.value);
+            std::size_t i = 0;
+            for (; i + needle_count - 1 + 64 <= count; i += 64)
+            {
+                const __m512i a = _mm512_or_si512(_mm512_loadu_si512(haystack + i), first_mask);
+                const __m512i b = _mm512_or_si512(_mm512_loadu_si512(haystack + i + needle_count - 1), last_mask);
+                std::uint64_t mask = _mm512_cmpeq_epi8_mask(a, first_value) & _mm512_cmpeq_epi8_mask(b, last_value);
+                for (; mask; mask &= mask - 1)
+                {
+                    const std::size_t candidate = i + count_trailing_zeros(mask);
+                    if (ascii_equal_ignore_case(haystack + candidate + 1, needle + 1, needle_count - 2))
+                        return candidate;
+                }
+            }
+            return find_ascii_ci_tail(haystack, count, i, needle, needle_count);
+        }
+
+        SWE_TARGET("sse2")
+        inline std::size_t find_candidate_sse2(const char* haystack, std::size_t count, ci_filter first, ci_filter second) noexcept
+        {
+            const __m128i first_mask = _mm_set1_epi8(first.mask), first_value = _mm_set1_epi8(first.value);
+            const __m128i second_mask = _mm_set1_epi8(second.mask), second_value = _mm_set1_epi8(second.value);
+            std::size_t i = 0;
+            for (; i + 16 <= count; i += 16)
+            {
+                const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + i));
+                const __m128i hits =
+                    _mm_or_si128(_mm_cmpeq_epi8(_mm_or_si128(bytes, first_mask), first_value), _mm_cmpeq_epi8(_mm_or_si128(bytes, second_mask), second_value));
+                const std::uint32_t mask = static_cast<std::uint32_t>(_mm_movemask_epi8(hits));
+                if (mask)
+                    return i + count_trailing_zeros(mask);
+            }
+            return find_candidate_tail(haystack, count, i, first, second);
+        }
+
+        SWE_TARGET("avx2")
+        inline std::size_t find_candidate_avx2(const char* haystack, std::size_t count, ci_filter first, ci_filter second) noexcept
+        {
+            const __m256i first_mask = _mm256_set1_epi8(first.mask), first_value = _mm256_set1_epi8(first.value);
+            const __m256i second_mask = _mm256_set1_epi8(second.mask), second_value = _mm256_set1_epi8(second.value);
+            std::size_t i = 0;
+            for (; i + 32 <= count; i += 32)
+            {
+                const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + i));
+                const __m256i hits = _mm256_or_si256(_mm256_cmpeq_epi8(_mm256_or_si256(bytes, first_mask), first_value),
+                                                     _mm256_cmpeq_epi8(_mm256_or_si256(bytes, second_mask), second_value));
+                const std::uint32_t mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(hits));
+                if (mask)
+                    return i + count_trailing_zeros(mask);
+            }
+            return find_candidate_tail(haystack, count, i, first, second);
+        }
+
+        SWE_TARGET("avx512f,avx512bw")
+        inline std::size_t find_candidate_avx512bw(const char* haystack, std::size_t count, ci_filter first, ci_filter second) noexcept
+        {
+            const __m512i first_mask = _mm512_set1_epi8(first.mask), first_value = _mm512_set1_epi8(first.value);
+            const __m512i second_mask = _mm512_set1_epi8(second.mask), second_value = _mm512_set1_epi8(second.value);
+            std::size_t i = 0;
+            for (; i + 64 <= count; i += 64)
+            {
+                const __m512i bytes = _mm512_loadu_si512(haystack + i);
+                const std::uint64_t mask = _mm512_cmpeq_epi8_mask(_mm512_or_si512(bytes, first_mask), first_value) |
+                                           _mm512_cmpeq_epi8_mask(_mm512_or_si512(bytes, second_mask), second_value);
+                if (mask)
+                    return i + count_trailing_zeros(mask);
+            }
+            return find_candidate_tail(haystack, count, i, first, second);
+        }
+#endif
+
+        /**
+         * @brief Picks the widest ASCII case-insensitive find kernel supported by the running CPU.
+         */
+        inline find_kernel select_find_ascii_ci_kernel() noexcept
+        {
+#if SWE_HAS_X86_SIMD
+            const cpu_features& features = get_cpu_features();
+            if (features.avx512bw)
+                return &find_ascii_ci_avx512bw;
+            if (features.avx2)
+                return &find_ascii_ci_avx2;
+            if (features.sse2)
+                return &find_ascii_ci_sse2;
+#endif
+            return &find_ascii_ci_scalar;
+        }
+
+        /**
+         * @brief Picks the widest candidate kernel supported by the running CPU.
+         */
+        inline find_candidate_kernel select_find_candidate_kernel() noexcept
+        {
+#if SWE_HAS_X86_SIMD
+            const cpu_features& features = get_cpu_features();
+            if (features.avx512bw)
+                return &find_candidate_avx512bw;
+            if (features.avx2)
+                return &find_candidate_avx2;
+            if (features.sse2)
+                return &find_candidate_sse2;
+#endif
+            return &find_candidate_scalar;
+        }
+
+        /**
+         * @brief Returns the ASCII case-insensitive find kernel, selected once on first use.
+         */
+        inline find_kernel find_ascii_ci_dispatch() noexcept
+        {
+            static const find_kernel kernel = select_find_ascii_ci_kernel();
+            return kernel;
+        }
+
+        /**
+         * @brief Returns the candidate kernel, selected once on first use.
+         */
+        inline find_candidate_kernel find_candidate_dispatch() noexcept
+        {
+            static const find_candidate_kernel kernel = select_find_candidate_kernel();
+            return kernel;
+        }
+
+        /**
+         * @brief Finds the first occurrence of needle in haystack ignoring the case of ASCII letters.
+         */
+        inline std::size_t find_bytes_ascii_ci(const char* haystack, std::size_t count, const char* needle, std::size_t needle_count) noexcept
+        {
+            return find_ascii_ci_dispatch()(haystack, count, needle, needle_count);
+        }
+
+        /**
+         * @brief Finds the first byte of haystack that passes either filter with the selected kernel.
+         */
+        inline std::size_t find_candidate(const char* haystack, std::size_t count, ci_filter first, ci_filter second) noexcept
+        {
+            return find_candidate_dispatch()(haystack, count, first, second);
+        }
+    } // namespace detail
+} // namespace swe
\ No newline at end of file
@@ -0,0 +1,137 @@
+/**
+ * @file flat_group.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Control byte groups probed by swe::flat_hash_map.
+ *
+ * Every slot of a flat hash map has one control byte: empty, deleted, or the low seven bits of the
+ * hash of the key it holds. A lookup reads the control bytes of a group of 16 slots at once and only
+ * compares keys in the slots whose byte matches. With SSE2 a group is matched with one compare and one
+ * movemask. The probe loop runs once or twice per lookup, so SSE2 is used inline where it is part of
+ * the baseline (SWE_HAS_SSE2) rather than through a dispatched kernel. It is an implementation detail
+ * and should not be included directly by user code.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "config.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#if SWE_HAS_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace swe
+{
+    namespace detail
+    {
+        using flat_ctrl = signed char;
+
+        /**
+         * @brief Control byte of a slot that never held an element; a probe stops at a group containing one.
+         */
+        constexpr flat_ctrl flat_empty = -128;
+
+        /**
+         * @brief Control byte of a slot whose element was erased; a probe continues past it.
+         */
+        constexpr flat_ctrl flat_deleted = -2;
+
+        /**
+         * @brief Control byte after the last slot, so iteration stops there without a bounds check.
+         */
+        constexpr flat_ctrl flat_sentinel = 0;
+
+        /**
+         * @brief Number of slots whose control bytes are matched at once.
+         */
+        constexpr std::size_t flat_group_width = 16;
+
+        /**
+         * @brief Group probed first for a hash.
+         */
+        inline std::size_t flat_h1(std::size_t hash) noexcept
+        {
+            return hash >> 7;
+        }
+
+        /**
+         * @brief Control byte of a full slot holding a key with this hash.
+         */
+        inline flat_ctrl flat_h2(std::size_t hash) noexcept
+        {
+            return static_cast<flat_ctrl>(hash & 0x7F);
+        }
+
+        /**
+         * @brief Bit i is set when control byte i of the group equals h2.
+         */
+        inline std::uint32_t flat_match_portable(const flat_ctrl* group, flat_ctrl h2) noexcept
+        {
+            std::uint32_t mask = 0;
+            for (std::size_t i = 0; i < flat_group_width; ++i)
+                mask |= static_cast<std::uint32_t>(group[i] == h2) << i;
+            return mask;
+        }
+
+        /**
+         * @brief Bit i is set when slot i of the group is empty.
+         */
+        inline std::uint32_t flat_match_empty_portable(const flat_ctrl* group) noexcept
+        {
+            return flat_match_portable(group, flat_empty);
+        }
+
+        /**
+         * @brief Bit i is set when slot i of the group is empty or deleted, i.e. free for an insert.
+         */
+        inline std::uint32_t flat_match_free_portable(const flat_ctrl* group) noexcept
+        {
+            std::uint32_t mask = 0;
+            for (std::size_t i = 0; i < flat_group_width; ++i)
+                mask |= static_cast<std::uint32_t>(group[i] < 0) << i;
+            return mask;
+        }
+
+#if SWE_HAS_SSE2
+        inline std::uint32_t flat_match_sse2(const flat_ctrl* group, flat_ctrl h2) noexcept
+        {
+            const __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(h2))));
+        }
+
+        inline std::uint32_t flat_match_free_sse2(const flat_ctrl* group) noexcept
+        {
+            // Empty and deleted are the only negative control bytes, so their sign bits are the mask
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(group))));
+        }
+#endif
+
+        inline std::uint32_t flat_match(const flat_ctrl* group, flat_ctrl h2) noexcept
+        {
+#if SWE_HAS_SSE2
+            return flat_match_sse2(group, h2);
+#else
+            return flat_match_portable(group, h2);
+#endif
+        }
+
+        inline std::uint32_t flat_match_empty(const flat_ctrl* group) noexcept
+        {
+            return flat_match(group, flat_empty);
+        }
+
+        inline std::uint32_t flat_match_free(const flat_ctrl* group) noexcept
+        {
+#if SWE_HAS_SSE2
+            return flat_match_free_sse2(group);
+#else
+            return flat_match_free_portable(group);
+#endif
+        }
+    } // namespace detail
+} // namespace swe
@@ -0,0 +1,191 @@
+/**
+ * @file hash.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Block hash behind the case-insensitive hash functors of the SWE library.
+ *
+ * Keys are hashed after case folding, so the hash works on a folded byte stream. The stream is
+ * consumed 16 bytes at a time. Each block is mixed into the state with a 64x64->128-bit multiply
+ * and the halves of the product are folded together, in the style of wyhash. A single changed
+ * bit spreads across the whole result, so similar keys such as "x-header-1" and "x-header-2"
+ * land in unrelated buckets.
+ *
+ * ASCII keys fold eight bytes at a time with SWAR and are hashed in place. Other keys are folded
+ * into a small buffer by hash_stream, which gives the same result as hashing the folded bytes in
+ * one piece. It is an implementation detail and should not be included directly by user code.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "../ascii.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(_MSC_VER) && defined(_M_X64) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace swe
+{
+    namespace detail
+    {
+        // Initial state and whitening constants (the wyhash secret). They are scalars rather than an array, so
+        // the inline functions below only read their values and are the same in every translation unit.
+        constexpr std::uint64_t hash_seed = 0xa0761d6478bd642full;
+        constexpr std::uint64_t hash_block_secret = 0xe7037ed1a0b428dbull;
+        constexpr std::uint64_t hash_final_secret = 0x8ebc6af09c88c6e3ull;
+        constexpr std::uint64_t hash_length_secret = 0x589965cc75374cc3ull;
+
+        /**
+         * @brief Number of bytes consumed per mixing step.
+         */
+        constexpr std::size_t hash_block = 16;
+
+        /**
+         * @brief Multiplies a by b into 128 bits and folds the high half into the low half.
+         */
+        inline std::uint64_t hash_mum(std::uint64_t a, std::uint64_t b) noexcept
+        {
+#if defined(__SIZEOF_INT128__)
+            __extension__ typedef unsigned __int128 uint128;
+            const uint128 product = static_cast<uint128>(a) * b;
+            return static_cast<std::uint64_t>(product) ^ static_cast<std::uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64) && !defined(__clang__)
+            std::uint64_t high;
+            const std::uint64_t low = _umul128(a, b, &high);
+            return low ^ high;
+#else
+            const std::uint64_t a_low = a & 0xFFFFFFFFu;
+            const std::uint64_t a_high = a >> 32;
+            const std::uint64_t b_low = b & 0xFFFFFFFFu;
+            const std::uint64_t b_high = b >> 32;
+            const std::uint64_t low_low = a_low * b_low;
+            const std::uint64_t high_low = a_high * b_low;
+            const std::uint64_t cross = (low_low >> 32) + (high_low & 0xFFFFFFFFu) + a_low * b_high;
+            const std::uint64_t low = (cross << 32) | (low_low & 0xFFFFFFFFu);
+            const std::uint64_t high = a_high * b_high + (high_low >> 32) + (cross >> 32);
+            return low ^ high;
+#endif
+        }
+
+        inline std::uint64_t hash_load(const char* data) noexcept
+        {
+            std::uint64_t word;
+            std::memcpy(&word, data, 8);
+            return word;
+        }
+
+        /**
+         * @brief Word transform for bytes that are already folded.
+         */
+        struct hash_fold_none
+        {
+            std::uint64_t operator()(std::uint64_t word) const noexcept
+            {
+                return word;
+            }
+        };
+
+        /**
+         * @brief Word transform that folds the ASCII letters of a word to lower case.
+         */
+        struct hash_fold_ascii
+        {
+            std::uint64_t operator()(std::uint64_t word) const noexcept
+            {
+                return ascii_fold_word(word);
+            }
+        };
+
+        /**
+         * @brief Mixes the first 16 * blocks bytes of data into seed, passing every word through fold.
+         */
+        template <typename Fold>
+        std::uint64_t hash_blocks(std::uint64_t seed, const char* data, std::size_t blocks, Fold fold) noexcept
+        {
+            for (std::size_t i = 0; i < blocks; ++i, data += hash_block)
+                seed = hash_mum(fold(hash_load(data)) ^ hash_block_secret, fold(hash_load(data + 8)) ^ seed);
+            return seed;
+        }
+
+        /**
+         * @brief Mixes the last count bytes of a stream of length bytes into seed and returns the hash.
+         *
+         * Blocks are consumed while more than one block remains, so the final 1 to 16 bytes always form
+         * a zero-padded last block, wherever the stream was split before.
+         */
+        template <typename Fold>
+        std::uint64_t hash_tail(std::uint64_t seed, const char* data, std::size_t count, std::uint64_t length, Fold fold) noexcept
+        {
+            const std::size_t blocks = count == 0 ? 0 : (count - 1) / hash_block;
+            seed = hash_blocks(seed, data, blocks, fold);
+            count -= blocks * hash_block;
+            if (count)
+            {
+                char last[hash_block] = {};
+                std::memcpy(last, data + blocks * hash_block, count);
+                seed = hash_blocks(seed, last, 1, fold);
+            }
+            return hash_mum(seed ^ hash_final_secret, length ^ hash_length_secret);
+        }
+
+        /**
+         * @brief Hash of count bytes that ignores the case of ASCII letters only.
+         */
+        inline std::size_t ascii_hash_folded(const char* data, std::size_t count) noexcept
+        {
+            return static_cast<std::size_t>(hash_tail(hash_seed, data, count, count, hash_fold_ascii()));
+        }
+
+        /**
+         * @brief Incremental form of the block hash over bytes that are already folded.
+         *
+         * Appending the folded bytes in any number of pieces gives the same hash as hash_tail over all of
+         * them at once.
+         */
+        class hash_stream
+        {
+          public:
+            hash_stream() noexcept : _seed(hash_seed), _length(0), _size(0)
+            {
+            }
+
+            void append(const char* data, std::size_t count) noexcept
+            {
+                _length += count;
+                while (count)
+                {
+                    const std::size_t n = count < sizeof(_buffer) - _size ? count : sizeof(_buffer) - _size;
+                    std::memcpy(_buffer + _size, data, n);
+                    _size += n;
+                    data += n;
+                    count -= n;
+                    // Only blocks that are known not to be the last one are mixed before finish()
+                    if (_size > flush_size)
+                    {
+                        _seed = hash_blocks(_seed, _buffer, flush_size / hash_block, hash_fold_none());
+                        _size -= flush_size;
+                        std::memmove(_buffer, _buffer + flush_size, _size);
+                    }
+                }
+            }
+
+            std::size_t finish() const noexcept
+            {
+                return static_cast<std::size_t>(hash_tail(_seed, _buffer, _size, _length, hash_fold_none()));
+            }
+
+          private:
+            static constexpr std::size_t flush_size = 256;
+
+            std::uint64_t _seed;
+            std::uint64_t _length;
+            std::size_t _size;
+            char _buffer[flush_size * 2];
+        };
+    } // namespace detail
+} // namespace swe
@@ -0,0 +1,63 @@
+/**
+ * @file join.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Pre-sized string join used by str_join and wstr_join.
+ *
+ * The join measures every piece first, grows the output once and then copies the pieces and
+ * delimiters straight into it. It is an implementation detail and should not be included directly
+ * by user code.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "../string_view.hpp"
+
+#include <cstddef>
+#include <string>
+
+namespace swe
+{
+    namespace detail
+    {
+        /**
+         * @brief Copies piece to dst and returns the position just past it.
+         */
+        template <typename CharT, typename Traits>
+        CharT* copy_piece(CharT* dst, basic_string_view<CharT, Traits> piece) noexcept
+        {
+            Traits::copy(dst, piece.data(), piece.size());
+            return dst + piece.size();
+        }
+
+        /**
+         * @brief Appends the elements of [first, last), separated by delimiter, to out.
+         *
+         * Each element must be convertible to basic_string_view<CharT, Traits>. The range is walked
+         * twice, once to measure and once to copy, so out grows exactly once.
+         */
+        template <typename CharT, typename Traits, typename Alloc, typename ForwardIt>
+        void join_append(std::basic_string<CharT, Traits, Alloc>& out, ForwardIt first, ForwardIt last, basic_string_view<CharT, Traits> delimiter)
+        {
+            using view_type = basic_string_view<CharT, Traits>;
+            if (first == last)
+                return;
+
+            std::size_t total = 0, count = 0;
+            for (ForwardIt it = first; it != last; ++it, ++count)
+                total += view_type(*it).size();
+            total += (count - 1) * delimiter.size();
+
+            const std::size_t offset = out.size();
+            out.resize(offset + total);
+            CharT* dst = &out[0] + offset;
+            // The view is taken in the same full-expression that copies it, so elements produced as
+            // temporaries by the iterator stay alive for the copy
+            dst = copy_piece(dst, view_type(*first));
+            for (++first; first != last; ++first)
+                dst = copy_piece(copy_piece(dst, delimiter), view_type(*first));
+        }
+    } // namespace detail
+} // namespace swe
\ No newline at end of file
@@ -0,0 +1,56 @@
+/**
+ * @file latin_transliteration.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Generated ASCII transliteration of accented Latin letters for the SWE slug utilities.
+ *
+ * Do not edit: generated by tools/generate_latin_transliteration.py. The table spells the letters of
+ * the Latin-1 Supplement and Latin Extended-A blocks (U+00C0 to U+017F) in lower-case ASCII, by their
+ * base letter or a conventional spelling such as "ss" for U+00DF and "ae" for U+00E6. It is an
+ * implementation detail and should not be included directly by user code.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace swe
+{
+    namespace detail
+    {
+        /**
+         * @brief First code point covered by the transliteration table.
+         */
+        static const std::uint32_t latin_transliteration_first = 0xC0;
+
+        /**
+         * @brief Number of code points covered by the transliteration table.
+         */
+        static const std::uint32_t latin_transliteration_count = 0xC0;
+
+        /**
+         * @brief ASCII spelling of a Latin code point: at most two lower-case letters, empty for the
+         * multiplication and division signs. Returns nullptr for code points outside the table.
+         */
+        inline const char* latin_transliteration(std::uint32_t cp) noexcept
+        {
+            static const char table[latin_transliteration_count][3] = {
+                "a", "a", "a", "a", "a", "a", "ae", "c", "e", "e", "e", "e", "i", "i", "i", "i", // U+00C0
+                "d", "n", "o", "o", "o", "o", "o", "", "o", "u", "u", "u", "u", "y", "th", "ss", // U+00D0
+                "a", "a", "a", "a", "a", "a", "ae", "c", "e", "e", "e", "e", "i", "i", "i", "i", // U+00E0
+                "d", "n", "o", "o", "o", "o", "o", "", "o", "u", "u", "u", "u", "y", "th", "y", // U+00F0
+                "a", "a", "a", "a", "a", "a", "c", "c", "c", "c", "c", "c", "c", "c", "d", "d", // U+0100
+                "d", "d", "e", "e", "e", "e", "e", "e", "e", "e", "e", "e", "g", "g", "g", "g", // U+0110
+                "g", "g", "g", "g", "h", "h", "h", "h", "i", "i", "i", "i", "i", "i", "i", "i", // U+0120
+                "i", "i", "ij", "ij", "j", "j", "k", "k", "k", "l", "l", "l", "l", "l", "l", "l", // U+0130
+                "l", "l", "l", "n", "n", "n", "n", "n", "n", "n", "n", "n", "o", "o", "o", "o", // U+0140
+                "o", "o", "oe", "oe", "r", "r", "r", "r", "r", "r", "s", "s", "s", "s", "s", "s", // U+0150
+                "s", "s", "t", "t", "t", "t", "t", "t", "u", "u", "u", "u", "u", "u", "u", "u", // U+0160
+                "u", "u", "u", "u", "w", "w", "y", "y", "y", "z", "z", "z", "z", "z", "z", "s", // U+0170
+            };
+            return cp - latin_transliteration_first < latin_transliteration_count ? table[cp - latin_transliteration_first] : nullptr;
+        }
+    } // namespace detail
+} // namespace swe
\ No newline at end of file
@@ -0,0 +1,126 @@
+/**
+ * @file parallel.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Chunked fork-join loop used by the batch string transforms.
+ *
+ * The index range is cut into chunks that cover whole cache lines of elements, and worker threads
+ * claim chunks from a shared atomic counter until none are left, so uneven string lengths balance
+ * out without a scheduler. It is an implementation detail and should not be included directly by
+ * user code.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace swe
+{
+    namespace detail
+    {
+        /**
+         * @brief Assumed size of a cache line in bytes.
+         */
+        static const std::size_t cache_line_size = 64;
+
+        /**
+         * @brief Fewest elements handed to a worker at once; smaller batches are not worth a thread.
+         */
+        static const std::size_t parallel_min_chunk = 512;
+
+        /**
+         * @brief Number of chunks each worker should get on average, so that a slow chunk can be balanced by the others.
+         */
+        static const std::size_t parallel_chunks_per_thread = 4;
+
+        /**
+         * @brief Number of threads the parallel loops use: the hardware concurrency, or 1 if it is unknown.
+         */
+        inline unsigned parallel_thread_count() noexcept
+        {
+            const unsigned count = std::thread::hardware_concurrency();
+            return count == 0 ? 1 : count;
+        }
+
+        /**
+         * @brief Elements per chunk for count elements of ElementSize bytes on threads workers.
+         *
+         * The chunk is a whole number of cache lines of elements, so for contiguous storage two workers
+         * write to at most one shared line per chunk boundary instead of interleaving lines.
+         */
+        template <std::size_t ElementSize>
+        std::size_t parallel_chunk_size(std::size_t count, unsigned threads) noexcept
+        {
+            const std::size_t line = ElementSize >= cache_line_size ? 1 : cache_line_size / ElementSize;
+            std::size_t chunk = count / (static_cast<std::size_t>(threads) * parallel_chunks_per_thread);
+            if (chunk < parallel_min_chunk)
+                chunk = parallel_min_chunk;
+            return (chunk + line - 1) / line * line;
+        }
+
+        /**
+         * @brief Calls fn(chunk_index, begin, end) for consecutive chunks of [0, count).
+         *
+         * Chunks run concurrently on up to max_threads threads, one of them the calling thread;
+         * a range that fits in a single chunk runs on the calling thread only. The first exception thrown
+         * by fn is rethrown once every worker has stopped; the chunks not yet started are skipped.
+         */
+        template <typename Fn>
+        void parallel_for_chunks(std::size_t count, std::size_t chunk, unsigned max_threads, Fn fn)
+        {
+            const std::size_t chunks = (count + chunk - 1) / chunk;
+            if (chunks <= 1)
+            {
+                if (count)
+                    fn(std::size_t(0), std::size_t(0), count);
+                return;
+            }
+
+            std::atomic<std::size_t> next(0);
+            std::exception_ptr error;
+            std::mutex error_mutex;
+            auto worker = [&]() {
+                for (std::size_t index = next.fetch_add(1); index < chunks; index = next.fetch_add(1))
+                {
+                    try
+                    {
+                        const std::size_t begin = index * chunk;
+                        fn(index, begin, count - begin < chunk ? count : begin + chunk);
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<std::mutex> lock(error_mutex);
+                        if (!error)
+                            error = std::current_exception();
+                        next.store(chunks);
+                    }
+                }
+            };
+
+            const std::size_t thread_count = max_threads == 0 ? 1 : chunks < max_threads ? chunks : max_threads;
+            std::vector<std::thread> threads;
+            try
+            {
+                threads.reserve(thread_count - 1);
+                for (std::size_t i = 1; i < thread_count; ++i)
+                    threads.emplace_back(worker);
+            }
+            catch (...)
+            {
+                // Could not start every thread; the ones that did and the calling thread still drain all chunks
+            }
+            worker();
+            for (std::thread& thread : threads)
+                thread.join();
+            if (error)
+                std::rethrow_exception(error);
+        }
+    } // namespace detail
+} // namespace swe
\ No newline at end of file
@@ -0,0 +1,365 @@
+/**
+ * @file string.ipp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Definitions of the str_* and wstr_* functions declared in string.hpp.
+ *
+ * Compiled into the swe library by src/, or included by string.hpp when SWE_HEADER_ONLY is defined.
+ * It is an implementation detail and should not be included directly by user code.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "../string.hpp"
+
+#include <utility>
+
+namespace swe
+{
+    // --- Narrow string (std::string) utilities ---
+
+    SWE_DECL std::string str_to_lower(const std::string& str)
+    {
+        return basic_str_to_lower(str);
+    }
+
+    SWE_DECL std::string str_to_lower(std::string&& str)
+    {
+        return basic_str_to_lower(std::move(str));
+    }
+
+    SWE_DECL void str_to_lower_inplace(std::string& str)
+    {
+        basic_str_to_lower_inplace(str);
+    }
+
+    SWE_DECL std::string str_to_upper(const std::string& str)
+    {
+        return basic_str_to_upper(str);
+    }
+
+    SWE_DECL std::string str_to_upper(std::string&& str)
+    {
+        return basic_str_to_upper(std::move(str));
+    }
+
+    SWE_DECL void str_to_upper_inplace(std::string& str)
+    {
+        basic_str_to_upper_inplace(str);
+    }
+
+    SWE_DECL std::string str_to_title(const std::string& str)
+    {
+        return basic_str_to_title(str);
+    }
+
+    SWE_DECL std::string str_to_title(std::string&& str)
+    {
+        return basic_str_to_title(std::move(str));
+    }
+
+    SWE_DECL void str_to_title_inplace(std::string& str)
+    {
+        basic_str_to_title_inplace(str);
+    }
+
+    SWE_DECL std::string str_to_slug(const std::string& str, char separator, string_slug_transliteration transliteration)
+    {
+        return basic_str_to_slug(str, separator, transliteration);
+    }
+
+    SWE_DECL std::string str_to_slug(std::string&& str, char separator, string_slug_transliteration transliteration)
+    {
+        return basic_str_to_slug(std::move(str), separator, transliteration);
+    }
+
+    SWE_DECL void str_to_slug_inplace(std::string& str, char separator, string_slug_transliteration transliteration)
+    {
+        basic_str_to_slug_inplace(str, separator, transliteration);
+    }
+
+    SWE_DECL std::string str_trim(const std::string& str, string_view whitespace)
+    {
+        return basic_str_trim(str, whitespace);
+    }
+
+    SWE_DECL std::string str_trim(std::string&& str, string_view whitespace)
+    {
+        return basic_str_trim(std::move(str), whitespace);
+    }
+
+    SWE_DECL void str_trim_inplace(std::string& str, string_view whitespace)
+    {
+        basic_str_trim_inplace(str, whitespace);
+    }
+
+    SWE_DECL std::string str_trim_left(const std::string& str, string_view whitespace)
+    {
+        return basic_str_trim_left(str, whitespace);
+    }
+
+    SWE_DECL std::string str_trim_left(std::string&& str, string_view whitespace)
+    {
+        return basic_str_trim_left(std::move(str), whitespace);
+    }
+
+    SWE_DECL void str_trim_left_inplace(std::string& str, string_view whitespace)
+    {
+        basic_str_trim_left_inplace(str, whitespace);
+    }
+
+    SWE_DECL std::string str_trim_right(const std::string& str, string_view whitespace)
+    {
+        return basic_str_trim_right(str, whitespace);
+    }
+
+    SWE_DECL std::string str_trim_right(std::string&& str, string_view whitespace)
+    {
+        return basic_str_trim_right(std::move(str), whitespace);
+    }
+
+    SWE_DECL void str_trim_right_inplace(std::string& str, string_view whitespace)
+    {
+        basic_str_trim_right_inplace(str, whitespace);
+    }
+
+    SWE_DECL std::string str_replace(const std::string& str, string_view from, string_view to)
+    {
+        return basic_str_replace(str, from, to);
+    }
+
+    SWE_DECL std::string str_replace(std::string&& str, string_view from, string_view to)
+    {
+        return basic_str_replace(std::move(str), from, to);
+    }
+
+    SWE_DECL void str_replace_inplace(std::string& str, string_view from, string_view to)
+    {
+        basic_str_replace_inplace(str, from, to);
+    }
+
+    SWE_DECL std::vector<std::string> str_split(const std::string& str, char delimiter, string_split_options options)
+    {
+        return basic_str_split(str, delimiter, options);
+    }
+
+    SWE_DECL std::vector<std::string> str_split_any(string_view str, string_view delimiters, string_split_options options)
+    {
+        return basic_str_split_any<char>(str, delimiters, options);
+    }
+
+    SWE_DECL std::vector<std::string> str_split_whitespace(string_view str)
+    {
+        return basic_str_split_whitespace<char>(str);
+    }
+
+    SWE_DECL std::string str_join(const std::vector<std::string>& strings, string_view delimiter)
+    {
+        return basic_str_join(strings, delimiter);
+    }
+
+    SWE_DECL std::string str_obfuscate(const std::string& str, string_view key)
+    {
+        return basic_str_obfuscate(str, key);
+    }
+
+    SWE_DECL std::string str_obfuscate(std::string&& str, string_view key)
+    {
+        return basic_str_obfuscate(std::move(str), key);
+    }
+
+    SWE_DECL void str_obfuscate_inplace(std::string& str, string_view key)
+    {
+        basic_str_obfuscate_inplace(str, key);
+    }
+
+    SWE_DECL std::string str_deobfuscate(const std::string& str, string_view key)
+    {
+        return basic_str_deobfuscate(str, key);
+    }
+
+    SWE_DECL std::string str_deobfuscate(std::string&& str, string_view key)
+    {
+        return basic_str_deobfuscate(std::move(str), key);
+    }
+
+    SWE_DECL void str_deobfuscate_inplace(std::string& str, string_view key)
+    {
+        basic_str_deobfuscate_inplace(str, key);
+    }
+
+    // --- Wide string (std::wstring) utilities ---
+
+    SWE_DECL std::wstring wstr_to_lower(const std::wstring& str)
+    {
+        return basic_str_to_lower(str);
+    }
+
+    SWE_DECL std::wstring wstr_to_lower(std::wstring&& str)
+    {
+        return basic_str_to_lower(std::move(str));
+    }
+
+    SWE_DECL void wstr_to_lower_inplace(std::wstring& str)
+    {
+        basic_str_to_lower_inplace(str);
+    }
+
+    SWE_DECL std::wstring wstr_to_upper(const std::wstring& str)
+    {
+        return basic_str_to_upper(str);
+    }
+
+    SWE_DECL std::wstring wstr_to_upper(std::wstring&& str)
+    {
+        return basic_str_to_upper(std::move(str));
+    }
+
+    SWE_DECL void wstr_to_upper_inplace(std::wstring& str)
+    {
+        basic_str_to_upper_inplace(str);
+    }
+
+    SWE_DECL std::wstring wstr_to_title(const std::wstring& str)
+    {
+        return basic_str_to_title(str);
+    }
+
+    SWE_DECL std::wstring wstr_to_title(std::wstring&& str)
+    {
+        return basic_str_to_title(std::move(str));
+    }
+
+    SWE_DECL void wstr_to_title_inplace(std::wstring& str)
+    {
+        basic_str_to_title_inplace(str);
+    }
+
+    SWE_DECL std::wstring wstr_to_slug(const std::wstring& str, wchar_t separator, string_slug_transliteration transliteration)
+    {
+        return basic_str_to_slug(str, separator, transliteration);
+    }
+
+    SWE_DECL std::wstring wstr_to_slug(std::wstring&& str, wchar_t separator, string_slug_transliteration transliteration)
+    {
+        return basic_str_to_slug(std::move(str), separator, transliteration);
+    }
+
+    SWE_DECL void wstr_to_slug_inplace(std::wstring& str, wchar_t separator, string_slug_transliteration transliteration)
+    {
+        basic_str_to_slug_inplace(str, separator, transliteration);
+    }
+
+    SWE_DECL std::wstring wstr_trim(const std::wstring& str, wstring_view whitespace)
+    {
+        return basic_str_trim(str, whitespace);
+    }
+
+    SWE_DECL std::wstring wstr_trim(std::wstring&& str, wstring_view whitespace)
+    {
+        return basic_str_trim(std::move(str), whitespace);
+    }
+
+    SWE_DECL void wstr_trim_inplace(std::wstring& str, wstring_view whitespace)
+    {
+        basic_str_trim_inplace(str, whitespace);
+    }
+
+    SWE_DECL std::wstring wstr_trim_left(const std::wstring& str, wstring_view whitespace)
+    {
+        return basic_str_trim_left(str, whitespace);
+    }
+
+    SWE_DECL std::wstring wstr_trim_left(std::wstring&& str, wstring_view whitespace)
+    {
+        return basic_str_trim_left(std::move(str), whitespace);
+    }
+
+    SWE_DECL void wstr_trim_left_inplace(std::wstring& str, wstring_view whitespace)
+    {
+        basic_str_trim_left_inplace(str, whitespace);
+    }
+
+    SWE_DECL std::wstring wstr_trim_right(const std::wstring& str, wstring_view whitespace)
+    {
+        return basic_str_trim_right(str, whitespace);
+    }
+
+    SWE_DECL std::wstring wstr_trim_right(std::wstring&& str, wstring_view whitespace)
+    {
+        return basic_str_trim_right(std::move(str), whitespace);
+    }
+
+    SWE_DECL void wstr_trim_right_inplace(std::wstring& str, wstring_view whitespace)
+    {
+        basic_str_trim_right_inplace(str, whitespace);
+    }
+
+    SWE_DECL std::wstring wstr_replace(const std::wstring& str, wstring_view from, wstring_view to)
+    {
+        return basic_str_replace(str, from, to);
+    }
+
+    SWE_DECL std::wstring wstr_replace(std::wstring&& str, wstring_view from, wstring_view to)
+    {
+        return basic_str_replace(std::move(str), from, to);
+    }
+
+    SWE_DECL void wstr_replace_inplace(std::wstring& str, wstring_view from, wstring_view to)
+    {
+        basic_str_replace_inplace(str, from, to);
+    }
+
+    SWE_DECL std::vector<std::wstring> wstr_split(const std::wstring& str, wchar_t delimiter, string_split_options options)
+    {
+        return basic_str_split(str, delimiter, options);
+    }
+
+    SWE_DECL std::vector<std::wstring> wstr_split_any(wstring_view str, wstring_view delimiters, string_split_options options)
+    {
+        return basic_str_split_any<wchar_t>(str, delimiters, options);
+    }
+
+    SWE_DECL std::vector<std::wstring> wstr_split_whitespace(wstring_view str)
+    {
+        return basic_str_split_whitespace<wchar_t>(str);
+    }
+
+    SWE_DECL std::wstring wstr_join(const std::vector<std::wstring>& strings, wstring_view delimiter)
+    {
+        return basic_str_join(strings, delimiter);
+    }
+
+    SWE_DECL std::wstring wstr_obfuscate(const std::wstring& str, wstring_view key)
+    {
+        return basic_str_obfuscate(str, key);
+    }
+
+    SWE_DECL std::wstring wstr_obfuscate(std::wstring&& str, wstring_view key)
+    {
+        return basic_str_obfuscate(std::move(str), key);
+    }
+
+    SWE_DECL void wstr_obfuscate_inplace(std::wstring& str, wstring_view key)
+    {
+        basic_str_obfuscate_inplace(str, key);
+    }
+
+    SWE_DECL std::wstring wstr_deobfuscate(const std::wstring& str, wstring_view key)
+    {
+        return basic_str_deobfuscate(str, key);
+    }
+
+    SWE_DECL std::wstring wstr_deobfuscate(std::wstring&& str, wstring_view key)
+    {
+        return basic_str_deobfuscate(std::move(str), key);
+    }
+
+    SWE_DECL void wstr_deobfuscate_inplace(std::wstring& str, wstring_view key)
+    {
+        basic_str_deobfuscate_inplace(str, key);
+    }
+
+} // namespace swe
\ No newline at end of file
@@ -0,0 +1,973 @@
+/**
+ * @file string_algorithms.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Character-type generic implementations behind the basic_str_* string utilities.
+ *
+ * Every algorithm is written once over CharT, Traits and Alloc. Where the rules depend on how a
+ * character type encodes text, the call is dispatched on an encoding tag: char and char8_t strings
+ * hold UTF-8, char16_t strings UTF-16 and char32_t strings UTF-32, and all three are case-mapped
+ * and folded with the Unicode simple mappings. wchar_t strings keep the C library's towlower,
+ * towupper and iswspace, with runs of ASCII case-mapped and compared by the wide SIMD kernels.
+ * Byte-sized strings are searched with the SIMD find kernels, also when ignoring case, and XORed
+ * with the SIMD XOR kernels. It is an implementation detail and should not be included directly by
+ * user code.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "../ascii.hpp"
+#include "../char_set.hpp"
+#include "../searcher.hpp"
+#include "../string_options.hpp"
+#include "../string_view.hpp"
+#include "ascii_case.hpp"
+#include "case_fold.hpp"
+#include "char_class_kernels.hpp"
+#include "find_kernels.hpp"
+#include "latin_transliteration.hpp"
+#include "transcode.hpp"
+#include "unicode_case.hpp"
+#include "utf8.hpp"
+#include "xor_kernels.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cwctype>
+#include <functional>
+#include <string>
+#include <type_traits>
+
+namespace swe
+{
+    namespace detail
+    {
+        /**
+         * @brief Encoding tag of char and char8_t strings.
+         */
+        struct utf8_encoding
+        {
+        };
+
+        /**
+         * @brief Encoding tag of char16_t strings.
+         */
+        struct utf16_encoding
+        {
+        };
+
+        /**
+         * @brief Encoding tag of char32_t strings.
+         */
+        struct utf32_encoding
+        {
+        };
+
+        /**
+         * @brief Encoding tag of wchar_t strings, which are classified and case-mapped by the C library.
+         */
+        struct wide_encoding
+        {
+        };
+
+        /**
+         * @brief Maps a character type to its encoding tag.
+         */
+        template <typename CharT>
+        struct char_encoding;
+
+        template <>
+        struct char_encoding<char>
+        {
+            using type = utf8_encoding;
+        };
+
+        template <>
+        struct char_encoding<wchar_t>
+        {
+            using type = wide_encoding;
+        };
+
+        template <>
+        struct char_encoding<char16_t>
+        {
+            using type = utf16_encoding;
+        };
+
+        template <>
+        struct char_encoding<char32_t>
+        {
+            using type = utf32_encoding;
+        };
+
+#if defined(__cpp_char8_t)
+        template <>
+        struct char_encoding<char8_t>
+        {
+            using type = utf8_encoding;
+        };
+#endif
+
+        template <typename CharT>
+        using encoding_of = typename char_encoding<CharT>::type;
+
+        /**
+         * @brief Whether strings of CharT and Traits compare like raw bytes and can use the byte kernels.
+         */
+        template <typename CharT, typename Traits>
+        struct is_byte_string : std::integral_constant<bool, sizeof(CharT) == 1 && std::is_same<Traits, std::char_traits<CharT>>::value>
+        {
+        };
+
+        template <typename CharT>
+        const char* as_bytes(const CharT* data) noexcept
+        {
+            return reinterpret_cast<const char*>(data);
+        }
+
+        template <typename CharT>
+        char* as_writable_bytes(CharT* data) noexcept
+        {
+            return reinterpret_cast<char*>(data);
+        }
+
+        // Character classification for the slugs of non-UTF-8 strings: wchar_t goes through the C
+        // library, char16_t and char32_t only recognize ASCII
+
+        inline bool char_is_alnum(wchar_t c)
+        {
+            return std::iswalnum(static_cast<std::wint_t>(c)) != 0;
+        }
+
+        template <typename CharT>
+        bool char_is_alnum(CharT c) noexcept
+        {
+            return static_cast<std::uint32_t>(c) < 0x80 && swe::ascii_is_alnum(static_cast<char>(c));
+        }
+
+        inline wchar_t char_to_lower(wchar_t c)
+        {
+            return static_cast<wchar_t>(std::towlower(static_cast<std::wint_t>(c)));
+        }
+
+        template <typename CharT>
+        CharT char_to_lower(CharT c) noexcept
+        {
+            return static_cast<std::uint32_t>(c) < 0x80 ? static_cast<CharT>(swe::ascii_to_lower(static_cast<char>(c))) : c;
+        }
+
+        // Case mappers. Each one converts runs of ASCII bytes (UTF-8 only), single code points
+        // (UTF-8, UTF-16 and UTF-32) and single wide characters (wchar_t)
+
+        struct lower_case_mapper
+        {
+            void operator()(char* dst, const char* src, std::size_t count) const noexcept
+            {
+                ascii_to_lower(dst, src, count);
+            }
+
+            std::uint32_t operator()(std::uint32_t cp) const noexcept
+            {
+                return to_lower_code_point(cp);
+            }
+
+            wchar_t operator()(wchar_t c) const
+            {
+                return static_cast<wchar_t>(std::towlower(static_cast<std::wint_t>(c)));
+            }
+        };
+
+        struct upper_case_mapper
+        {
+            void operator()(char* dst, const char* src, std::size_t count) const noexcept
+            {
+                ascii_to_upper(dst, src, count);
+            }
+
+            std::uint32_t operator()(std::uint32_t cp) const noexcept
+            {
+                return to_upper_code_point(cp);
+            }
+
+            wchar_t operator()(wchar_t c) const
+            {
+                return static_cast<wchar_t>(std::towupper(static_cast<std::wint_t>(c)));
+            }
+        };
+
+        /**
+         * @brief Maps the leading ASCII run of a wide string in place with the wide SIMD kernels and returns
+         * its length. Mappers without a bulk form map nothing here and take every character one at a time.
+         */
+        inline std::size_t wide_ascii_run(lower_case_mapper, wchar_t* data, std::size_t count) noexcept
+        {
+            return wide_ascii_to_lower(data, data, count);
+        }
+
+        inline std::size_t wide_ascii_run(upper_case_mapper, wchar_t* data, std::size_t count) noexcept
+        {
+            return wide_ascii_to_upper(data, data, count);
+        }
+
+        template <typename Mapper>
+        std::size_t wide_ascii_run(const Mapper&, wchar_t*, std::size_t) noexcept
+        {
+            return 0;
+        }
+
+        /**
+         * @brief Maps the first character of each whitespace-separated word to title case and the others
+         * to lower case. ASCII runs and code points share the state, so word boundaries carry across both.
+         */
+        class title_case_mapper
+        {
+          public:
+            title_case_mapper() noexcept : _new_word(true)
+            {
+            }
+
+            void operator()(char* dst, const char* src, std::size_t count) noexcept
+            {
+                // Lower-case the whole run, then upper-case the word starts the space masks mark
+                ascii_to_lower(dst, src, count);
+                for (std::size_t i = 0; i < count; i += char_class_block)
+                {
+                    const std::size_t block = std::min(count - i, char_class_block);
+                    const std::uint32_t space = classify_chars(src + i, block).space;
+                    std::uint32_t starts = ~space & ((space << 1) | (_new_word ? 1u : 0u));
+                    if (block < char_class_block)
+                        starts &= (1u << block) - 1;
+                    for (; starts; starts &= starts - 1)
+                    {
+                        const std::size_t at = i + count_trailing_zeros(starts);
+                        dst[at] = swe::ascii_to_upper(dst[at]);
+                    }
+                    _new_word = (space >> (block - 1)) & 1;
+                }
+            }
+
+            std::uint32_t operator()(std::uint32_t cp) noexcept
+            {
+                if (cp < 0x80 && swe::ascii_is_space(static_cast<char>(cp)))
+                {
+                    _new_word = true;
+                    return cp;
+                }
+                const std::uint32_t mapped = _new_word ? to_title_code_point(cp) : to_lower_code_point(cp);
+                _new_word = false;
+                return mapped;
+            }
+
+            wchar_t operator()(wchar_t c)
+            {
+                if (std::iswspace(static_cast<std::wint_t>(c)))
+                {
+                    _new_word = true;
+                    return c;
+                }
+                const wchar_t mapped = static_cast<wchar_t>(_new_word ? std::towupper(static_cast<std::wint_t>(c)) : std::towlower(static_cast<std::wint_t>(c)));
+                _new_word = false;
+                return mapped;
+            }
+
+          private:
+            bool _new_word;
+        };
+
+        /**
+         * @brief Appends UTF-8 src to out with every code point passed through map. Runs of ASCII bytes go
+         * through ascii_run(dst, src, count) in bulk; invalid UTF-8 bytes are copied unchanged.
+         */
+        template <typename String, typename AsciiRun, typename MapCodePoint>
+        void utf8_transform_append(const char* src, std::size_t count, String& out, AsciiRun ascii_run, MapCodePoint map)
+        {
+            using char_type = typename String::value_type;
+            std::size_t i = 0;
+            while (i < count)
+            {
+                const std::size_t run = ascii_prefix_length(src + i, count - i);
+                if (run > 0)
+                {
+                    const std::size_t at = out.size();
+                    out.resize(at + run);
+                    ascii_run(as_writable_bytes(&out[at]), src + i, run);
+                    i += run;
+                    continue;
+                }
+                const utf8_decoded decoded = utf8_decode(src + i, count - i);
+                if (decoded.valid)
+                {
+                    const std::uint32_t mapped = map(decoded.code_point);
+                    char encoded[4];
+                    utf8_encode(mapped, encoded);
+                    out.append(reinterpret_cast<const char_type*>(encoded), utf8_length(mapped));
+                }
+                else
+                {
+                    out.push_back(static_cast<char_type>(src[i]));
+                }
+                i += decoded.length;
+            }
+        }
+
+        /**
+         * @brief Like utf8_transform_append, but rewrites str where it stands for as long as every mapped
+         * code point keeps its encoded length, which is the case for all ASCII and most other letters.
+         */
+        template <typename String, typename AsciiRun, typename MapCodePoint>
+        void utf8_transform_inplace(String& str, AsciiRun ascii_run, MapCodePoint map)
+        {
+            const std::size_t count = str.size();
+            std::size_t i = 0;
+            while (i < count)
+            {
+                const std::size_t run = ascii_prefix_length(as_bytes(str.data()) + i, count - i);
+                if (run > 0)
+                {
+                    ascii_run(as_writable_bytes(&str[i]), as_bytes(str.data()) + i, run);
+                    i += run;
+                    continue;
+                }
+                const utf8_decoded decoded = utf8_decode(as_bytes(str.data()) + i, count - i);
+                if (!decoded.valid)
+                {
+                    ++i;
+                    continue;
+                }
+                const std::uint32_t mapped = map(decoded.code_point);
+                const std::size_t length = utf8_length(mapped);
+                if (length == decoded.length)
+                {
+                    utf8_encode(mapped, as_writable_bytes(&str[i]));
+                    i += length;
+                    continue;
+                }
+
+                // The encoded length changes, so the rest is written to a new buffer
+                String result(str.get_allocator());
+                result.reserve(count + count / 8 + 4);
+                result.append(str, 0, i);
+                char encoded[4];
+                utf8_encode(mapped, encoded);
+                result.append(reinterpret_cast<const typename String::value_type*>(encoded), length);
+                i += decoded.length;
+                utf8_transform_append(as_bytes(str.data()) + i, count - i, result, ascii_run, map);
+                str.swap(result);
+                return;
+            }
+        }
+
+        /**
+         * @brief Maps every code point of a UTF-16 or UTF-32 string in place.
+         *
+         * Invalid units are left unchanged. The simple case mappings never move a code point in or out of
+         * the Basic Multilingual Plane, so a mapping that would change the number of UTF-16 units cannot
+         * occur and is skipped rather than handled.
+         */
+        template <typename CharT, typename Traits, typename Alloc, typename MapCodePoint>
+        void units_transform_inplace(std::basic_string<CharT, Traits, Alloc>& str, MapCodePoint map)
+        {
+            const std::size_t count = str.size();
+            for (std::size_t i = 0; i < count;)
+            {
+                const utf8_decoded decoded = units_decode(str.data() + i, count - i);
+                if (decoded.valid)
+                {
+                    CharT encoded[2];
+                    if (units_encode(map(decoded.code_point), encoded) == decoded.length)
+                        Traits::copy(&str[i], encoded, decoded.length);
+                }
+                i += decoded.length;
+            }
+        }
+
+        template <typename CharT, typename Traits, typename Alloc, typename Mapper>
+        void case_map_inplace(std::basic_string<CharT, Traits, Alloc>& str, Mapper map, utf8_encoding)
+        {
+            utf8_transform_inplace(str, std::ref(map), std::ref(map));
+        }
+
+        template <typename CharT, typename Traits, typename Alloc, typename Mapper>
+        void case_map_inplace(std::basic_string<CharT, Traits, Alloc>& str, Mapper map, utf16_encoding)
+        {
+            units_transform_inplace(str, std::ref(map));
+        }
+
+        template <typename CharT, typename Traits, typename Alloc, typename Mapper>
+        void case_map_inplace(std::basic_string<CharT, Traits, Alloc>& str, Mapper map, utf32_encoding)
+        {
+            units_transform_inplace(str, std::ref(map));
+        }
+
+        template <typename CharT, typename Traits, typename Alloc, typename Mapper>
+        void case_map_inplace(std::basic_string<CharT, Traits, Alloc>& str, Mapper map, wide_encoding)
+        {
+            CharT* data = &str[0];
+            const std::size_t count = str.size();
+            for (std::size_t i = 0; i < count;)
+            {
+                i += wide_ascii_run(map, data + i, count - i);
+                if (i == count)
+                    break;
+                // Characters beyond ASCII, and every character for mappers without a bulk run, go through the locale
+                do
+                {
+                    data[i] = map(data[i]);
+                    ++i;
+                } while (i < count && wide_unit(data[i]) >= 0x80);
+            }
+        }
+
+        /**
+         * @brief Case-mapped copy of a UTF-8 string, built in one pass instead of copying and then mapping.
+         */
+        template <typename CharT, typename Traits, typename Alloc, typename Mapper>
+        std::basic_string<CharT, Traits, Alloc> case_mapped(const std::basic_string<CharT, Traits, Alloc>& str, Mapper map, utf8_encoding)
+        {
+            std::basic_string<CharT, Traits, Alloc> result(str.get_allocator());
+            result.reserve(str.size());
+            utf8_transform_append(as_bytes(str.data()), str.size(), result, std::ref(map), std::ref(map));
+            return result;
+        }
+
+        template <typename CharT, typename Traits, typename Alloc, typename Mapper, typename Encoding>
+        std::basic_string<CharT, Traits, Alloc> case_mapped(const std::basic_string<CharT, Traits, Alloc>& str, Mapper map, Encoding encoding)
+        {
+            std::basic_string<CharT, Traits, Alloc> result(str);
+            case_map_inplace(result, map, encoding);
+            return result;
+        }
+
+        /**
+         * @brief Compares count units of two UTF-16 or UTF-32 ranges code point by code point after simple
+         * case folding. Invalid units only match themselves.
+         */
+        template <typename CharT>
+        bool units_equal_folded(const CharT* lhs, const CharT* rhs, std::size_t count) noexcept
+        {
+            for (std::size_t i = 0; i < count;)
+            {
+                const utf8_decoded a = units_decode(lhs + i, count - i);
+                const utf8_decoded b = units_decode(rhs + i, count - i);
+                if (a.length != b.length || a.valid != b.valid)
+                    return false;
+                if (a.valid ? fold_code_point(a.code_point) != fold_code_point(b.code_point) : a.code_point != b.code_point)
+                    return false;
+                i += a.length;
+            }
+            return true;
+        }
+
+        template <typename CharT>
+        bool equal_folded(const CharT* lhs, const CharT* rhs, std::size_t count, utf8_encoding) noexcept
+        {
+            return utf8_match_folded(as_bytes(lhs), count, as_bytes(rhs), count) == count;
+        }
+
+        template <typename CharT>
+        bool equal_folded(const CharT* lhs, const CharT* rhs, std::size_t count, utf16_encoding) noexcept
+        {
+            return units_equal_folded(lhs, rhs, count);
+        }
+
+        template <typename CharT>
+        bool equal_folded(const CharT* lhs, const CharT* rhs, std::size_t count, utf32_encoding) noexcept
+        {
+            return units_equal_folded(lhs, rhs, count);
+        }
+
+        template <typename CharT>
+        bool equal_folded(const CharT* lhs, const CharT* rhs, std::size_t count, wide_encoding) noexcept
+        {
+            return equal_folded(lhs, rhs, count);
+        }
+
+        /**
+         * @brief Compares count characters of lhs and rhs under compare_type.
+         */
+        template <typename CharT, typename Traits>
+        bool equal_chars(const CharT* lhs, const CharT* rhs, std::size_t count, string_compare_type compare_type) noexcept
+        {
+            switch (compare_type)
+            {
+            case string_compare_type::ordinal_ignore_case:
+                return equal_folded(lhs, rhs, count, encoding_of<CharT>());
+            case string_compare_type::ordinal_ignore_case_ascii:
+                return ascii_equal_ignore_case(lhs, rhs, count);
+            default:
+                return Traits::compare(lhs, rhs, count) == 0;
+            }
+        }
+
+        // Case folding can change the encoded length of UTF-8, so it is matched code point by code point;
+        // the other encodings fold unit for unit and can compare equal-length ranges
+
+        template <typename CharT, typename Traits>
+        bool has_prefix(basic_string_view<CharT, Traits> str, basic_string_view<CharT, Traits> prefix, string_compare_type compare_type, utf8_encoding) noexcept
+        {
+            if (compare_type == string_compare_type::ordinal_ignore_case)
+                return utf8_match_folded(as_bytes(str.data()), str.size(), as_bytes(prefix.data()), prefix.size()) != utf8_no_match;
+            return prefix.size() <= str.size() && equal_chars<CharT, Traits>(str.data(), prefix.data(), prefix.size(), compare_type);
+        }
+
+        template <typename CharT, typename Traits, typename Encoding>
+        bool has_prefix(basic_string_view<CharT, Traits> str, basic_string_view<CharT, Traits> prefix, string_compare_type compare_type, Encoding) noexcept
+        {
+            return prefix.size() <= str.size() && equal_chars<CharT, Traits>(str.data(), prefix.data(), prefix.size(), compare_type);
+        }
+
+        template <typename CharT, typename Traits>
+        bool has_suffix(basic_string_view<CharT, Traits> str, basic_string_view<CharT, Traits> suffix, string_compare_type compare_type, utf8_encoding) noexcept
+        {
+            if (compare_type == string_compare_type::ordinal_ignore_case)
+                return utf8_match_folded_backward(as_bytes(str.data()), str.size(), as_bytes(suffix.data()), suffix.size());
+            return suffix.size() <= str.size() && equal_chars<CharT, Traits>(str.data() + (str.size() - suffix.size()), suffix.data(), suffix.size(), compare_type);
+        }
+
+        template <typename CharT, typename Traits, typename Encoding>
+        bool has_suffix(basic_string_view<CharT, Traits> str, basic_string_view<CharT, Traits> suffix, string_compare_type compare_type, Encoding) noexcept
+        {
+            return suffix.size() <= str.size() && equal_chars<CharT, Traits>(str.data() + (str.size() - suffix.size()), suffix.data(), suffix.size(), compare_type);
+        }
+
+        template <typename CharT, typename Traits>
+        bool equal_strings(basic_string_view<CharT, Traits> str1, basic_string_view<CharT, Traits> str2, string_compare_type compare_type, utf8_encoding) noexcept
+        {
+            if (compare_type == string_compare_type::ordinal_ignore_case)
+                return utf8_match_folded(as_bytes(str1.data()), str1.size(), as_bytes(str2.data()), str2.size()) == str1.size();
+            return str1.size() == str2.size() && equal_chars<CharT, Traits>(str1.data(), str2.data(), str1.size(), compare_type);
+        }
+
+        template <typename CharT, typename Traits, typename Encoding>
+        bool equal_strings(basic_string_view<CharT, Traits> str1, basic_string_view<CharT, Traits> str2, string_compare_type compare_type, Encoding) noexcept
+        {
+            return str1.size() == str2.size() && equal_chars<CharT, Traits>(str1.data(), str2.data(), str1.size(), compare_type);
+        }
+
+        // Byte strings are searched with the SIMD find kernels, wider ones with a Boyer-Moore-Horspool searcher
+
+        template <typename CharT, typename Traits>
+        std::size_t find_chars(basic_string_view<CharT, Traits> str, basic_string_view<CharT, Traits> needle, std::size_t pos, std::true_type) noexcept
+        {
+            if (pos > str.size())
+                return basic_string_view<CharT, Traits>::npos;
+            const std::size_t found = find_bytes(as_bytes(str.data()) + pos, str.size() - pos, as_bytes(needle.data()), needle.size());
+            return found == find_npos ? basic_string_view<CharT, Traits>::npos : pos + found;
+        }
+
+        template <typename CharT, typename Traits>
+        std::size_t find_chars(basic_string_view<CharT, Traits> str, basic_string_view<CharT, Traits> needle, std::size_t pos, std::false_type)
+        {
+            return basic_searcher<CharT, Traits>(needle).find(str, pos);
+        }
+
+        template <typename CharT, typename Traits>
+        std::size_t count_chars(basic_string_view<CharT, Traits> str, basic_string_view<CharT, Traits> needle, std::true_type) noexcept
+        {
+            std::size_t count = 0;
+            if (needle.empty())
+                return count;
+            for (std::size_t pos = find_chars(str, needle, 0, std::true_type()); pos != basic_string_view<CharT, Traits>::npos;
+                 pos = find_chars(str, needle, pos + needle.size(), std::true_type()))
+                ++count;
+            return count;
+        }
+
+        template <typename CharT, typename Traits>
+        std::size_t count_chars(basic_string_view<CharT, Traits> str, basic_string_view<CharT, Traits> needle, std::false_type)
+        {
+            return basic_searcher<CharT, Traits>(needle).count(str);
+        }
+
+        // Case-insensitive search. Offsets are in units of the haystack; under Unicode folding a UTF-8 match
+        // may cover a different number of bytes than the needle, the other encodings fold unit for unit
+
+        template <typename CharT>
+        std::size_t find_ascii_folded(const CharT* haystack, std::size_t count, const CharT* needle, std::size_t needle_count, std::true_type) noexcept
+        {
+            return find_bytes_ascii_ci(as_bytes(haystack), count, as_bytes(needle), needle_count);
+        }
+
+        template <typename CharT>
+        std::size_t find_ascii_folded(const CharT* haystack, std::size_t count, const CharT* needle, std::size_t needle_count, std::false_type) noexcept
+        {
+            if (needle_count > count)
+                return find_npos;
+            for (std::size_t i = 0; i <= count - needle_count; ++i)
+                if (ascii_equal_ignore_case(haystack + i, needle, needle_count))
+                    return i;
+            return find_npos;
+        }
+
+        template <typename CharT>
+        std::size_t find_folded(const CharT* haystack, std::size_t count, const CharT* needle, std::size_t needle_count, utf8_encoding) noexcept
+        {
+            const char* str = as_bytes(haystack);
+            const char* pattern = as_bytes(needle);
+            if (needle_count == 0)
+                return 0;
+
+            // An ASCII needle free of 's' and 'k' can only match ASCII text, so ASCII folding is exact
+            std::size_t i = 0;
+            while (i < needle_count && static_cast<unsigned char>(pattern[i]) < 0x80 && !has_non_ascii_fold_partner(swe::ascii_to_lower(pattern[i])))
+                ++i;
+            if (i == needle_count)
+                return find_bytes_ascii_ci(str, count, pattern, needle_count);
+
+            // Otherwise a match starts at a byte that folds like the needle's first code point, or at a lead byte
+            // of a non-ASCII code point that may fold like it; candidates are verified code point by code point
+            const utf8_decoded first = utf8_decode(pattern, needle_count);
+            ci_filter ascii = no_byte_filter, lead = utf8_lead_filter;
+            if (!first.valid)
+            {
+                ascii = ci_filter{'\0', pattern[0]};
+                lead = no_byte_filter;
+            }
+            else
+            {
+                const std::uint32_t folded = fold_code_point(first.code_point);
+                if (folded < 0x80)
+                {
+                    ascii = ascii_ci_filter(static_cast<char>(folded));
+                    if (!has_non_ascii_fold_partner(static_cast<char>(folded)))
+                        lead = no_byte_filter;
+                }
+            }
+            for (i = 0; i < count; ++i)
+            {
+                const std::size_t offset = find_candidate(str + i, count - i, ascii, lead);
+                if (offset == find_npos)
+                    return find_npos;
+                i += offset;
+                if (utf8_match_folded(str + i, count - i, pattern, needle_count) != utf8_no_match)
+                    return i;
+            }
+            return find_npos;
+        }
+
+        template <typename CharT, typename Encoding>
+        std::size_t find_folded(const CharT* haystack, std::size_t count, const CharT* needle, std::size_t needle_count, Encoding encoding) noexcept
+        {
+            if (needle_count > count)
+                return find_npos;
+            for (std::size_t i = 0; i <= count - needle_count; ++i)
+                if (equal_folded(haystack + i, needle, needle_count, encoding))
+                    return i;
+            return find_npos;
+        }
+
+        template <typename CharT, typename Traits>
+        std::size_t find_chars(basic_string_view<CharT, Traits> str, basic_string_view<CharT, Traits> needle, std::size_t pos, string_compare_type compare_type)
+        {
+            if (pos > str.size())
+                return basic_string_view<CharT, Traits>::npos;
+            std::size_t found;
+            switch (compare_type)
+            {
+            case string_compare_type::ordinal_ignore_case:
+                found = find_folded(str.data() + pos, str.size() - pos, needle.data(), needle.size(), encoding_of<CharT>());
+                break;
+            case string_compare_type::ordinal_ignore_case_ascii:
+                found = find_ascii_folded(str.data() + pos, str.size() - pos, needle.data(), needle.size(), is_byte_string<CharT, Traits>());
+                break;
+            default:
+                return find_chars(str, needle, pos, is_byte_string<CharT, Traits>());
+            }
+            return found == find_npos ? basic_string_view<CharT, Traits>::npos : pos + found;
+        }
+
+        template <typename CharT, typename Traits, typename Alloc>
+        void trim_inplace(std::basic_string<CharT, Traits, Alloc>& str, const char_set_view<CharT, Traits>& whitespace, bool left, bool right)
+        {
+            const basic_string_view<CharT, Traits> trimmed = trim_view(basic_string_view<CharT, Traits>(str.data(), str.size()), whitespace, left, right);
+            const std::size_t begin = static_cast<std::size_t>(trimmed.data() - str.data());
+            str.erase(begin + trimmed.size());
+            str.erase(0, begin);
+        }
+
+        /**
+         * @brief Copies str into out with every occurrence of the searcher's needle replaced; out must be sized exactly.
+         */
+        template <typename CharT, typename Traits>
+        void replace_copy(basic_string_view<CharT, Traits> str, const basic_searcher<CharT, Traits>& from, basic_string_view<CharT, Traits> to, CharT* out)
+        {
+            std::size_t prev = 0;
+            from.for_each(str, [&](std::size_t pos) {
+                Traits::copy(out, str.data() + prev, pos - prev);
+                out += pos - prev;
+                Traits::copy(out, to.data(), to.size());
+                out += to.size();
+                prev = pos + from.needle().size();
+            });
+            Traits::copy(out, str.data() + prev, str.size() - prev);
+        }
+
+        template <typename CharT, typename Traits, typename Alloc>
+        std::basic_string<CharT, Traits, Alloc> replace(const std::basic_string<CharT, Traits, Alloc>& str, basic_string_view<CharT, Traits> from,
+                                                        basic_string_view<CharT, Traits> to)
+        {
+            if (from.empty())
+                return str;
+            // First pass sizes the output exactly, second pass fills it
+            const basic_searcher<CharT, Traits> searcher(from);
+            const basic_string_view<CharT, Traits> source(str.data(), str.size());
+            const std::size_t count = searcher.count(source);
+            std::basic_string<CharT, Traits, Alloc> result(str.size() - count * from.size() + count * to.size(), CharT(), str.get_allocator());
+            replace_copy(source, searcher, to, &result[0]);
+            return result;
+        }
+
+        /**
+         * @brief Whether view refers to characters stored in str.
+         */
+        template <typename CharT, typename Traits, typename Alloc>
+        bool overlaps(const std::basic_string<CharT, Traits, Alloc>& str, basic_string_view<CharT, Traits> view) noexcept
+        {
+            const std::less<const CharT*> before;
+            return !view.empty() && before(view.data(), str.data() + str.size()) && before(str.data(), view.data() + view.size());
+        }
+
+        template <typename CharT, typename Traits, typename Alloc>
+        void replace_inplace(std::basic_string<CharT, Traits, Alloc>& str, basic_string_view<CharT, Traits> from, basic_string_view<CharT, Traits> to)
+        {
+            if (from.empty())
+                return;
+            if (overlaps(str, from) || overlaps(str, to))
+            {
+                // The in-place paths would overwrite the pattern or replacement while still reading it
+                str = replace(str, from, to);
+                return;
+            }
+
+            const basic_searcher<CharT, Traits> searcher(from);
+            const basic_string_view<CharT, Traits> source(str.data(), str.size());
+            if (to.size() == from.size())
+            {
+                // Same length: overwrite each match where it stands
+                searcher.for_each(source, [&](std::size_t pos) { Traits::copy(&str[pos], to.data(), to.size()); });
+            }
+            else if (to.size() < from.size())
+            {
+                // Shrinking: the write position never overtakes the read position, so compact forward
+                std::size_t out = 0, prev = 0;
+                searcher.for_each(source, [&](std::size_t pos) {
+                    Traits::move(&str[out], &str[prev], pos - prev);
+                    out += pos - prev;
+                    Traits::copy(&str[out], to.data(), to.size());
+                    out += to.size();
+                    prev = pos + from.size();
+                });
+                Traits::move(&str[out], &str[prev], str.size() - prev);
+                str.resize(out + str.size() - prev);
+            }
+            else
+            {
+                // Growing: build the result once at its exact size and take it over
+                const std::size_t count = searcher.count(source);
+                if (count == 0)
+                    return;
+                std::basic_string<CharT, Traits, Alloc> result(str.size() + count * (to.size() - from.size()), CharT(), str.get_allocator());
+                replace_copy(source, searcher, to, &result[0]);
+                str.swap(result);
+            }
+        }
+
+        /**
+         * @brief Writes the slug of UTF-8 text to dst, which may equal src, and returns its length, which
+         * never exceeds count. Letters and digits are located 32 bytes at a time with the classification
+         * kernels and copied in lower-cased runs; every other run becomes a single separator.
+         */
+        inline std::size_t slug_bytes(const char* src, std::size_t count, char* dst, char separator, bool transliterate) noexcept
+        {
+            std::size_t out = 0;
+            bool last_was_sep = true;
+            std::size_t i = 0;
+            while (i < count)
+            {
+                const std::size_t block = std::min(count - i, char_class_block);
+                const std::uint32_t alnum = classify_chars(src + i, block).alnum;
+                std::size_t j = 0;
+                while (j < block)
+                {
+                    const std::uint32_t rest = alnum >> j;
+                    if (rest & 1)
+                    {
+                        const std::size_t run = ~rest ? std::min<std::size_t>(count_trailing_zeros(~rest), block - j) : block - j;
+                        ascii_to_lower(dst + out, src + i + j, run);
+                        out += run;
+                        j += run;
+                        last_was_sep = false;
+                        continue;
+                    }
+
+                    const std::size_t end = rest ? j + count_trailing_zeros(rest) : block;
+                    if (!transliterate)
+                    {
+                        if (!last_was_sep)
+                            dst[out++] = separator;
+                        last_was_sep = true;
+                        j = end;
+                        continue;
+                    }
+
+                    // Every transliterated letter is encoded in two bytes and spelled with at most two, so dst
+                    // never overtakes src. A sequence running past the block moves the next block along
+                    while (j < end)
+                    {
+                        const utf8_decoded decoded = utf8_decode(src + i + j, count - i - j);
+                        const char* spelling = decoded.valid ? latin_transliteration(decoded.code_point) : nullptr;
+                        if (spelling && *spelling)
+                        {
+                            while (*spelling)
+                                dst[out++] = *spelling++;
+                            last_was_sep = false;
+                        }
+                        else if (!last_was_sep)
+                        {
+                            dst[out++] = separator;
+                            last_was_sep = true;
+                        }
+                        j += decoded.length;
+                    }
+                }
+                i += j;
+            }
+            // Remove trailing separator
+            if (out > 0 && dst[out - 1] == separator)
+                --out;
+            return out;
+        }
+
+        /**
+         * @brief Writes the slug of src to dst and returns its length. dst may equal src when no transliterated
+         * character is spelled with two letters.
+         */
+        template <typename CharT, typename Traits>
+        std::size_t slug_chars(const CharT* src, std::size_t count, CharT* dst, CharT separator, bool transliterate)
+        {
+            std::size_t out = 0;
+            bool last_was_sep = true;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const CharT c = src[i];
+                const char* spelling = transliterate ? latin_transliteration(static_cast<std::uint32_t>(c)) : nullptr;
+                if (spelling ? *spelling != '\0' : char_is_alnum(c))
+                {
+                    if (spelling)
+                        while (*spelling)
+                            dst[out++] = static_cast<CharT>(*spelling++);
+                    else
+                        dst[out++] = char_to_lower(c);
+                    last_was_sep = false;
+                }
+                else if (!last_was_sep)
+                {
+                    dst[out++] = separator;
+                    last_was_sep = true;
+                }
+            }
+            // Remove trailing separator
+            if (out > 0 && Traits::eq(dst[out - 1], separator))
+                --out;
+            return out;
+        }
+
+        template <typename CharT, typename Traits, typename Alloc>
+        void to_slug_inplace(std::basic_string<CharT, Traits, Alloc>& str, CharT separator, string_slug_transliteration transliteration, utf8_encoding)
+        {
+            if (!str.empty())
+                str.resize(slug_bytes(as_bytes(str.data()), str.size(), as_writable_bytes(&str[0]), static_cast<char>(separator),
+                                      transliteration == string_slug_transliteration::latin));
+        }
+
+        template <typename CharT, typename Traits, typename Alloc, typename Encoding>
+        void to_slug_inplace(std::basic_string<CharT, Traits, Alloc>& str, CharT separator, string_slug_transliteration transliteration, Encoding)
+        {
+            const bool transliterate = transliteration == string_slug_transliteration::latin;
+            std::size_t growth = 0;
+            if (transliterate)
+            {
+                for (const CharT c : str)
+                {
+                    const char* spelling = latin_transliteration(static_cast<std::uint32_t>(c));
+                    growth += spelling && spelling[0] && spelling[1] ? 1 : 0;
+                }
+            }
+            if (growth == 0)
+            {
+                if (!str.empty())
+                    str.resize(slug_chars<CharT, Traits>(str.data(), str.size(), &str[0], separator, transliterate));
+                return;
+            }
+
+            // Two-letter spellings could overtake the input, so the slug is written to one buffer sized for the worst case
+            std::basic_string<CharT, Traits, Alloc> result(str.size() + growth, CharT(), str.get_allocator());
+            result.resize(slug_chars<CharT, Traits>(str.data(), str.size(), &result[0], separator, transliterate));
+            str.swap(result);
+        }
+
+        /**
+         * @brief Turns str into a slug where it stands. Without two-letter transliterations the slug is never longer than its input.
+         */
+        template <typename CharT, typename Traits, typename Alloc>
+        void to_slug_inplace(std::basic_string<CharT, Traits, Alloc>& str, CharT separator, string_slug_transliteration transliteration)
+        {
+            to_slug_inplace(str, separator, transliteration, encoding_of<CharT>());
+        }
+
+        /**
+         * @brief Slug of a UTF-8 string, written straight into one buffer of the input's size instead of copying and then compacting.
+         */
+        template <typename CharT, typename Traits, typename Alloc>
+        std::basic_string<CharT, Traits, Alloc> to_slug(const std::basic_string<CharT, Traits, Alloc>& str, CharT separator,
+                                                         string_slug_transliteration transliteration, utf8_encoding)
+        {
+            std::basic_string<CharT, Traits, Alloc> result(str.size(), CharT(), str.get_allocator());
+            if (!str.empty())
+                result.resize(slug_bytes(as_bytes(str.data()), str.size(), as_writable_bytes(&result[0]), static_cast<char>(separator),
+                                         transliteration == string_slug_transliteration::latin));
+            return result;
+        }
+
+        template <typename CharT, typename Traits, typename Alloc, typename Encoding>
+        std::basic_string<CharT, Traits, Alloc> to_slug(const std::basic_string<CharT, Traits, Alloc>& str, CharT separator,
+                                                         string_slug_transliteration transliteration, Encoding encoding)
+        {
+            std::basic_string<CharT, Traits, Alloc> result(str);
+            to_slug_inplace(result, separator, transliteration, encoding);
+            return result;
+        }
+
+        // Byte strings are XORed with the SIMD kernels, wider ones one character at a time
+
+        template <typename CharT, typename Traits, typename Alloc>
+        void obfuscate_inplace(std::basic_string<CharT, Traits, Alloc>& str, basic_string_view<CharT, Traits> key, std::true_type) noexcept
+        {
+            if (!str.empty())
+                xor_bytes(reinterpret_cast<unsigned char*>(&str[0]), str.size(), reinterpret_cast<const unsigned char*>(key.data()), key.size());
+        }
+
+        template <typename CharT, typename Traits, typename Alloc>
+        void obfuscate_inplace(std::basic_string<CharT, Traits, Alloc>& str, basic_string_view<CharT, Traits> key, std::false_type) noexcept
+        {
+            if (key.empty())
+                return;
+            std::size_t k = 0;
+            for (CharT& c : str)
+            {
+                c = static_cast<CharT>(c ^ key[k]);
+                if (++k == key.size())
+                    k = 0;
+            }
+        }
+
+        template <typename CharT, typename Traits, typename Alloc>
+        void obfuscate_inplace(std::basic_string<CharT, Traits, Alloc>& str, basic_string_view<CharT, Traits> key) noexcept
+        {
+            obfuscate_inplace(str, key, is_byte_string<CharT, Traits>());
+        }
+    } // namespace detail
+} // namespace swe
\ No newline at end of file
@@ -0,0 +1,56 @@
+/**
+ * @file string_options.ipp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Definitions of the string_split_options operators declared in string_options.hpp.
+ *
+ * Compiled into the swe library by src/, or included by string_options.hpp when SWE_HEADER_ONLY is defined.
+ * It is an implementation detail and should not be included directly by user code.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "../string_options.hpp"
+
+namespace swe
+{
+    SWE_DECL string_split_options operator|(string_split_options lhs, string_split_options rhs)
+    {
+        return static_cast<string_split_options>(static_cast<int>(lhs) | static_cast<int>(rhs));
+    }
+
+    SWE_DECL string_split_options operator&(string_split_options lhs, string_split_options rhs)
+    {
+        return static_cast<string_split_options>(static_cast<int>(lhs) & static_cast<int>(rhs));
+    }
+
+    SWE_DECL string_split_options operator^(string_split_options lhs, string_split_options rhs)
+    {
+        return static_cast<string_split_options>(static_cast<int>(lhs) ^ static_cast<int>(rhs));
+    }
+
+    SWE_DECL string_split_options operator~(string_split_options lhs)
+    {
+        return static_cast<string_split_options>(~static_cast<int>(lhs));
+    }
+
+    SWE_DECL string_split_options& operator|=(string_split_options& lhs, string_split_options rhs)
+    {
+        lhs = lhs | rhs;
+        return lhs;
+    }
+
+    SWE_DECL string_split_options& operator&=(string_split_options& lhs, string_split_options rhs)
+    {
+        lhs = lhs & rhs;
+        return lhs;
+    }
+
+    SWE_DECL string_split_options& operator^=(string_split_options& lhs, string_split_options rhs)
+    {
+        lhs = lhs ^ rhs;
+        return lhs;
+    }
+} // namespace swe
\ No newline at end of file
@@ -0,0 +1,57 @@
+/**
+ * @file swe.ipp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Definitions of the version query functions declared in swe.hpp.
+ *
+ * Compiled into the swe library by src/, or included by swe.hpp when SWE_HEADER_ONLY is defined.
+ * It is an implementation detail and should not be included directly by user code.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "../swe.hpp"
+
+namespace swe
+{
+    SWE_DECL std::string get_version()
+    {
+        return std::to_string(SWE_VERSION_MAJOR) + "." + std::to_string(SWE_VERSION_MINOR) + "." + std::to_string(SWE_VERSION_PATCH);
+    }
+
+    SWE_DECL std::wstring get_wversion()
+    {
+        return std::to_wstring(SWE_VERSION_MAJOR) + L"." + std::to_wstring(SWE_VERSION_MINOR) + L"." + std::to_wstring(SWE_VERSION_PATCH);
+    }
+
+    SWE_DECL void get_version(int* major, int* minor, int* patch)
+    {
+        if (major)
+        {
+            *major = SWE_VERSION_MAJOR;
+        }
+
+        if (minor)
+        {
+            *minor = SWE_VERSION_MINOR;
+        }
+
+        if (patch)
+        {
+            *patch = SWE_VERSION_PATCH;
+        }
+    }
+
+    SWE_DECL int get_version_number()
+    {
+        return SWE_VERSION;
+    }
+
+    SWE_DECL bool check_version(int major, int minor, int patch)
+    {
+        return (major == SWE_VERSION_MAJOR) && (minor == SWE_VERSION_MINOR) && (patch == SWE_VERSION_PATCH);
+    }
+
+} // namespace swe
\ No newline at end of file
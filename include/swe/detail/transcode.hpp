@@ -0,0 +1,1135 @@
+/**
+ * @file transcode.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief UTF-8 validation and UTF-8 <-> UTF-16/UTF-32 transcoding kernels for the SWE library.
+ *
+ * UTF-8 is validated 16, 32 or 64 bytes at a time with the lookup algorithm of Keiser and Lemire
+ * ("Validating UTF-8 In Less Than One Instruction Per Byte"): three byte shuffles classify every
+ * pair of adjacent bytes, and a pair is malformed when the three classifications share an error
+ * bit. Lengths of valid input are counted with SIMD from the lead and continuation bytes alone.
+ * While transcoding, runs of ASCII are widened or narrowed with SIMD. Valid UTF-8 of up to three
+ * bytes per sequence is decoded eight bytes per step, and blocks of eight UTF-16 or UTF-32 units
+ * that all encode to one or two bytes, or all to three, are encoded per step, both with byte
+ * shuffles. Everything else is converted one code point at a time.
+ *
+ * Malformed input is never rejected: each invalid UTF-8 byte and each unpaired surrogate or out of
+ * range UTF-32 value becomes one U+FFFD replacement character, and the length functions account
+ * for the replacements exactly. The best kernels for the running CPU are selected on first use.
+ * It is an implementation detail and should not be included directly by user code.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "bits.hpp"
+#include "config.hpp"
+#include "cpu.hpp"
+#include "utf8.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if SWE_HAS_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace swe
+{
+    namespace detail
+    {
+        /**
+         * @brief Code point written in place of malformed input.
+         */
+        static const std::uint32_t replacement_character = 0xFFFD;
+
+        /**
+         * @brief Signature shared by the UTF-8 validation kernels.
+         */
+        using utf8_validate_kernel = bool (*)(const char* data, std::size_t count);
+
+        inline bool utf8_validate_scalar(const char* data, std::size_t count) noexcept
+        {
+            for (std::size_t i = 0; i < count;)
+            {
+                if (static_cast<unsigned char>(data[i]) < 0x80)
+                {
+                    i += ascii_scan_scalar(data + i, count - i);
+                    continue;
+                }
+                const utf8_decoded decoded = utf8_decode(data + i, count - i);
+                if (!decoded.valid)
+                    return false;
+                i += decoded.length;
+            }
+            return true;
+        }
+
+#if SWE_HAS_X86_SIMD
+        // Error classes of a pair of adjacent bytes, indexed by the high nibble of the first byte, the
+        // low nibble of the first byte and the high nibble of the second byte. Bit 0: lead not followed
+        // by a continuation, 1: continuation without a lead, 2: overlong three-byte form, 3: above
+        // U+10FFFF, 4: surrogate, 5: overlong two-byte form, 6: overlong four-byte form or above
+        // U+10FFFF, 7: two continuations in a row, which is only valid two or three bytes after a lead.
+        static const std::uint8_t utf8_error_tables[3][16] = {
+            {0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x80, 0x80, 0x80, 0x80, 0x21, 0x01, 0x15, 0x49},
+            {0xE7, 0xA3, 0x83, 0x83, 0x8B, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xDB, 0xCB, 0xCB},
+            {0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xE6, 0xAE, 0xBA, 0xBA, 0x01, 0x01, 0x01, 0x01},
+        };
+
+        /**
+         * @brief Error bits of a 16-byte block given the block before it; all zero when the block is well formed.
+         */
+        SWE_TARGET("ssse3")
+        inline __m128i utf8_block_errors_ssse3(__m128i input, __m128i prev_input, __m128i byte_1_high, __m128i byte_1_low, __m128i byte_2_high) noexcept
+        {
+            const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+            const __m128i prev1 = _mm_alignr_epi8(input, prev_input, 15);
+            const __m128i special = _mm_and_si128(_mm_and_si128(_mm_shuffle_epi8(byte_1_high, _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble_mask)),
+                                                                _mm_shuffle_epi8(byte_1_low, _mm_and_si128(prev1, nibble_mask))),
+                                                  _mm_shuffle_epi8(byte_2_high, _mm_and_si128(_mm_srli_epi16(input, 4), nibble_mask)));
+            // The high bit is set two bytes after a three- or four-byte lead, or three bytes after a four-byte lead
+            const __m128i third = _mm_subs_epu8(_mm_alignr_epi8(input, prev_input, 14), _mm_set1_epi8(0xE0 - 0x80));
+            const __m128i fourth = _mm_subs_epu8(_mm_alignr_epi8(input, prev_input, 13), _mm_set1_epi8(0xF0 - 0x80));
+            const __m128i must_continue = _mm_and_si128(_mm_or_si128(third, fourth), _mm_set1_epi8(static_cast<char>(0x80)));
+            return _mm_xor_si128(must_continue, special);
+        }
+
+        SWE_TARGET("ssse3")
+        inline bool utf8_validate_ssse3(const char* data, std::size_t count) noexcept
+        {
+            const __m128i byte_1_high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_error_tables[0]));
+            const __m128i byte_1_low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_error_tables[1]));
+            const __m128i byte_2_high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_error_tables[2]));
+            __m128i error = _mm_setzero_si128(), prev_input = _mm_setzero_si128();
+            bool prev_ascii = true;
+            for (std::size_t i = 0; i < count; i += 16)
+            {
+                __m128i input;
+                if (count - i >= 16)
+                {
+                    input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                }
+                else
+                {
+                    // Zero padding is ASCII, so a sequence cut off by the end of the input is reported
+                    char block[16] = {0};
+                    std::memcpy(block, data + i, count - i);
+                    input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+                }
+                const bool ascii = _mm_movemask_epi8(input) == 0;
+                // An ASCII block only needs checking when the block before it may end inside a sequence
+                if (!ascii || !prev_ascii)
+                    error = _mm_or_si128(error, utf8_block_errors_ssse3(input, prev_input, byte_1_high, byte_1_low, byte_2_high));
+                prev_input = input;
+                prev_ascii = ascii;
+            }
+            if (!prev_ascii)
+                error = _mm_or_si128(error, utf8_block_errors_ssse3(_mm_setzero_si128(), prev_input, byte_1_high, byte_1_low, byte_2_high));
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) == 0xFFFF;
+        }
+
+        SWE_TARGET("avx2")
+        inline __m256i utf8_block_errors_avx2(__m256i input, __m256i prev_input, __m256i byte_1_high, __m256i byte_1_low, __m256i byte_2_high) noexcept
+        {
+            const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+            // Byte alignment works within each 128-bit lane, so the lane before each lane is built first
+            const __m256i shifted = _mm256_permute2x128_si256(prev_input, input, 0x21);
+            const __m256i prev1 = _mm256_alignr_epi8(input, shifted, 15);
+            const __m256i special =
+                _mm256_and_si256(_mm256_and_si256(_mm256_shuffle_epi8(byte_1_high, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble_mask)),
+                                                  _mm256_shuffle_epi8(byte_1_low, _mm256_and_si256(prev1, nibble_mask))),
+                                 _mm256_shuffle_epi8(byte_2_high, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble_mask)));
+            const __m256i third = _mm256_subs_epu8(_mm256_alignr_epi8(input, shifted, 14), _mm256_set1_epi8(0xE0 - 0x80));
+            const __m256i fourth = _mm256_subs_epu8(_mm256_alignr_epi8(input, shifted, 13), _mm256_set1_epi8(0xF0 - 0x80));
+            const __m256i must_continue = _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8(static_cast<char>(0x80)));
+            return _mm256_xor_si256(must_continue, special);
+        }
+
+        SWE_TARGET("avx2")
+        inline bool utf8_validate_avx2(const char* data, std::size_t count) noexcept
+        {
+            const __m256i byte_1_high = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_error_tables[0])));
+            const __m256i byte_1_low = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_error_tables[1])));
+            const __m256i byte_2_high = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_error_tables[2])));
+            __m256i error = _mm256_setzero_si256(), prev_input = _mm256_setzero_si256();
+            bool prev_ascii = true;
+            for (std::size_t i = 0; i < count; i += 32)
+            {
+                __m256i input;
+                if (count - i >= 32)
+                {
+                    input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                }
+                else
+                {
+                    char block[32] = {0};
+                    std::memcpy(block, data + i, count - i);
+                    input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+                }
+                const bool ascii = _mm256_movemask_epi8(input) == 0;
+                if (!ascii || !prev_ascii)
+                    error = _mm256_or_si256(error, utf8_block_errors_avx2(input, prev_input, byte_1_high, byte_1_low, byte_2_high));
+                prev_input = input;
+                prev_ascii = ascii;
+            }
+            if (!prev_ascii)
+                error = _mm256_or_si256(error, utf8_block_errors_avx2(_mm256_setzero_si256(), prev_input, byte_1_high, byte_1_low, byte_2_high));
+            return _mm256_testz_si256(error, error) != 0;
+        }
+
+        SWE_TARGET("avx512f,avx512bw")
+        inline __m512i utf8_block_errors_avx512bw(__m512i input, __m512i prev_input, __m512i byte_1_high, __m512i byte_1_low, __m512i byte_2_high) noexcept
+        {
+            const __m512i nibble_mask = _mm512_set1_epi8(0x0F);
+            const __m512i shifted = _mm512_permutex2var_epi64(prev_input, _mm512_set_epi64(13, 12, 11, 10, 9, 8, 7, 6), input);
+            const __m512i prev1 = _mm512_alignr_epi8(input, shifted, 15);
+            const __m512i special =
+                _mm512_and_si512(_mm512_and_si512(_mm512_shuffle_epi8(byte_1_high, _mm512_and_si512(_mm512_srli_epi16(prev1, 4), nibble_mask)),
+                                                  _mm512_shuffle_epi8(byte_1_low, _mm512_and_si512(prev1, nibble_mask))),
+                                 _mm512_shuffle_epi8(byte_2_high, _mm512_and_si512(_mm512_srli_epi16(input, 4), nibble_mask)));
+            const __m512i third = _mm512_subs_epu8(_mm512_alignr_epi8(input, shifted, 14), _mm512_set1_epi8(0xE0 - 0x80));
+            const __m512i fourth = _mm512_subs_epu8(_mm512_alignr_epi8(input, shifted, 13), _mm512_set1_epi8(0xF0 - 0x80));
+            const __m512i must_continue = _mm512_and_si512(_mm512_or_si512(third, fourth), _mm512_set1_epi8(static_cast<char>(0x80)));
+            return _mm512_xor_si512(must_continue, special);
+        }
+
+        SWE_TARGET("avx512f,avx512bw")
+        inline bool utf8_validate_avx512bw(const char* data, std::size_t count) noexcept
+        {
+            // A full zero mask keeps GCC from seeing the undefined source of the unmasked broadcast
+            const __m512i byte_1_high = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_error_tables[0])));
+            const __m512i byte_1_low = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_error_tables[1])));
+            const __m512i byte_2_high = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_error_tables[2])));
+            __m512i error = _mm512_setzero_si512(), prev_input = _mm512_setzero_si512();
+            bool prev_ascii = true;
+            for (std::size_t i = 0; i < count; i += 64)
+            {
+                // The final partial block is loaded under a mask, which zero fills it like the padding of the narrower kernels
+                const std::uint64_t valid = count - i >= 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << (count - i)) - 1;
+                const __m512i input = _mm512_maskz_loadu_epi8(valid, data + i);
+                const bool ascii = _mm512_movepi8_mask(input) == 0;
+                if (!ascii || !prev_ascii)
+                    error = _mm512_or_si512(error, utf8_block_errors_avx512bw(input, prev_input, byte_1_high, byte_1_low, byte_2_high));
+                prev_input = input;
+                prev_ascii = ascii;
+            }
+            if (!prev_ascii)
+                error = _mm512_or_si512(error, utf8_block_errors_avx512bw(_mm512_setzero_si512(), prev_input, byte_1_high, byte_1_low, byte_2_high));
+            return _mm512_test_epi8_mask(error, error) == 0;
+        }
+#endif
+
+        /**
+         * @brief Picks the widest UTF-8 validation kernel supported by the running CPU.
+         */
+        inline utf8_validate_kernel select_utf8_validate_kernel() noexcept
+        {
+#if SWE_HAS_X86_SIMD
+            const cpu_features& features = get_cpu_features();
+            if (features.avx512bw)
+                return &utf8_validate_avx512bw;
+            if (features.avx2)
+                return &utf8_validate_avx2;
+            if (features.ssse3)
+                return &utf8_validate_ssse3;
+#endif
+            return &utf8_validate_scalar;
+        }
+
+        /**
+         * @brief Returns the UTF-8 validation kernel, selected once on first use.
+         */
+        inline utf8_validate_kernel utf8_validate_dispatch() noexcept
+        {
+            static const utf8_validate_kernel kernel = select_utf8_validate_kernel();
+            return kernel;
+        }
+
+        /**
+         * @brief Checks whether [data, data + count) is well-formed UTF-8.
+         */
+        inline bool utf8_validate(const char* data, std::size_t count) noexcept
+        {
+            return utf8_validate_dispatch()(data, count);
+        }
+
+        /**
+         * @brief Signature shared by the UTF-8 counting kernels. For well-formed UTF-8, returns the
+         * number of code points, plus the number of four-byte sequences when utf16 is true, which
+         * together make the UTF-16 length.
+         */
+        using utf8_count_kernel = std::size_t (*)(const char* data, std::size_t count, bool utf16);
+
+        inline std::size_t utf8_count_scalar(const char* data, std::size_t count, bool utf16) noexcept
+        {
+            std::size_t result = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const unsigned char c = static_cast<unsigned char>(data[i]);
+                result += (c & 0xC0) != 0x80;
+                result += utf16 && c >= 0xF0;
+            }
+            return result;
+        }
+
+#if SWE_HAS_X86_SIMD
+        SWE_TARGET("sse2")
+        inline std::size_t utf8_count_sse2(const char* data, std::size_t count, bool utf16) noexcept
+        {
+            // As signed bytes continuations are -128 to -65 and four-byte leads are -16 to -1
+            const __m128i continuation_limit = _mm_set1_epi8(-64);
+            const __m128i four_byte_limit = _mm_set1_epi8(-17);
+            std::size_t result = 0, i = 0;
+            for (; i + 16 <= count; i += 16)
+            {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                result += 16 - popcount(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmplt_epi8(v, continuation_limit))));
+                if (utf16)
+                    result += popcount(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpgt_epi8(v, four_byte_limit), v))));
+            }
+            return result + utf8_count_scalar(data + i, count - i, utf16);
+        }
+
+        SWE_TARGET("avx2")
+        inline std::size_t utf8_count_avx2(const char* data, std::size_t count, bool utf16) noexcept
+        {
+            const __m256i continuation_limit = _mm256_set1_epi8(-64);
+            const __m256i four_byte_limit = _mm256_set1_epi8(-17);
+            std::size_t result = 0, i = 0;
+            for (; i + 32 <= count; i += 32)
+            {
+                const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                result += 32 - popcount(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(continuation_limit, v))));
+                if (utf16)
+                    result += popcount(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpgt_epi8(v, four_byte_limit), v))));
+            }
+            return result + utf8_count_scalar(data + i, count - i, utf16);
+        }
+
+        SWE_TARGET("avx512f,avx512bw")
+        inline std::size_t utf8_count_avx512bw(const char* data, std::size_t count, bool utf16) noexcept
+        {
+            const __m512i continuation_limit = _mm512_set1_epi8(-64);
+            const __m512i four_byte_limit = _mm512_set1_epi8(-16);
+            std::size_t result = 0;
+            for (std::size_t i = 0; i < count; i += 64)
+            {
+                const std::uint64_t valid = count - i >= 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << (count - i)) - 1;
+                const __m512i v = _mm512_maskz_loadu_epi8(valid, data + i);
+                result += popcount(static_cast<std::uint64_t>(_mm512_mask_cmpge_epi8_mask(valid, v, continuation_limit)));
+                if (utf16)
+                    result += popcount(static_cast<std::uint64_t>(_mm512_cmpge_epi8_mask(v, four_byte_limit) & _mm512_movepi8_mask(v)));
+            }
+            return result;
+        }
+#endif
+
+        /**
+         * @brief Picks the widest UTF-8 counting kernel supported by the running CPU.
+         */
+        inline utf8_count_kernel select_utf8_count_kernel() noexcept
+        {
+#if SWE_HAS_X86_SIMD
+            const cpu_features& features = get_cpu_features();
+            if (features.avx512bw)
+                return &utf8_count_avx512bw;
+            if (features.avx2)
+                return &utf8_count_avx2;
+            if (features.sse2)
+                return &utf8_count_sse2;
+#endif
+            return &utf8_count_scalar;
+        }
+
+        /**
+         * @brief Returns the UTF-8 counting kernel, selected once on first use.
+         */
+        inline utf8_count_kernel utf8_count_dispatch() noexcept
+        {
+            static const utf8_count_kernel kernel = select_utf8_count_kernel();
+            return kernel;
+        }
+
+        /**
+         * @brief Signature shared by the ASCII widening kernels. Converts the run of ASCII bytes at the
+         * start of src to 16- or 32-bit code units at out and returns its length.
+         */
+        template <typename Unit>
+        using widen_ascii_kernel = std::size_t (*)(const char* src, std::size_t count, Unit* out);
+
+        template <typename Unit>
+        inline std::size_t widen_ascii_scalar(const char* src, std::size_t count, Unit* out) noexcept
+        {
+            std::size_t i = 0;
+            for (; i < count && static_cast<unsigned char>(src[i]) < 0x80; ++i)
+                out[i] = static_cast<Unit>(src[i]);
+            return i;
+        }
+
+#if SWE_HAS_X86_SIMD
+        template <typename Unit>
+        SWE_TARGET("sse2")
+        inline std::size_t widen_ascii_sse2(const char* src, std::size_t count, Unit* out) noexcept
+        {
+            const __m128i zero = _mm_setzero_si128();
+            std::size_t i = 0;
+            for (; i + 16 <= count; i += 16)
+            {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                if (_mm_movemask_epi8(v))
+                    break;
+                const __m128i low = _mm_unpacklo_epi8(v, zero);
+                const __m128i high = _mm_unpackhi_epi8(v, zero);
+                __m128i* dst = reinterpret_cast<__m128i*>(out + i);
+                if (sizeof(Unit) == 2)
+                {
+                    _mm_storeu_si128(dst, low);
+                    _mm_storeu_si128(dst + 1, high);
+                }
+                else
+                {
+                    _mm_storeu_si128(dst, _mm_unpacklo_epi16(low, zero));
+                    _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(low, zero));
+                    _mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(high, zero));
+                    _mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(high, zero));
+                }
+            }
+            return i + widen_ascii_scalar(src + i, count - i, out + i);
+        }
+
+        template <typename Unit>
+        SWE_TARGET("avx2")
+        inline std::size_t widen_ascii_avx2(const char* src, std::size_t count, Unit* out) noexcept
+        {
+            std::size_t i = 0;
+            for (; i + 32 <= count; i += 32)
+            {
+                const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                if (_mm256_movemask_epi8(v))
+                    break;
+                __m256i* dst = reinterpret_cast<__m256i*>(out + i);
+                if (sizeof(Unit) == 2)
+                {
+                    _mm256_storeu_si256(dst, _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v)));
+                    _mm256_storeu_si256(dst + 1, _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1)));
+                }
+                else
+                {
+                    const __m128i low = _mm256_castsi256_si128(v);
+                    const __m128i high = _mm256_extracti128_si256(v, 1);
+                    _mm256_storeu_si256(dst, _mm256_cvtepu8_epi32(low));
+                    _mm256_storeu_si256(dst + 1, _mm256_cvtepu8_epi32(_mm_srli_si128(low, 8)));
+                    _mm256_storeu_si256(dst + 2, _mm256_cvtepu8_epi32(high));
+                    _mm256_storeu_si256(dst + 3, _mm256_cvtepu8_epi32(_mm_srli_si128(high, 8)));
+                }
+            }
+            return i + widen_ascii_scalar(src + i, count - i, out + i);
+        }
+#endif
+
+        /**
+         * @brief Picks the widest ASCII widening kernel supported by the running CPU.
+         */
+        template <typename Unit>
+        inline widen_ascii_kernel<Unit> select_widen_ascii_kernel() noexcept
+        {
+#if SWE_HAS_X86_SIMD
+            const cpu_features& features = get_cpu_features();
+            if (features.avx2)
+                return &widen_ascii_avx2<Unit>;
+            if (features.sse2)
+                return &widen_ascii_sse2<Unit>;
+#endif
+            return &widen_ascii_scalar<Unit>;
+        }
+
+        /**
+         * @brief Returns the ASCII widening kernel for Unit, selected once on first use.
+         */
+        template <typename Unit>
+        inline widen_ascii_kernel<Unit> widen_ascii_dispatch() noexcept
+        {
+            static const widen_ascii_kernel<Unit> kernel = select_widen_ascii_kernel<Unit>();
+            return kernel;
+        }
+
+        /**
+         * @brief Value of a 16- or 32-bit code unit, without sign extension of a signed wchar_t.
+         */
+        template <typename Unit>
+        inline std::uint32_t unit_value(Unit unit) noexcept
+        {
+            return sizeof(Unit) == 2 ? static_cast<std::uint16_t>(unit) : static_cast<std::uint32_t>(unit);
+        }
+
+        /**
+         * @brief Signature shared by the ASCII narrowing kernels. Converts the run of code units below
+         * 0x80 at the start of src to bytes at out and returns its length.
+         */
+        template <typename Unit>
+        using narrow_ascii_kernel = std::size_t (*)(const Unit* src, std::size_t count, char* out);
+
+        template <typename Unit>
+        inline std::size_t narrow_ascii_scalar(const Unit* src, std::size_t count, char* out) noexcept
+        {
+            std::size_t i = 0;
+            for (; i < count && unit_value(src[i]) < 0x80; ++i)
+                out[i] = static_cast<char>(src[i]);
+            return i;
+        }
+
+#if SWE_HAS_X86_SIMD
+        template <typename Unit>
+        SWE_TARGET("sse2")
+        inline std::size_t narrow_ascii_sse2(const Unit* src, std::size_t count, char* out) noexcept
+        {
+            const __m128i* data = reinterpret_cast<const __m128i*>(src);
+            std::size_t i = 0;
+            for (; i + 16 <= count; i += 16, data += 16 * sizeof(Unit) / 16)
+            {
+                __m128i packed;
+                if (sizeof(Unit) == 2)
+                {
+                    const __m128i a = _mm_loadu_si128(data), b = _mm_loadu_si128(data + 1);
+                    if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(a, b), _mm_set1_epi16(static_cast<short>(0xFF80))),
+                                                          _mm_setzero_si128())) != 0xFFFF)
+                        break;
+                    packed = _mm_packus_epi16(a, b);
+                }
+                else
+                {
+                    const __m128i a = _mm_loadu_si128(data), b = _mm_loadu_si128(data + 1);
+                    const __m128i c = _mm_loadu_si128(data + 2), d = _mm_loadu_si128(data + 3);
+                    const __m128i all = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+                    if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(all, _mm_set1_epi32(~0x7F)), _mm_setzero_si128())) != 0xFFFF)
+                        break;
+                    packed = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), packed);
+            }
+            return i + narrow_ascii_scalar(src + i, count - i, out + i);
+        }
+
+        template <typename Unit>
+        SWE_TARGET("avx2")
+        inline std::size_t narrow_ascii_avx2(const Unit* src, std::size_t count, char* out) noexcept
+        {
+            const __m256i* data = reinterpret_cast<const __m256i*>(src);
+            std::size_t i = 0;
+            for (; i + 32 <= count; i += 32, data += 32 * sizeof(Unit) / 32)
+            {
+                __m256i packed;
+                if (sizeof(Unit) == 2)
+                {
+                    const __m256i a = _mm256_loadu_si256(data), b = _mm256_loadu_si256(data + 1);
+                    const __m256i high = _mm256_and_si256(_mm256_or_si256(a, b), _mm256_set1_epi16(static_cast<short>(0xFF80)));
+                    if (!_mm256_testz_si256(high, high))
+                        break;
+                    // Packing works within each 128-bit lane, so the 64-bit halves are put back in order
+                    packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8);
+                }
+                else
+                {
+                    const __m256i a = _mm256_loadu_si256(data), b = _mm256_loadu_si256(data + 1);
+                    const __m256i c = _mm256_loadu_si256(data + 2), d = _mm256_loadu_si256(data + 3);
+                    const __m256i high = _mm256_and_si256(_mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d)), _mm256_set1_epi32(~0x7F));
+                    if (!_mm256_testz_si256(high, high))
+                        break;
+                    const __m256i words = _mm256_packus_epi16(_mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d));
+                    packed = _mm256_permutevar8x32_epi32(words, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+                }
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), packed);
+            }
+            return i + narrow_ascii_scalar(src + i, count - i, out + i);
+        }
+#endif
+
+        /**
+         * @brief Picks the widest ASCII narrowing kernel supported by the running CPU.
+         */
+        template <typename Unit>
+        inline narrow_ascii_kernel<Unit> select_narrow_ascii_kernel() noexcept
+        {
+#if SWE_HAS_X86_SIMD
+            const cpu_features& features = get_cpu_features();
+            if (features.avx2)
+                return &narrow_ascii_avx2<Unit>;
+            if (features.sse2)
+                return &narrow_ascii_sse2<Unit>;
+#endif
+            return &narrow_ascii_scalar<Unit>;
+        }
+
+        /**
+         * @brief Returns the ASCII narrowing kernel for Unit, selected once on first use.
+         */
+        template <typename Unit>
+        inline narrow_ascii_kernel<Unit> narrow_ascii_dispatch() noexcept
+        {
+            static const narrow_ascii_kernel<Unit> kernel = select_narrow_ascii_kernel<Unit>();
+            return kernel;
+        }
+
+        /**
+         * @brief Signature shared by the UTF-16 measuring kernels. Returns the UTF-8 length of data on
+         * the assumption that every surrogate is correctly paired, and sets has_surrogates when data
+         * contains any surrogate, in which case the assumption has to be checked.
+         */
+        template <typename Unit>
+        using utf16_measure_kernel = std::size_t (*)(const Unit* data, std::size_t count, bool& has_surrogates);
+
+        template <typename Unit>
+        inline std::size_t utf16_measure_scalar(const Unit* data, std::size_t count, bool& has_surrogates) noexcept
+        {
+            std::size_t result = 0, surrogates = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const std::uint32_t unit = unit_value(data[i]);
+                // A surrogate pair takes four bytes, two for each half
+                result += 1 + (unit >= 0x80) + (unit >= 0x800);
+                surrogates += (unit & 0xF800) == 0xD800;
+            }
+            has_surrogates = has_surrogates || surrogates != 0;
+            return result - surrogates;
+        }
+
+#if SWE_HAS_X86_SIMD
+        template <typename Unit>
+        SWE_TARGET("sse2")
+        inline std::size_t utf16_measure_sse2(const Unit* data, std::size_t count, bool& has_surrogates) noexcept
+        {
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i two_byte_mask = _mm_set1_epi16(static_cast<short>(0xFF80));
+            const __m128i three_byte_mask = _mm_set1_epi16(static_cast<short>(0xF800));
+            const __m128i surrogate = _mm_set1_epi16(static_cast<short>(0xD800));
+            std::size_t result = 0, surrogates = 0, i = 0;
+            for (; i + 8 <= count; i += 8)
+            {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                const __m128i high = _mm_and_si128(v, three_byte_mask);
+                // Every movemask bit is doubled because each code unit is two bytes
+                const unsigned one_byte = popcount(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, two_byte_mask), zero))));
+                const unsigned below_three = popcount(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi16(high, zero))));
+                result += 24 - (one_byte + below_three) / 2;
+                surrogates += popcount(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi16(high, surrogate)))) / 2;
+            }
+            has_surrogates = surrogates != 0;
+            return result - surrogates + utf16_measure_scalar(data + i, count - i, has_surrogates);
+        }
+
+        template <typename Unit>
+        SWE_TARGET("avx2")
+        inline std::size_t utf16_measure_avx2(const Unit* data, std::size_t count, bool& has_surrogates) noexcept
+        {
+            const __m256i zero = _mm256_setzero_si256();
+            const __m256i two_byte_mask = _mm256_set1_epi16(static_cast<short>(0xFF80));
+            const __m256i three_byte_mask = _mm256_set1_epi16(static_cast<short>(0xF800));
+            const __m256i surrogate = _mm256_set1_epi16(static_cast<short>(0xD800));
+            std::size_t result = 0, surrogates = 0, i = 0;
+            for (; i + 16 <= count; i += 16)
+            {
+                const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                const __m256i high = _mm256_and_si256(v, three_byte_mask);
+                const unsigned one_byte =
+                    popcount(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_and_si256(v, two_byte_mask), zero))));
+                const unsigned below_three = popcount(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(high, zero))));
+                result += 48 - (one_byte + below_three) / 2;
+                surrogates += popcount(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(high, surrogate)))) / 2;
+            }
+            has_surrogates = surrogates != 0;
+            return result - surrogates + utf16_measure_scalar(data + i, count - i, has_surrogates);
+        }
+#endif
+
+        /**
+         * @brief Picks the widest UTF-16 measuring kernel supported by the running CPU.
+         */
+        template <typename Unit>
+        inline utf16_measure_kernel<Unit> select_utf16_measure_kernel() noexcept
+        {
+#if SWE_HAS_X86_SIMD
+            const cpu_features& features = get_cpu_features();
+            if (features.avx2)
+                return &utf16_measure_avx2<Unit>;
+            if (features.sse2)
+                return &utf16_measure_sse2<Unit>;
+#endif
+            return &utf16_measure_scalar<Unit>;
+        }
+
+        /**
+         * @brief Returns the UTF-16 measuring kernel for Unit, selected once on first use.
+         */
+        template <typename Unit>
+        inline utf16_measure_kernel<Unit> utf16_measure_dispatch() noexcept
+        {
+            static const utf16_measure_kernel<Unit> kernel = select_utf16_measure_kernel<Unit>();
+            return kernel;
+        }
+
+        /**
+         * @brief Decodes the code point at the start of [data, data + count), which holds UTF-16 when
+         * Unit is two bytes and UTF-32 otherwise. count must not be 0. An unpaired surrogate or a value
+         * above U+10FFFF decodes as one invalid unit.
+         */
+        template <typename Unit>
+        inline utf8_decoded units_decode(const Unit* data, std::size_t count) noexcept
+        {
+            const std::uint32_t unit = unit_value(data[0]);
+            if (sizeof(Unit) == 2 && unit >= 0xD800 && unit <= 0xDBFF && count > 1)
+            {
+                const std::uint32_t next = unit_value(data[1]);
+                if (next >= 0xDC00 && next <= 0xDFFF)
+                {
+                    const utf8_decoded result = {0x10000 + ((unit - 0xD800) << 10) + (next - 0xDC00), 2, true};
+                    return result;
+                }
+            }
+            const utf8_decoded result = {unit, 1, unit <= 0x10FFFF && (unit < 0xD800 || unit > 0xDFFF)};
+            return result;
+        }
+
+        /**
+         * @brief Checks whether [data, data + count) is well-formed UTF-16 or UTF-32, depending on the size of Unit.
+         */
+        template <typename Unit>
+        inline bool units_validate(const Unit* data, std::size_t count) noexcept
+        {
+            for (std::size_t i = 0; i < count;)
+            {
+                const utf8_decoded decoded = units_decode(data + i, count - i);
+                if (!decoded.valid)
+                    return false;
+                i += decoded.length;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Number of UTF-16 (two-byte Unit) or UTF-32 code units that utf8_to_units writes for [src, src + count).
+         */
+        template <typename Unit>
+        inline std::size_t utf8_units_length(const char* src, std::size_t count) noexcept
+        {
+            const bool utf16 = sizeof(Unit) == 2;
+            if (utf8_validate(src, count))
+                return utf8_count_dispatch()(src, count, utf16);
+            std::size_t result = 0;
+            for (std::size_t i = 0; i < count;)
+            {
+                const unsigned char c = static_cast<unsigned char>(src[i]);
+                if (c < 0x80)
+                {
+                    const std::size_t run = ascii_prefix_length(src + i, count - i);
+                    result += run;
+                    i += run;
+                    continue;
+                }
+                const utf8_decoded decoded = utf8_decode(src + i, count - i);
+                result += utf16 && decoded.valid && decoded.code_point >= 0x10000 ? 2 : 1;
+                i += decoded.length;
+            }
+            return result;
+        }
+
+        /**
+         * @brief Encodes a code point as one UTF-32 unit, or as one or two UTF-16 units when Unit is two bytes.
+         * @return The number of units written.
+         */
+        template <typename Unit>
+        inline std::size_t units_encode(std::uint32_t cp, Unit* out) noexcept
+        {
+            if (sizeof(Unit) == 2 && cp >= 0x10000)
+            {
+                cp -= 0x10000;
+                out[0] = static_cast<Unit>(0xD800 + (cp >> 10));
+                out[1] = static_cast<Unit>(0xDC00 + (cp & 0x3FF));
+                return 2;
+            }
+            out[0] = static_cast<Unit>(cp);
+            return 1;
+        }
+
+        /**
+         * @brief Signature shared by the UTF-8 to UTF-16 (two-byte Unit) or UTF-32 transcoding kernels.
+         * out must have room for utf8_units_length<Unit>(src, count) units. Returns the number of units written.
+         */
+        template <typename Unit>
+        using utf8_to_units_kernel = std::size_t (*)(const char* src, std::size_t count, Unit* out);
+
+        template <typename Unit>
+        inline std::size_t utf8_to_units_scalar(const char* src, std::size_t count, Unit* out) noexcept
+        {
+            const widen_ascii_kernel<Unit> widen = widen_ascii_dispatch<Unit>();
+            std::size_t i = 0, written = 0;
+            while (i < count)
+            {
+                if (static_cast<unsigned char>(src[i]) < 0x80)
+                {
+                    // Short runs between words of non-ASCII text are not worth a kernel call
+                    std::uint64_t word;
+                    if (count - i >= 8 && (std::memcpy(&word, src + i, 8), (word & 0x8080808080808080ull) == 0))
+                    {
+                        const std::size_t run = widen(src + i, count - i, out + written);
+                        i += run;
+                        written += run;
+                    }
+                    else
+                    {
+                        out[written++] = static_cast<Unit>(src[i++]);
+                    }
+                    continue;
+                }
+                const utf8_decoded decoded = utf8_decode(src + i, count - i);
+                written += units_encode(decoded.valid ? decoded.code_point : replacement_character, out + written);
+                i += decoded.length;
+            }
+            return written;
+        }
+
+        /**
+         * @brief Signature shared by the UTF-16 (two-byte Unit) or UTF-32 to UTF-8 transcoding kernels.
+         * out must have room for units_utf8_length(src, count) bytes. Returns the number of bytes written.
+         */
+        template <typename Unit>
+        using units_to_utf8_kernel = std::size_t (*)(const Unit* src, std::size_t count, char* out);
+
+        template <typename Unit>
+        inline std::size_t units_to_utf8_scalar(const Unit* src, std::size_t count, char* out) noexcept
+        {
+            const narrow_ascii_kernel<Unit> narrow = narrow_ascii_dispatch<Unit>();
+            std::size_t i = 0, written = 0;
+            while (i < count)
+            {
+                if (unit_value(src[i]) < 0x80)
+                {
+                    if (count - i >= 4 && unit_value(src[i + 1]) < 0x80 && unit_value(src[i + 2]) < 0x80 && unit_value(src[i + 3]) < 0x80)
+                    {
+                        const std::size_t run = narrow(src + i, count - i, out + written);
+                        i += run;
+                        written += run;
+                    }
+                    else
+                    {
+                        out[written++] = static_cast<char>(src[i++]);
+                    }
+                    continue;
+                }
+                const utf8_decoded decoded = units_decode(src + i, count - i);
+                const std::uint32_t cp = decoded.valid ? decoded.code_point : replacement_character;
+                i += decoded.length;
+                utf8_encode(cp, out + written);
+                written += utf8_length(cp);
+            }
+            return written;
+        }
+
+#if SWE_HAS_X86_SIMD
+        /**
+         * @brief Byte shuffles that move eight 16-bit lanes between code point and UTF-8 layouts.
+         */
+        struct transcode_shuffles
+        {
+            std::uint8_t compact[256][16];  ///< Packs the lanes whose bit is set in the index to the front.
+            std::uint8_t expand[256][16];   ///< Keeps the low byte of every lane, and the high byte of the lanes whose bit is set.
+            std::uint8_t three_byte[4][16]; ///< Interleave the lead, middle and last byte vectors of eight three-byte sequences.
+            std::uint8_t bits[256];         ///< Number of set bits of the index, since SSSE3 does not imply POPCNT.
+
+            transcode_shuffles() noexcept
+            {
+                const std::uint8_t none = 0x80;
+                for (unsigned mask = 0; mask < 256; ++mask)
+                {
+                    unsigned packed = 0, expanded = 0;
+                    for (unsigned lane = 0; lane < 8; ++lane)
+                    {
+                        expand[mask][expanded++] = static_cast<std::uint8_t>(2 * lane);
+                        if (mask & (1u << lane))
+                        {
+                            compact[mask][packed++] = static_cast<std::uint8_t>(2 * lane);
+                            compact[mask][packed++] = static_cast<std::uint8_t>(2 * lane + 1);
+                            expand[mask][expanded++] = static_cast<std::uint8_t>(2 * lane + 1);
+                        }
+                    }
+                    bits[mask] = static_cast<std::uint8_t>(packed / 2);
+                    while (packed < 16)
+                        compact[mask][packed++] = none;
+                    while (expanded < 16)
+                        expand[mask][expanded++] = none;
+                }
+                // Output byte j is byte j % 3 of sequence j / 3. Rows 0 and 1 select from the lead and middle
+                // bytes (lead bytes at 0-7, middle bytes at 8-15) and the last bytes for output bytes 0-15,
+                // rows 2 and 3 the same for output bytes 16-23.
+                for (unsigned j = 0; j < 24; ++j)
+                {
+                    const unsigned sequence = j / 3, part = j % 3;
+                    std::uint8_t* from_leads = three_byte[j < 16 ? 0 : 2];
+                    std::uint8_t* from_lasts = three_byte[j < 16 ? 1 : 3];
+                    from_leads[j % 16] = part == 2 ? none : static_cast<std::uint8_t>(part * 8 + sequence);
+                    from_lasts[j % 16] = part == 2 ? static_cast<std::uint8_t>(sequence) : none;
+                }
+                for (unsigned j = 8; j < 16; ++j)
+                    three_byte[2][j] = three_byte[3][j] = none;
+            }
+        };
+
+        /**
+         * @brief Returns the shuffle tables, built once on first use.
+         */
+        inline const transcode_shuffles& get_transcode_shuffles() noexcept
+        {
+            static const transcode_shuffles shuffles;
+            return shuffles;
+        }
+
+        template <typename Unit>
+        SWE_TARGET("ssse3")
+        inline std::size_t utf8_to_units_ssse3(const char* src, std::size_t count, Unit* out) noexcept
+        {
+            // The vector steps below rely on well-formed input; anything else takes the replacing scalar path
+            if (count < 48 || !utf8_validate(src, count))
+                return utf8_to_units_scalar(src, count, out);
+            const transcode_shuffles& shuffles = get_transcode_shuffles();
+            const widen_ascii_kernel<Unit> widen = widen_ascii_dispatch<Unit>();
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i low_six = _mm_set1_epi16(0x3F);
+            std::size_t i = 0, written = 0;
+            // A step stores eight units but may produce just one; the 40 bytes after it always produce the rest
+            while (count - i >= 48)
+            {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                if (_mm_movemask_epi8(v) == 0)
+                {
+                    const std::size_t run = widen(src + i, count - i, out + written);
+                    i += run;
+                    written += run;
+                    continue;
+                }
+                const std::uint32_t continuations = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmplt_epi8(v, _mm_set1_epi8(-64))));
+                const std::uint32_t four_byte_leads =
+                    static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(-17)), v)));
+                if ((four_byte_leads & 0xFF) == 0)
+                {
+                    // Decode a sequence at each of the first eight bytes as if it started there, then keep
+                    // the lanes of the bytes that really start one
+                    const __m128i b0 = _mm_unpacklo_epi8(v, zero);
+                    const __m128i b1 = _mm_and_si128(_mm_unpacklo_epi8(_mm_srli_si128(v, 1), zero), low_six);
+                    const __m128i b2 = _mm_and_si128(_mm_unpacklo_epi8(_mm_srli_si128(v, 2), zero), low_six);
+                    const __m128i two = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(b0, _mm_set1_epi16(0x1F)), 6), b1);
+                    const __m128i three = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(b0, 12), _mm_slli_epi16(b1, 6)), b2);
+                    const __m128i is_two = _mm_cmpgt_epi16(b0, _mm_set1_epi16(0xBF));
+                    const __m128i is_three = _mm_cmpgt_epi16(b0, _mm_set1_epi16(0xDF));
+                    __m128i code_points = _mm_or_si128(_mm_andnot_si128(is_two, b0), _mm_and_si128(is_two, two));
+                    code_points = _mm_or_si128(_mm_andnot_si128(is_three, code_points), _mm_and_si128(is_three, three));
+                    const std::uint32_t starts = ~continuations & 0xFF;
+                    const __m128i packed =
+                        _mm_shuffle_epi8(code_points, _mm_loadu_si128(reinterpret_cast<const __m128i*>(shuffles.compact[starts])));
+                    __m128i* dst = reinterpret_cast<__m128i*>(out + written);
+                    if (sizeof(Unit) == 2)
+                    {
+                        _mm_storeu_si128(dst, packed);
+                    }
+                    else
+                    {
+                        _mm_storeu_si128(dst, _mm_unpacklo_epi16(packed, zero));
+                        _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(packed, zero));
+                    }
+                    written += shuffles.bits[starts];
+                    i += 8;
+                    continue;
+                }
+                // Four-byte sequences are decoded one at a time, from the first sequence that starts at or after i
+                while ((static_cast<unsigned char>(src[i]) & 0xC0) == 0x80)
+                    ++i;
+                const utf8_decoded decoded = utf8_decode(src + i, count - i);
+                written += units_encode(decoded.code_point, out + written);
+                i += decoded.length;
+            }
+            while (i < count && (static_cast<unsigned char>(src[i]) & 0xC0) == 0x80)
+                ++i;
+            return written + utf8_to_units_scalar(src + i, count - i, out + written);
+        }
+
+        template <typename Unit>
+        SWE_TARGET("ssse3")
+        inline std::size_t units_to_utf8_ssse3(const Unit* src, std::size_t count, char* out) noexcept
+        {
+            const transcode_shuffles& shuffles = get_transcode_shuffles();
+            const narrow_ascii_kernel<Unit> narrow = narrow_ascii_dispatch<Unit>();
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i low_six = _mm_set1_epi16(0x3F);
+            const __m128i continuation = _mm_set1_epi16(0x80);
+            const __m128i three_byte_mask = _mm_set1_epi16(static_cast<short>(0xF800));
+            std::size_t i = 0, written = 0;
+            // Every remaining code unit produces at least one byte, so 16 units leave room for a 16-byte store
+            while (count - i >= 16)
+            {
+                __m128i units;
+                if (sizeof(Unit) == 2)
+                {
+                    units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                }
+                else
+                {
+                    const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                    const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 4));
+                    const __m128i high = _mm_and_si128(_mm_or_si128(a, b), _mm_set1_epi32(static_cast<int>(0xFFFF0000u)));
+                    if (_mm_movemask_epi8(_mm_cmpeq_epi32(high, zero)) == 0xFFFF)
+                    {
+                        const __m128i low_halves = _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -128, -128, -128, -128, -128, -128, -128, -128);
+                        units = _mm_unpacklo_epi64(_mm_shuffle_epi8(a, low_halves), _mm_shuffle_epi8(b, low_halves));
+                    }
+                    else
+                    {
+                        // A code point above U+FFFF (or an invalid value), converted on its own below
+                        units = _mm_set1_epi16(static_cast<short>(0xD800));
+                    }
+                }
+                const __m128i ascii = _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xFF80))), zero);
+                const __m128i high = _mm_and_si128(units, three_byte_mask);
+                const __m128i below_three = _mm_cmpeq_epi16(high, zero);
+                const std::uint32_t ascii_mask = static_cast<std::uint32_t>(_mm_movemask_epi8(ascii));
+                const std::uint32_t below_three_mask = static_cast<std::uint32_t>(_mm_movemask_epi8(below_three));
+                if (ascii_mask == 0xFFFF)
+                {
+                    const std::size_t run = narrow(src + i, count - i, out + written);
+                    i += run;
+                    written += run;
+                    continue;
+                }
+                if (below_three_mask == 0xFFFF)
+                {
+                    // One- and two-byte sequences: each lane holds its sequence, lead byte first
+                    const __m128i leads = _mm_or_si128(_mm_srli_epi16(units, 6), _mm_set1_epi16(0xC0));
+                    const __m128i two = _mm_or_si128(leads, _mm_slli_epi16(_mm_or_si128(_mm_and_si128(units, low_six), continuation), 8));
+                    const __m128i lanes = _mm_or_si128(_mm_and_si128(ascii, units), _mm_andnot_si128(ascii, two));
+                    const std::uint32_t two_byte = ~static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(ascii, ascii))) & 0xFF;
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + written),
+                                     _mm_shuffle_epi8(lanes, _mm_loadu_si128(reinterpret_cast<const __m128i*>(shuffles.expand[two_byte]))));
+                    written += 8 + shuffles.bits[two_byte];
+                    i += 8;
+                    continue;
+                }
+                if (below_three_mask == 0 && _mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_set1_epi16(static_cast<short>(0xD800)))) == 0)
+                {
+                    // Eight three-byte sequences
+                    const __m128i leads = _mm_or_si128(_mm_srli_epi16(units, 12), _mm_set1_epi16(0xE0));
+                    const __m128i middles = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(units, 6), low_six), continuation);
+                    const __m128i lasts = _mm_or_si128(_mm_and_si128(units, low_six), continuation);
+                    const __m128i leads_middles = _mm_packus_epi16(leads, middles);
+                    const __m128i lasts_packed = _mm_packus_epi16(lasts, lasts);
+                    const __m128i* table = reinterpret_cast<const __m128i*>(shuffles.three_byte);
+                    const __m128i first = _mm_or_si128(_mm_shuffle_epi8(leads_middles, _mm_loadu_si128(table)),
+                                                       _mm_shuffle_epi8(lasts_packed, _mm_loadu_si128(table + 1)));
+                    const __m128i second = _mm_or_si128(_mm_shuffle_epi8(leads_middles, _mm_loadu_si128(table + 2)),
+                                                        _mm_shuffle_epi8(lasts_packed, _mm_loadu_si128(table + 3)));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + written), first);
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(out + written + 16), second);
+                    written += 24;
+                    i += 8;
+                    continue;
+                }
+                // Mixed lengths or surrogates: one code point at a time
+                const utf8_decoded decoded = units_decode(src + i, count - i);
+                const std::uint32_t cp = decoded.valid ? decoded.code_point : replacement_character;
+                utf8_encode(cp, out + written);
+                written += utf8_length(cp);
+                i += decoded.length;
+            }
+            return written + units_to_utf8_scalar(src + i, count - i, out + written);
+        }
+#endif
+
+        /**
+         * @brief Picks the widest UTF-8 to UTF-16 / UTF-32 transcoding kernel supported by the running CPU.
+         */
+        template <typename Unit>
+        inline utf8_to_units_kernel<Unit> select_utf8_to_units_kernel() noexcept
+        {
+#if SWE_HAS_X86_SIMD
+            if (get_cpu_features().ssse3)
+                return &utf8_to_units_ssse3<Unit>;
+#endif
+            return &utf8_to_units_scalar<Unit>;
+        }
+
+        /**
+         * @brief Returns the UTF-8 to UTF-16 / UTF-32 transcoding kernel for Unit, selected once on first use.
+         */
+        template <typename Unit>
+        inline utf8_to_units_kernel<Unit> utf8_to_units_dispatch() noexcept
+        {
+            static const utf8_to_units_kernel<Unit> kernel = select_utf8_to_units_kernel<Unit>();
+            return kernel;
+        }
+
+        /**
+         * @brief Picks the widest UTF-16 / UTF-32 to UTF-8 transcoding kernel supported by the running CPU.
+         */
+        template <typename Unit>
+        inline units_to_utf8_kernel<Unit> select_units_to_utf8_kernel() noexcept
+        {
+#if SWE_HAS_X86_SIMD
+            if (get_cpu_features().ssse3)
+                return &units_to_utf8_ssse3<Unit>;
+#endif
+            return &units_to_utf8_scalar<Unit>;
+        }
+
+        /**
+         * @brief Returns the UTF-16 / UTF-32 to UTF-8 transcoding kernel for Unit, selected once on first use.
+         */
+        template <typename Unit>
+        inline units_to_utf8_kernel<Unit> units_to_utf8_dispatch() noexcept
+        {
+            static const units_to_utf8_kernel<Unit> kernel = select_units_to_utf8_kernel<Unit>();
+            return kernel;
+        }
+
+        /**
+         * @brief Transcodes UTF-8 to UTF-16 (two-byte Unit) or UTF-32 at out, which must have room for
+         * utf8_units_length<Unit>(src, count) units. Returns the number of units written.
+         */
+        template <typename Unit>
+        inline std::size_t utf8_to_units(const char* src, std::size_t count, Unit* out) noexcept
+        {
+            return utf8_to_units_dispatch<Unit>()(src, count, out);
+        }
+
+        /**
+         * @brief Number of UTF-8 bytes that units_to_utf8 writes for [src, src + count).
+         */
+        template <typename Unit>
+        inline std::size_t units_utf8_length(const Unit* src, std::size_t count) noexcept
+        {
+            if (sizeof(Unit) == 2)
+            {
+                bool has_surrogates = false;
+                const std::size_t length = utf16_measure_dispatch<Unit>()(src, count, has_surrogates);
+                if (!has_surrogates || units_validate(src, count))
+                    return length;
+            }
+            std::size_t result = 0;
+            for (std::size_t i = 0; i < count;)
+            {
+                const utf8_decoded decoded = units_decode(src + i, count - i);
+                result += utf8_length(decoded.valid ? decoded.code_point : replacement_character);
+                i += decoded.length;
+            }
+            return result;
+        }
+
+        /**
+         * @brief Transcodes UTF-16 (two-byte Unit) or UTF-32 to UTF-8 at out, which must have room for
+         * units_utf8_length(src, count) bytes. Returns the number of bytes written.
+         */
+        template <typename Unit>
+        inline std::size_t units_to_utf8(const Unit* src, std::size_t count, char* out) noexcept
+        {
+            return units_to_utf8_dispatch<Unit>()(src, count, out);
+        }
+    } // namespace detail
+} // namespace swe
\ No newline at end of file
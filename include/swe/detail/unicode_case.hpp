@@ -0,0 +1,280 @@
+/**
+ * @file unicode_case.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Unicode simple case mapping and case-insensitive matching of UTF-8 text.
+ *
+ * This header maps code points through the generated tables in unicode_case_tables.hpp and builds
+ * the UTF-8 aware case-insensitive comparison and hashing used for narrow strings on top of them.
+ * ASCII code points never reach the tables, and runs of eight ASCII bytes are compared with the
+ * SWAR fold from ascii.hpp. Invalid UTF-8 bytes are never folded and only match themselves. It is
+ * an implementation detail and should not be included directly by user code.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "../ascii.hpp"
+#include "ascii_case.hpp"
+#include "bits.hpp"
+#include "hash.hpp"
+#include "unicode_case_tables.hpp"
+#include "utf8.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace swe
+{
+    namespace detail
+    {
+        /**
+         * @brief Looks cp up in table. Returns true and stores the mapping in result if cp has an entry.
+         */
+        inline bool find_case_mapping(case_table table, std::uint32_t cp, std::uint32_t& result) noexcept
+        {
+            // Last run starting at or before cp
+            std::size_t lo = 0, hi = table.size;
+            while (lo < hi)
+            {
+                const std::size_t mid = lo + (hi - lo) / 2;
+                if (table.runs[mid].first <= cp)
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+            if (lo == 0)
+                return false;
+            const case_run& run = table.runs[lo - 1];
+            const std::uint32_t offset = cp - run.first;
+            if (offset >= static_cast<std::uint32_t>(run.count) * run.stride || offset % run.stride != 0)
+                return false;
+            result = static_cast<std::uint32_t>(static_cast<std::int32_t>(cp) + run.delta);
+            return true;
+        }
+
+        inline std::uint32_t map_case(case_table table, std::uint32_t cp) noexcept
+        {
+            std::uint32_t result = cp;
+            find_case_mapping(table, cp, result);
+            return result;
+        }
+
+        /**
+         * @brief Simple lower-case mapping of a code point.
+         */
+        inline std::uint32_t to_lower_code_point(std::uint32_t cp) noexcept
+        {
+            return cp < 0x80 ? static_cast<unsigned char>(swe::ascii_to_lower(static_cast<char>(cp))) : map_case(lower_case_table(), cp);
+        }
+
+        /**
+         * @brief Simple upper-case mapping of a code point.
+         */
+        inline std::uint32_t to_upper_code_point(std::uint32_t cp) noexcept
+        {
+            return cp < 0x80 ? static_cast<unsigned char>(swe::ascii_to_upper(static_cast<char>(cp))) : map_case(upper_case_table(), cp);
+        }
+
+        /**
+         * @brief Simple title-case mapping of a code point.
+         */
+        inline std::uint32_t to_title_code_point(std::uint32_t cp) noexcept
+        {
+            std::uint32_t result;
+            return cp >= 0x80 && find_case_mapping(title_case_table(), cp, result) ? result : to_upper_code_point(cp);
+        }
+
+        /**
+         * @brief Simple case folding of a code point.
+         */
+        inline std::uint32_t fold_code_point(std::uint32_t cp) noexcept
+        {
+            return cp < 0x80 ? static_cast<unsigned char>(swe::ascii_to_lower(static_cast<char>(cp))) : map_case(fold_case_table(), cp);
+        }
+
+        /**
+         * @brief Whether a non-ASCII code point folds to the given folded ASCII character. Only U+017F LATIN
+         * SMALL LETTER LONG S ('s') and U+212A KELVIN SIGN ('k') do.
+         */
+        inline bool has_non_ascii_fold_partner(char folded) noexcept
+        {
+            return folded == 's' || folded == 'k';
+        }
+
+        /**
+         * @brief Folded value of a decoded sequence. Invalid bytes map above U+10FFFF so they only match themselves.
+         */
+        inline std::uint32_t fold_decoded(const utf8_decoded& decoded) noexcept
+        {
+            return decoded.valid ? fold_code_point(decoded.code_point) : 0x110000 + decoded.code_point;
+        }
+
+        /**
+         * @brief Value returned by utf8_match_folded when the pattern does not match.
+         */
+        static const std::size_t utf8_no_match = static_cast<std::size_t>(-1);
+
+        /**
+         * @brief Matches all of pattern against the start of str after case folding both.
+         * @return Number of bytes of str covered by the match, or utf8_no_match.
+         */
+        inline std::size_t utf8_match_folded(const char* str, std::size_t str_count, const char* pattern, std::size_t pattern_count) noexcept
+        {
+            std::size_t i = 0, j = 0;
+            while (j < pattern_count)
+            {
+                if (i == str_count)
+                    return utf8_no_match;
+                if (str_count - i >= 8 && pattern_count - j >= 8)
+                {
+                    const std::uint64_t a = load_u64(str + i);
+                    const std::uint64_t b = load_u64(pattern + j);
+                    // Eight ASCII bytes on both sides are eight code points each and fold exactly with SWAR
+                    if (((a | b) & 0x8080808080808080ull) == 0)
+                    {
+                        if (a != b && ascii_fold_word(a) != ascii_fold_word(b))
+                            return utf8_no_match;
+                        i += 8;
+                        j += 8;
+                        continue;
+                    }
+                }
+                const utf8_decoded lhs = utf8_decode(str + i, str_count - i);
+                const utf8_decoded rhs = utf8_decode(pattern + j, pattern_count - j);
+                if (fold_decoded(lhs) != fold_decoded(rhs))
+                    return utf8_no_match;
+                i += lhs.length;
+                j += rhs.length;
+            }
+            return i;
+        }
+
+        /**
+         * @brief Matches all of pattern against the end of str after case folding both.
+         */
+        inline bool utf8_match_folded_backward(const char* str, std::size_t str_count, const char* pattern, std::size_t pattern_count) noexcept
+        {
+            while (pattern_count > 0)
+            {
+                if (str_count == 0)
+                    return false;
+                const utf8_decoded lhs = utf8_decode_backward(str, str_count);
+                const utf8_decoded rhs = utf8_decode_backward(pattern, pattern_count);
+                if (fold_decoded(lhs) != fold_decoded(rhs))
+                    return false;
+                str_count -= lhs.length;
+                pattern_count -= rhs.length;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Orders two words of folded ASCII bytes by their first differing byte in memory order.
+         */
+        inline int compare_folded_words(std::uint64_t lhs, std::uint64_t rhs) noexcept
+        {
+            unsigned char a[8], b[8];
+            std::memcpy(a, &lhs, 8);
+            std::memcpy(b, &rhs, 8);
+            std::size_t i = 0;
+            while (a[i] == b[i])
+                ++i;
+            return a[i] < b[i] ? -1 : 1;
+        }
+
+        /**
+         * @brief Compares UTF-8 text by its sequence of folded code points.
+         *
+         * Two strings compare equal exactly when utf8_match_folded considers them equal, so the order is a
+         * strict weak ordering consistent with case-insensitive equality. Invalid bytes order after every
+         * code point. Runs of eight ASCII bytes on both sides are folded and compared a word at a time.
+         *
+         * @param prefix If true, lhs compares equal to rhs once all of rhs is matched, so every string that
+         * starts with rhs (ignoring case) compares equal to it.
+         * @return Negative, zero or positive when lhs orders before, with or after rhs.
+         */
+        inline int utf8_compare_folded(const char* lhs, std::size_t lhs_count, const char* rhs, std::size_t rhs_count, bool prefix = false) noexcept
+        {
+            std::size_t i = 0, j = 0;
+            while (j < rhs_count)
+            {
+                if (i == lhs_count)
+                    return -1;
+                if (lhs_count - i >= 8 && rhs_count - j >= 8)
+                {
+                    std::uint64_t a = load_u64(lhs + i);
+                    std::uint64_t b = load_u64(rhs + j);
+                    if (((a | b) & 0x8080808080808080ull) == 0)
+                    {
+                        if (a != b)
+                        {
+                            a = ascii_fold_word(a);
+                            b = ascii_fold_word(b);
+                            if (a != b)
+                                return compare_folded_words(a, b);
+                        }
+                        i += 8;
+                        j += 8;
+                        continue;
+                    }
+                }
+                const utf8_decoded l = utf8_decode(lhs + i, lhs_count - i);
+                const utf8_decoded r = utf8_decode(rhs + j, rhs_count - j);
+                const std::uint32_t fl = fold_decoded(l);
+                const std::uint32_t fr = fold_decoded(r);
+                if (fl != fr)
+                    return fl < fr ? -1 : 1;
+                i += l.length;
+                j += r.length;
+            }
+            return prefix || i == lhs_count ? 0 : 1;
+        }
+
+        /**
+         * @brief Hash of UTF-8 text that is equal for any two strings utf8_match_folded considers equal.
+         *
+         * The text is hashed as the UTF-8 encoding of its folded code points, so a code point that folds
+         * to ASCII (U+212A KELVIN SIGN) hashes like the ASCII letter. Invalid bytes are hashed as they are.
+         */
+        inline std::size_t utf8_hash_folded(const char* data, std::size_t count) noexcept
+        {
+            // ASCII text only differs from its folded form in the case of letters, so it is hashed in place
+            std::size_t ascii = ascii_prefix_length(data, count);
+            if (ascii == count)
+                return ascii_hash_folded(data, count);
+
+            hash_stream stream;
+            char folded[64];
+            for (std::size_t i = 0; i < count;)
+            {
+                while (ascii > 0)
+                {
+                    const std::size_t n = ascii < sizeof(folded) ? ascii : sizeof(folded);
+                    ascii_to_lower(folded, data + i, n);
+                    stream.append(folded, n);
+                    i += n;
+                    ascii -= n;
+                }
+                if (i == count)
+                    break;
+                const utf8_decoded decoded = utf8_decode(data + i, count - i);
+                if (decoded.valid)
+                {
+                    const std::uint32_t cp = fold_code_point(decoded.code_point);
+                    utf8_encode(cp, folded);
+                    stream.append(folded, utf8_length(cp));
+                }
+                else
+                {
+                    stream.append(data + i, decoded.length);
+                }
+                i += decoded.length;
+                ascii = ascii_prefix_length(data + i, count - i);
+            }
+            return stream.finish();
+        }
+    } // namespace detail
+} // namespace swe
\ No newline at end of file
@@ -0,0 +1,248 @@
+/**
+ * @file utf8.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief UTF-8 decoding, encoding and ASCII scanning helpers for the SWE library.
+ *
+ * Decoding is strict: overlong forms, surrogates and code points above U+10FFFF are rejected, and
+ * callers pass the offending byte through unchanged. The ASCII scan uses SIMD kernels so that
+ * ASCII-heavy text can be handed to the ASCII fast paths in large runs. It is an implementation
+ * detail and should not be included directly by user code.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "bits.hpp"
+#include "config.hpp"
+#include "cpu.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if SWE_HAS_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace swe
+{
+    namespace detail
+    {
+        /**
+         * @brief Result of decoding one UTF-8 sequence.
+         */
+        struct utf8_decoded
+        {
+            std::uint32_t code_point; ///< Decoded code point; the lead byte if the sequence is invalid.
+            std::size_t length;       ///< Number of bytes consumed; always 1 for an invalid sequence.
+            bool valid;               ///< Whether the bytes formed a well-formed sequence.
+        };
+
+        /**
+         * @brief Decodes the UTF-8 sequence at the start of [data, data + count). count must not be 0.
+         */
+        inline utf8_decoded utf8_decode(const char* data, std::size_t count) noexcept
+        {
+            const unsigned char* s = reinterpret_cast<const unsigned char*>(data);
+            const utf8_decoded invalid = {s[0], 1, false};
+            if (s[0] < 0x80)
+            {
+                const utf8_decoded result = {s[0], 1, true};
+                return result;
+            }
+
+            std::size_t length;
+            std::uint32_t cp, min;
+            if ((s[0] & 0xE0) == 0xC0)
+            {
+                length = 2;
+                cp = s[0] & 0x1Fu;
+                min = 0x80;
+            }
+            else if ((s[0] & 0xF0) == 0xE0)
+            {
+                length = 3;
+                cp = s[0] & 0x0Fu;
+                min = 0x800;
+            }
+            else if ((s[0] & 0xF8) == 0xF0)
+            {
+                length = 4;
+                cp = s[0] & 0x07u;
+                min = 0x10000;
+            }
+            else
+            {
+                return invalid;
+            }
+
+            if (count < length)
+                return invalid;
+            for (std::size_t i = 1; i < length; ++i)
+            {
+                if ((s[i] & 0xC0) != 0x80)
+                    return invalid;
+                cp = (cp << 6) | (s[i] & 0x3Fu);
+            }
+            if (cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF))
+                return invalid;
+            const utf8_decoded result = {cp, length, true};
+            return result;
+        }
+
+        /**
+         * @brief Decodes the UTF-8 sequence that ends at data + count. count must not be 0.
+         */
+        inline utf8_decoded utf8_decode_backward(const char* data, std::size_t count) noexcept
+        {
+            const unsigned char* s = reinterpret_cast<const unsigned char*>(data);
+            std::size_t start = count - 1;
+            while (start > 0 && count - start < 4 && (s[start] & 0xC0) == 0x80)
+                --start;
+            const utf8_decoded decoded = utf8_decode(data + start, count - start);
+            if (decoded.valid && decoded.length == count - start)
+                return decoded;
+            const utf8_decoded invalid = {s[count - 1], 1, false};
+            return invalid;
+        }
+
+        /**
+         * @brief Number of bytes needed to encode a code point.
+         */
+        inline std::size_t utf8_length(std::uint32_t cp) noexcept
+        {
+            return cp < 0x80 ? 1 : cp < 0x800 ? 2 : cp < 0x10000 ? 3 : 4;
+        }
+
+        /**
+         * @brief Encodes a code point at out, which must have room for utf8_length(cp) bytes.
+         */
+        inline void utf8_encode(std::uint32_t cp, char* out) noexcept
+        {
+            if (cp < 0x80)
+            {
+                out[0] = static_cast<char>(cp);
+            }
+            else if (cp < 0x800)
+            {
+                out[0] = static_cast<char>(0xC0 | (cp >> 6));
+                out[1] = static_cast<char>(0x80 | (cp & 0x3F));
+            }
+            else if (cp < 0x10000)
+            {
+                out[0] = static_cast<char>(0xE0 | (cp >> 12));
+                out[1] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                out[2] = static_cast<char>(0x80 | (cp & 0x3F));
+            }
+            else
+            {
+                out[0] = static_cast<char>(0xF0 | (cp >> 18));
+                out[1] = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+                out[2] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                out[3] = static_cast<char>(0x80 | (cp & 0x3F));
+            }
+        }
+
+        /**
+         * @brief Signature shared by the ASCII scan kernels. Returns the offset of the first byte of
+         * data at or above 0x80, or count if every byte is ASCII.
+         */
+        using ascii_scan_kernel = std::size_t (*)(const char* data, std::size_t count);
+
+        inline std::size_t ascii_scan_scalar(const char* data, std::size_t count) noexcept
+        {
+            std::size_t i = 0;
+            for (; i + 8 <= count; i += 8)
+            {
+                std::uint64_t word;
+                std::memcpy(&word, data + i, 8);
+                if (word & 0x8080808080808080ull)
+                    break;
+            }
+            for (; i < count; ++i)
+            {
+                if (static_cast<unsigned char>(data[i]) >= 0x80)
+                    return i;
+            }
+            return count;
+        }
+
+#if SWE_HAS_X86_SIMD
+        SWE_TARGET("sse2")
+        inline std::size_t ascii_scan_sse2(const char* data, std::size_t count) noexcept
+        {
+            std::size_t i = 0;
+            for (; i + 16 <= count; i += 16)
+            {
+                const std::uint32_t mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i))));
+                if (mask)
+                    return i + count_trailing_zeros(mask);
+            }
+            return i + ascii_scan_scalar(data + i, count - i);
+        }
+
+        SWE_TARGET("avx2")
+        inline std::size_t ascii_scan_avx2(const char* data, std::size_t count) noexcept
+        {
+            std::size_t i = 0;
+            for (; i + 32 <= count; i += 32)
+            {
+                const std::uint32_t mask =
+                    static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i))));
+                if (mask)
+                    return i + count_trailing_zeros(mask);
+            }
+            return i + ascii_scan_scalar(data + i, count - i);
+        }
+
+        SWE_TARGET("avx512f,avx512bw")
+        inline std::size_t ascii_scan_avx512bw(const char* data, std::size_t count) noexcept
+        {
+            for (std::size_t i = 0; i < count; i += 64)
+            {
+                const std::uint64_t valid = count - i >= 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << (count - i)) - 1;
+                const std::uint64_t mask = _mm512_movepi8_mask(_mm512_maskz_loadu_epi8(valid, data + i));
+                if (mask)
+                    return i + count_trailing_zeros(mask);
+            }
+            return count;
+        }
+#endif
+
+        /**
+         * @brief Picks the widest ASCII scan kernel supported by the running CPU.
+         */
+        inline ascii_scan_kernel select_ascii_scan_kernel() noexcept
+        {
+#if SWE_HAS_X86_SIMD
+            const cpu_features& features = get_cpu_features();
+            if (features.avx512bw)
+                return &ascii_scan_avx512bw;
+            if (features.avx2)
+                return &ascii_scan_avx2;
+            if (features.sse2)
+                return &ascii_scan_sse2;
+#endif
+            return &ascii_scan_scalar;
+        }
+
+        /**
+         * @brief Returns the ASCII scan kernel, selected once on first use.
+         */
+        inline ascii_scan_kernel ascii_scan_dispatch() noexcept
+        {
+            static const ascii_scan_kernel kernel = select_ascii_scan_kernel();
+            return kernel;
+        }
+
+        /**
+         * @brief Returns the length of the run of ASCII bytes at the start of data.
+         */
+        inline std::size_t ascii_prefix_length(const char* data, std::size_t count) noexcept
+        {
+            return ascii_scan_dispatch()(data, count);
+        }
+    } // namespace detail
+} // namespace swe
\ No newline at end of file
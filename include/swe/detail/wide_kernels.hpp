@@ -0,0 +1,560 @@
+/**
+ * @file wide_kernels.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief SIMD kernels over 32-bit wchar_t strings for the SWE library.
+ *
+ * Where wchar_t is 32 bits wide every character is one code point, so a vector register holds 4, 8
+ * or 16 of them. These kernels handle the common characters of wide strings in bulk and stop at the
+ * ones that need the C library: the case kernels convert ASCII letters and stop at the first
+ * character beyond ASCII, the fold kernel compares ASCII-folded characters and stops at the first
+ * pair that differs, and the set kernels classify characters against a byte_set after narrowing
+ * them to bytes and stop at any character above 0xFF. Callers resolve the stopping character
+ * through the locale (or the wide list of a set) and resume. With a 16-bit wchar_t only the scalar
+ * kernels are compiled. The best kernel for the running CPU is selected on first use. It is an
+ * implementation detail and should not be included directly by user code.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "bits.hpp"
+#include "byte_set.hpp"
+#include "config.hpp"
+#include "cpu.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#if SWE_HAS_X86_SIMD && SWE_WCHAR_IS_32BIT
+#include <immintrin.h>
+#endif
+
+namespace swe
+{
+    namespace detail
+    {
+        /**
+         * @brief Code point value of a wide character; negative 32-bit values compare above every valid code point.
+         */
+        inline std::uint32_t wide_unit(wchar_t c) noexcept
+        {
+            return static_cast<std::uint32_t>(c);
+        }
+
+        /**
+         * @brief Signature shared by the wide case conversion kernels.
+         *
+         * Flips the case of every character of src in the range [first, first + 25] and writes the result to
+         * dst, stopping at the first character beyond ASCII. Passing 'A' converts to lower case, passing 'a'
+         * converts to upper case. dst may equal src. Returns the number of characters converted.
+         */
+        using wide_case_kernel = std::size_t (*)(wchar_t* dst, const wchar_t* src, std::size_t count, wchar_t first);
+
+        inline std::size_t wide_case_scalar(wchar_t* dst, const wchar_t* src, std::size_t count, wchar_t first) noexcept
+        {
+            const std::uint32_t base = wide_unit(first);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const std::uint32_t c = wide_unit(src[i]);
+                if (c >= 0x80)
+                    return i;
+                dst[i] = static_cast<wchar_t>(c - base < 26 ? c ^ 0x20 : c);
+            }
+            return count;
+        }
+
+        /**
+         * @brief Signature shared by the wide fold kernels. Returns the offset of the first pair of characters
+         * of lhs and rhs that differ after folding 'A' to 'Z' to lower case, or count if there is none.
+         */
+        using wide_fold_kernel = std::size_t (*)(const wchar_t* lhs, const wchar_t* rhs, std::size_t count);
+
+        inline std::uint32_t wide_fold_ascii(wchar_t c) noexcept
+        {
+            const std::uint32_t u = wide_unit(c);
+            return u - 'A' < 26 ? u | 0x20 : u;
+        }
+
+        inline std::size_t wide_fold_scalar(const wchar_t* lhs, const wchar_t* rhs, std::size_t count) noexcept
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if (wide_fold_ascii(lhs[i]) != wide_fold_ascii(rhs[i]))
+                    return i;
+            }
+            return count;
+        }
+
+        /**
+         * @brief Signature shared by the wide set kernels. Returns the offset of the first character of data
+         * that is above 0xFF or whose membership in set equals member, or count if there is none.
+         */
+        using wide_set_kernel = std::size_t (*)(const wchar_t* data, std::size_t count, const byte_set& set, bool member);
+
+        /**
+         * @brief Signature shared by the reverse wide set kernels. Returns one past the offset of the last
+         * character of data that is above 0xFF or whose membership in set equals member, or 0 if there is none.
+         */
+        using wide_set_reverse_kernel = std::size_t (*)(const wchar_t* data, std::size_t count, const byte_set& set, bool member);
+
+        inline bool wide_set_stops(wchar_t c, const byte_set& set, bool member) noexcept
+        {
+            const std::uint32_t u = wide_unit(c);
+            return u > 0xFF || set.contains(static_cast<unsigned char>(u)) == member;
+        }
+
+        inline std::size_t wide_set_scalar(const wchar_t* data, std::size_t count, const byte_set& set, bool member) noexcept
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if (wide_set_stops(data[i], set, member))
+                    return i;
+            }
+            return count;
+        }
+
+        inline std::size_t wide_set_reverse_scalar(const wchar_t* data, std::size_t count, const byte_set& set, bool member) noexcept
+        {
+            for (std::size_t i = count; i > 0; --i)
+            {
+                if (wide_set_stops(data[i - 1], set, member))
+                    return i;
+            }
+            return 0;
+        }
+
+#if SWE_HAS_X86_SIMD && SWE_WCHAR_IS_32BIT
+        SWE_TARGET("sse2")
+        inline std::size_t wide_case_sse2(wchar_t* dst, const wchar_t* src, std::size_t count, wchar_t first) noexcept
+        {
+            // Shift the letter range onto [INT32_MIN, INT32_MIN + 25] so a single signed compare selects it
+            const __m128i offset = _mm_set1_epi32(static_cast<int>(0x80000000u - wide_unit(first)));
+            const __m128i limit = _mm_set1_epi32(static_cast<int>(0x80000000u + 26));
+            const __m128i flip = _mm_set1_epi32(0x20);
+            const __m128i non_ascii = _mm_set1_epi32(~0x7F);
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4)
+            {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(v, non_ascii), _mm_setzero_si128())) != 0xFFFF)
+                    break;
+                const __m128i letters = _mm_cmplt_epi32(_mm_add_epi32(v, offset), limit);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_xor_si128(v, _mm_and_si128(letters, flip)));
+            }
+            return i + wide_case_scalar(dst + i, src + i, count - i, first);
+        }
+
+        SWE_TARGET("avx2")
+        inline std::size_t wide_case_avx2(wchar_t* dst, const wchar_t* src, std::size_t count, wchar_t first) noexcept
+        {
+            const __m256i offset = _mm256_set1_epi32(static_cast<int>(0x80000000u - wide_unit(first)));
+            const __m256i limit = _mm256_set1_epi32(static_cast<int>(0x80000000u + 26));
+            const __m256i flip = _mm256_set1_epi32(0x20);
+            const __m256i non_ascii = _mm256_set1_epi32(~0x7F);
+            std::size_t i = 0;
+            for (; i + 8 <= count; i += 8)
+            {
+                const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                if (!_mm256_testz_si256(v, non_ascii))
+                    break;
+                const __m256i letters = _mm256_cmpgt_epi32(limit, _mm256_add_epi32(v, offset));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_xor_si256(v, _mm256_and_si256(letters, flip)));
+            }
+            return i + wide_case_scalar(dst + i, src + i, count - i, first);
+        }
+
+        SWE_TARGET("avx512f,avx512bw")
+        inline std::size_t wide_case_avx512bw(wchar_t* dst, const wchar_t* src, std::size_t count, wchar_t first) noexcept
+        {
+            const __m512i base = _mm512_set1_epi32(static_cast<int>(wide_unit(first)));
+            const __m512i letter_count = _mm512_set1_epi32(26);
+            const __m512i flip = _mm512_set1_epi32(0x20);
+            const __m512i non_ascii = _mm512_set1_epi32(~0x7F);
+            for (std::size_t i = 0; i < count; i += 16)
+            {
+                // The final partial block is loaded and stored under a mask, so no scalar tail is needed
+                const __mmask16 valid = count - i >= 16 ? __mmask16(0xFFFF) : static_cast<__mmask16>((1u << (count - i)) - 1);
+                const __m512i v = _mm512_maskz_loadu_epi32(valid, src + i);
+                if (_mm512_test_epi32_mask(v, non_ascii))
+                    return i + wide_case_scalar(dst + i, src + i, count - i, first);
+                const __mmask16 letters = _mm512_cmplt_epu32_mask(_mm512_sub_epi32(v, base), letter_count);
+                _mm512_mask_storeu_epi32(dst + i, valid, _mm512_mask_xor_epi32(v, letters, v, flip));
+            }
+            return count;
+        }
+
+        SWE_TARGET("sse2")
+        inline std::size_t wide_fold_sse2(const wchar_t* lhs, const wchar_t* rhs, std::size_t count) noexcept
+        {
+            const __m128i offset = _mm_set1_epi32(static_cast<int>(0x80000000u - 'A'));
+            const __m128i limit = _mm_set1_epi32(static_cast<int>(0x80000000u + 26));
+            const __m128i flip = _mm_set1_epi32(0x20);
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4)
+            {
+                const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i));
+                const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i));
+                const __m128i fa = _mm_or_si128(a, _mm_and_si128(_mm_cmplt_epi32(_mm_add_epi32(a, offset), limit), flip));
+                const __m128i fb = _mm_or_si128(b, _mm_and_si128(_mm_cmplt_epi32(_mm_add_epi32(b, offset), limit), flip));
+                const std::uint32_t differ = ~static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi32(fa, fb))) & 0xFFFFu;
+                if (differ)
+                    return i + count_trailing_zeros(differ) / 4;
+            }
+            return i + wide_fold_scalar(lhs + i, rhs + i, count - i);
+        }
+
+        SWE_TARGET("avx2")
+        inline std::size_t wide_fold_avx2(const wchar_t* lhs, const wchar_t* rhs, std::size_t count) noexcept
+        {
+            const __m256i offset = _mm256_set1_epi32(static_cast<int>(0x80000000u - 'A'));
+            const __m256i limit = _mm256_set1_epi32(static_cast<int>(0x80000000u + 26));
+            const __m256i flip = _mm256_set1_epi32(0x20);
+            std::size_t i = 0;
+            for (; i + 8 <= count; i += 8)
+            {
+                const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + i));
+                const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + i));
+                const __m256i fa = _mm256_or_si256(a, _mm256_and_si256(_mm256_cmpgt_epi32(limit, _mm256_add_epi32(a, offset)), flip));
+                const __m256i fb = _mm256_or_si256(b, _mm256_and_si256(_mm256_cmpgt_epi32(limit, _mm256_add_epi32(b, offset)), flip));
+                const std::uint32_t differ = ~static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi32(fa, fb)));
+                if (differ)
+                    return i + count_trailing_zeros(differ) / 4;
+            }
+            return i + wide_fold_scalar(lhs + i, rhs + i, count - i);
+        }
+
+        SWE_TARGET("avx512f,avx512bw")
+        inline std::size_t wide_fold_avx512bw(const wchar_t* lhs, const wchar_t* rhs, std::size_t count) noexcept
+        {
+            const __m512i base = _mm512_set1_epi32('A');
+            const __m512i letter_count = _mm512_set1_epi32(26);
+            const __m512i flip = _mm512_set1_epi32(0x20);
+            for (std::size_t i = 0; i < count; i += 16)
+            {
+                const __mmask16 valid = count - i >= 16 ? __mmask16(0xFFFF) : static_cast<__mmask16>((1u << (count - i)) - 1);
+                const __m512i a = _mm512_maskz_loadu_epi32(valid, lhs + i);
+                const __m512i b = _mm512_maskz_loadu_epi32(valid, rhs + i);
+                const __m512i fa = _mm512_mask_or_epi32(a, _mm512_cmplt_epu32_mask(_mm512_sub_epi32(a, base), letter_count), a, flip);
+                const __m512i fb = _mm512_mask_or_epi32(b, _mm512_cmplt_epu32_mask(_mm512_sub_epi32(b, base), letter_count), b, flip);
+                const std::uint32_t differ = _mm512_cmpneq_epu32_mask(fa, fb);
+                if (differ)
+                    return i + count_trailing_zeros(differ);
+            }
+            return count;
+        }
+
+        /**
+         * @brief Classifies 16 characters against set. Bit i of the result is set when character i is above
+         * 0xFF or its membership equals member (flip is all ones for members, zero for non-members).
+         */
+        SWE_TARGET("ssse3")
+        inline std::uint32_t wide_set_block_ssse3(const wchar_t* data, const byte_set& set, std::uint32_t flip) noexcept
+        {
+            const __m128i low_table = _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.nibbles));
+            const __m128i high_table = _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.nibbles + 16));
+            const __m128i low_bits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(byte_set_high_bits[0]));
+            const __m128i high_bits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(byte_set_high_bits[1]));
+            const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+            const __m128i byte_mask = _mm_set1_epi32(0xFF);
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+            const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 4));
+            const __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 8));
+            const __m128i v3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 12));
+            // Narrow the characters to their low bytes, and flag the ones that fit in a byte
+            const __m128i v = _mm_packus_epi16(_mm_packs_epi32(_mm_and_si128(v0, byte_mask), _mm_and_si128(v1, byte_mask)),
+                                               _mm_packs_epi32(_mm_and_si128(v2, byte_mask), _mm_and_si128(v3, byte_mask)));
+            const __m128i fits = _mm_packs_epi16(_mm_packs_epi32(_mm_cmpeq_epi32(_mm_andnot_si128(byte_mask, v0), zero),
+                                                                 _mm_cmpeq_epi32(_mm_andnot_si128(byte_mask, v1), zero)),
+                                                 _mm_packs_epi32(_mm_cmpeq_epi32(_mm_andnot_si128(byte_mask, v2), zero),
+                                                                 _mm_cmpeq_epi32(_mm_andnot_si128(byte_mask, v3), zero)));
+            const __m128i lo = _mm_and_si128(v, nibble_mask);
+            const __m128i hi = _mm_and_si128(_mm_srli_epi16(v, 4), nibble_mask);
+            const __m128i bits = _mm_or_si128(_mm_and_si128(_mm_shuffle_epi8(low_table, lo), _mm_shuffle_epi8(low_bits, hi)),
+                                              _mm_and_si128(_mm_shuffle_epi8(high_table, lo), _mm_shuffle_epi8(high_bits, hi)));
+            const std::uint32_t mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bits, zero))) ^ flip;
+            return (mask | ~static_cast<std::uint32_t>(_mm_movemask_epi8(fits))) & 0xFFFFu;
+        }
+
+        SWE_TARGET("ssse3")
+        inline std::size_t wide_set_ssse3(const wchar_t* data, std::size_t count, const byte_set& set, bool member) noexcept
+        {
+            const std::uint32_t flip = member ? 0xFFFFu : 0u;
+            std::size_t i = 0;
+            for (; i + 16 <= count; i += 16)
+            {
+                const std::uint32_t mask = wide_set_block_ssse3(data + i, set, flip);
+                if (mask)
+                    return i + count_trailing_zeros(mask);
+            }
+            return i + wide_set_scalar(data + i, count - i, set, member);
+        }
+
+        SWE_TARGET("ssse3")
+        inline std::size_t wide_set_reverse_ssse3(const wchar_t* data, std::size_t count, const byte_set& set, bool member) noexcept
+        {
+            const std::uint32_t flip = member ? 0xFFFFu : 0u;
+            std::size_t i = count;
+            for (; i >= 16; i -= 16)
+            {
+                const std::uint32_t mask = wide_set_block_ssse3(data + i - 16, set, flip);
+                if (mask)
+                    return i - 16 + highest_set_bit(mask) + 1;
+            }
+            return wide_set_reverse_scalar(data, i, set, member);
+        }
+
+        /**
+         * @brief Classifies 32 characters against set, as wide_set_block_ssse3 does for 16.
+         */
+        SWE_TARGET("avx2")
+        inline std::uint32_t wide_set_block_avx2(const wchar_t* data, const byte_set& set, std::uint32_t flip) noexcept
+        {
+            const __m256i low_table = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(set.nibbles)));
+            const __m256i high_table = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(set.nibbles + 16)));
+            const __m256i low_bits = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(byte_set_high_bits[0])));
+            const __m256i high_bits = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(byte_set_high_bits[1])));
+            const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+            const __m256i byte_mask = _mm256_set1_epi32(0xFF);
+            const __m256i zero = _mm256_setzero_si256();
+            // Packing works within 128-bit lanes; this dword permute puts the characters back in order
+            const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+            const __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+            const __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 8));
+            const __m256i v2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 16));
+            const __m256i v3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 24));
+            const __m256i v = _mm256_permutevar8x32_epi32(
+                _mm256_packus_epi16(_mm256_packs_epi32(_mm256_and_si256(v0, byte_mask), _mm256_and_si256(v1, byte_mask)),
+                                    _mm256_packs_epi32(_mm256_and_si256(v2, byte_mask), _mm256_and_si256(v3, byte_mask))),
+                order);
+            const __m256i fits = _mm256_permutevar8x32_epi32(
+                _mm256_packs_epi16(_mm256_packs_epi32(_mm256_cmpeq_epi32(_mm256_andnot_si256(byte_mask, v0), zero),
+                                                      _mm256_cmpeq_epi32(_mm256_andnot_si256(byte_mask, v1), zero)),
+                                   _mm256_packs_epi32(_mm256_cmpeq_epi32(_mm256_andnot_si256(byte_mask, v2), zero),
+                                                      _mm256_cmpeq_epi32(_mm256_andnot_si256(byte_mask, v3), zero))),
+                order);
+            const __m256i lo = _mm256_and_si256(v, nibble_mask);
+            const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble_mask);
+            const __m256i bits = _mm256_or_si256(_mm256_and_si256(_mm256_shuffle_epi8(low_table, lo), _mm256_shuffle_epi8(low_bits, hi)),
+                                                 _mm256_and_si256(_mm256_shuffle_epi8(high_table, lo), _mm256_shuffle_epi8(high_bits, hi)));
+            const std::uint32_t mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(bits, zero))) ^ flip;
+            return mask | ~static_cast<std::uint32_t>(_mm256_movemask_epi8(fits));
+        }
+
+        SWE_TARGET("avx2")
+        inline std::size_t wide_set_avx2(const wchar_t* data, std::size_t count, const byte_set& set, bool member) noexcept
+        {
+            const std::uint32_t flip = member ? 0xFFFFFFFFu : 0u;
+            std::size_t i = 0;
+            for (; i + 32 <= count; i += 32)
+            {
+                const std::uint32_t mask = wide_set_block_avx2(data + i, set, flip);
+                if (mask)
+                    return i + count_trailing_zeros(mask);
+            }
+            return i + wide_set_scalar(data + i, count - i, set, member);
+        }
+
+        SWE_TARGET("avx2")
+        inline std::size_t wide_set_reverse_avx2(const wchar_t* data, std::size_t count, const byte_set& set, bool member) noexcept
+        {
+            const std::uint32_t flip = member ? 0xFFFFFFFFu : 0u;
+            std::size_t i = count;
+            for (; i >= 32; i -= 32)
+            {
+                const std::uint32_t mask = wide_set_block_avx2(data + i - 32, set, flip);
+                if (mask)
+                    return i - 32 + highest_set_bit(mask) + 1;
+            }
+            return wide_set_reverse_scalar(data, i, set, member);
+        }
+
+        /**
+         * @brief Classifies up to 64 characters against set, as wide_set_block_ssse3 does for 16. Only the
+         * characters selected by valid are loaded or reported.
+         */
+        SWE_TARGET("avx512f,avx512bw")
+        inline std::uint64_t wide_set_block_avx512bw(const wchar_t* data, std::uint64_t valid, const byte_set& set, bool member) noexcept
+        {
+            // Full-mask zeroing forms throughout: GCC builds the unmasked broadcast and narrowing on an undefined source
+            const __m512i low_table = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.nibbles)));
+            const __m512i high_table = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.nibbles + 16)));
+            const __m512i low_bits = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_loadu_si128(reinterpret_cast<const __m128i*>(byte_set_high_bits[0])));
+            const __m512i high_bits = _mm512_maskz_broadcast_i32x4(0xFFFF, _mm_loadu_si128(reinterpret_cast<const __m128i*>(byte_set_high_bits[1])));
+            const __m512i nibble_mask = _mm512_set1_epi8(0x0F);
+            const __m512i above_byte = _mm512_set1_epi32(~0xFF);
+            const __m512i v0 = _mm512_maskz_loadu_epi32(static_cast<__mmask16>(valid), data);
+            const __m512i v1 = _mm512_maskz_loadu_epi32(static_cast<__mmask16>(valid >> 16), data + 16);
+            const __m512i v2 = _mm512_maskz_loadu_epi32(static_cast<__mmask16>(valid >> 32), data + 32);
+            const __m512i v3 = _mm512_maskz_loadu_epi32(static_cast<__mmask16>(valid >> 48), data + 48);
+            // Truncate every character to its low byte; the ones that do not fit are flagged separately
+            __m512i v = _mm512_castsi128_si512(_mm512_maskz_cvtepi32_epi8(0xFFFF, v0));
+            v = _mm512_inserti32x4(v, _mm512_maskz_cvtepi32_epi8(0xFFFF, v1), 1);
+            v = _mm512_inserti32x4(v, _mm512_maskz_cvtepi32_epi8(0xFFFF, v2), 2);
+            v = _mm512_inserti32x4(v, _mm512_maskz_cvtepi32_epi8(0xFFFF, v3), 3);
+            const std::uint64_t wide = static_cast<std::uint64_t>(_mm512_test_epi32_mask(v0, above_byte)) |
+                                       static_cast<std::uint64_t>(_mm512_test_epi32_mask(v1, above_byte)) << 16 |
+                                       static_cast<std::uint64_t>(_mm512_test_epi32_mask(v2, above_byte)) << 32 |
+                                       static_cast<std::uint64_t>(_mm512_test_epi32_mask(v3, above_byte)) << 48;
+            const __m512i lo = _mm512_and_si512(v, nibble_mask);
+            const __m512i hi = _mm512_and_si512(_mm512_srli_epi16(v, 4), nibble_mask);
+            const __m512i bits = _mm512_or_si512(_mm512_and_si512(_mm512_shuffle_epi8(low_table, lo), _mm512_shuffle_epi8(low_bits, hi)),
+                                                 _mm512_and_si512(_mm512_shuffle_epi8(high_table, lo), _mm512_shuffle_epi8(high_bits, hi)));
+            const std::uint64_t mask = member ? _mm512_test_epi8_mask(bits, bits) : _mm512_testn_epi8_mask(bits, bits);
+            return (mask | wide) & valid;
+        }
+
+        SWE_TARGET("avx512f,avx512bw")
+        inline std::size_t wide_set_avx512bw(const wchar_t* data, std::size_t count, const byte_set& set, bool member) noexcept
+        {
+            for (std::size_t i = 0; i < count; i += 64)
+            {
+                const std::uint64_t valid = count - i >= 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << (count - i)) - 1;
+                const std::uint64_t mask = wide_set_block_avx512bw(data + i, valid, set, member);
+                if (mask)
+                    return i + count_trailing_zeros(mask);
+            }
+            return count;
+        }
+
+        SWE_TARGET("avx512f,avx512bw")
+        inline std::size_t wide_set_reverse_avx512bw(const wchar_t* data, std::size_t count, const byte_set& set, bool member) noexcept
+        {
+            for (std::size_t i = count; i > 0;)
+            {
+                const std::size_t start = i >= 64 ? i - 64 : 0;
+                const std::uint64_t valid = i - start == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << (i - start)) - 1;
+                const std::uint64_t mask = wide_set_block_avx512bw(data + start, valid, set, member);
+                if (mask)
+                    return start + highest_set_bit(mask) + 1;
+                i = start;
+            }
+            return 0;
+        }
+#endif
+
+        /**
+         * @brief Picks the widest wide case conversion kernel supported by the running CPU.
+         */
+        inline wide_case_kernel select_wide_case_kernel() noexcept
+        {
+#if SWE_HAS_X86_SIMD && SWE_WCHAR_IS_32BIT
+            const cpu_features& features = get_cpu_features();
+            if (features.avx512bw)
+                return &wide_case_avx512bw;
+            if (features.avx2)
+                return &wide_case_avx2;
+            if (features.sse2)
+                return &wide_case_sse2;
+#endif
+            return &wide_case_scalar;
+        }
+
+        /**
+         * @brief Returns the wide case conversion kernel, selected once on first use.
+         */
+        inline wide_case_kernel wide_case_dispatch() noexcept
+        {
+            static const wide_case_kernel kernel = select_wide_case_kernel();
+            return kernel;
+        }
+
+        /**
+         * @brief Picks the widest wide fold kernel supported by the running CPU.
+         */
+        inline wide_fold_kernel select_wide_fold_kernel() noexcept
+        {
+#if SWE_HAS_X86_SIMD && SWE_WCHAR_IS_32BIT
+            const cpu_features& features = get_cpu_features();
+            if (features.avx512bw)
+                return &wide_fold_avx512bw;
+            if (features.avx2)
+                return &wide_fold_avx2;
+            if (features.sse2)
+                return &wide_fold_sse2;
+#endif
+            return &wide_fold_scalar;
+        }
+
+        /**
+         * @brief Returns the wide fold kernel, selected once on first use.
+         */
+        inline wide_fold_kernel wide_fold_dispatch() noexcept
+        {
+            static const wide_fold_kernel kernel = select_wide_fold_kernel();
+            return kernel;
+        }
+
+        /**
+         * @brief Picks the widest wide set kernel supported by the running CPU.
+         */
+        inline wide_set_kernel select_wide_set_kernel() noexcept
+        {
+#if SWE_HAS_X86_SIMD && SWE_WCHAR_IS_32BIT
+            const cpu_features& features = get_cpu_features();
+            if (features.avx512bw)
+                return &wide_set_avx512bw;
+            if (features.avx2)
+                return &wide_set_avx2;
+            if (features.ssse3)
+                return &wide_set_ssse3;
+#endif
+            return &wide_set_scalar;
+        }
+
+        /**
+         * @brief Returns the wide set kernel, selected once on first use.
+         */
+        inline wide_set_kernel wide_set_dispatch() noexcept
+        {
+            static const wide_set_kernel kernel = select_wide_set_kernel();
+            return kernel;
+        }
+
+        /**
+         * @brief Picks the widest reverse wide set kernel supported by the running CPU.
+         */
+        inline wide_set_reverse_kernel select_wide_set_reverse_kernel() noexcept
+        {
+#if SWE_HAS_X86_SIMD && SWE_WCHAR_IS_32BIT
+            const cpu_features& features = get_cpu_features();
+            if (features.avx512bw)
+                return &wide_set_reverse_avx512bw;
+            if (features.avx2)
+                return &wide_set_reverse_avx2;
+            if (features.ssse3)
+                return &wide_set_reverse_ssse3;
+#endif
+            return &wide_set_reverse_scalar;
+        }
+
+        /**
+         * @brief Returns the reverse wide set kernel, selected once on first use.
+         */
+        inline wide_set_reverse_kernel wide_set_reverse_dispatch() noexcept
+        {
+            static const wide_set_reverse_kernel kernel = select_wide_set_reverse_kernel();
+            return kernel;
+        }
+
+        /**
+         * @brief Converts the ASCII letters of src to lower case up to its first character beyond ASCII.
+         * @return The number of characters converted.
+         */
+        inline std::size_t wide_ascii_to_lower(wchar_t* dst, const wchar_t* src, std::size_t count) noexcept
+        {
+            return wide_case_dispatch()(dst, src, count, L'A');
+        }
+
+        /**
+         * @brief Converts the ASCII letters of src to upper case up to its first character beyond ASCII.
+         * @return The number of characters converted.
+         */
+        inline std::size_t wide_ascii_to_upper(wchar_t* dst, const wchar_t* src, std::size_t count) noexcept
+        {
+            return wide_case_dispatch()(dst, src, count, L'a');
+        }
+    } // namespace detail
+} // namespace swe
@@ -0,0 +1,213 @@
+/**
+ * @file xor_kernels.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief SIMD repeating-key XOR kernels for the SWE library.
+ *
+ * The key is expanded once into a keystream whose cycle is a multiple of the key length and at least
+ * one vector wide, followed by one more vector of the repeated key. Any key phase can then be loaded
+ * as a full vector with a single unaligned load, so the kernels XOR 8, 16, 32 or 64 bytes per step
+ * without a division or a per-byte key index. The best kernel for the running CPU is selected on first
+ * use. It is an implementation detail and should not be included directly by user code.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "config.hpp"
+#include "cpu.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if SWE_HAS_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace swe
+{
+    namespace detail
+    {
+        /**
+         * @brief Widest step of any XOR kernel, and the number of bytes stored past the keystream cycle.
+         */
+        static const std::size_t xor_block_size = 64;
+
+        /**
+         * @brief Length of the keystream cycle for a key of key_size bytes: the smallest multiple of
+         * key_size that is at least xor_block_size.
+         */
+        inline std::size_t xor_keystream_cycle(std::size_t key_size) noexcept
+        {
+            return key_size * ((xor_block_size + key_size - 1) / key_size);
+        }
+
+        /**
+         * @brief Fills size bytes of keystream with the non-empty key repeated from its first byte.
+         */
+        inline void xor_fill_keystream(const unsigned char* key, std::size_t key_size, unsigned char* keystream, std::size_t size) noexcept
+        {
+            for (std::size_t i = 0; i < size; i += key_size)
+                std::memcpy(keystream + i, key, size - i < key_size ? size - i : key_size);
+        }
+
+        /**
+         * @brief Expands a non-empty key into a keystream of xor_keystream_cycle(key_size) + xor_block_size bytes.
+         */
+        inline void xor_expand_keystream(const unsigned char* key, std::size_t key_size, std::vector<unsigned char>& keystream)
+        {
+            keystream.resize(xor_keystream_cycle(key_size) + xor_block_size);
+            xor_fill_keystream(key, key_size, keystream.data(), keystream.size());
+        }
+
+        /**
+         * @brief Signature shared by the XOR kernels. XORs count bytes of src with the keystream starting at
+         * phase and stores them to dst, which may equal src. Returns the phase following the last byte.
+         */
+        using xor_kernel = std::size_t (*)(const unsigned char* src, unsigned char* dst, std::size_t count, const unsigned char* keystream,
+                                           std::size_t cycle, std::size_t phase);
+
+        inline std::size_t xor_scalar(const unsigned char* src, unsigned char* dst, std::size_t count, const unsigned char* keystream, std::size_t cycle,
+                                      std::size_t phase) noexcept
+        {
+            std::size_t i = 0;
+            for (; i + 8 <= count; i += 8)
+            {
+                std::uint64_t data;
+                std::uint64_t key;
+                std::memcpy(&data, src + i, 8);
+                std::memcpy(&key, keystream + phase, 8);
+                data ^= key;
+                std::memcpy(dst + i, &data, 8);
+                phase += 8;
+                if (phase >= cycle)
+                    phase -= cycle;
+            }
+            for (; i < count; ++i)
+            {
+                dst[i] = static_cast<unsigned char>(src[i] ^ keystream[phase]);
+                if (++phase == cycle)
+                    phase = 0;
+            }
+            return phase;
+        }
+
+#if SWE_HAS_X86_SIMD
+        SWE_TARGET("sse2")
+        inline std::size_t xor_sse2(const unsigned char* src, unsigned char* dst, std::size_t count, const unsigned char* keystream, std::size_t cycle,
+                                    std::size_t phase) noexcept
+        {
+            std::size_t i = 0;
+            for (; i + 16 <= count; i += 16)
+            {
+                const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                const __m128i key = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keystream + phase));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_xor_si128(data, key));
+                phase += 16;
+                if (phase >= cycle)
+                    phase -= cycle;
+            }
+            return xor_scalar(src + i, dst + i, count - i, keystream, cycle, phase);
+        }
+
+        SWE_TARGET("avx2")
+        inline std::size_t xor_avx2(const unsigned char* src, unsigned char* dst, std::size_t count, const unsigned char* keystream, std::size_t cycle,
+                                    std::size_t phase) noexcept
+        {
+            std::size_t i = 0;
+            for (; i + 32 <= count; i += 32)
+            {
+                const __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                const __m256i key = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keystream + phase));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_xor_si256(data, key));
+                phase += 32;
+                if (phase >= cycle)
+                    phase -= cycle;
+            }
+            return xor_scalar(src + i, dst + i, count - i, keystream, cycle, phase);
+        }
+
+        SWE_TARGET("avx512f,avx512bw")
+        inline std::size_t xor_avx512bw(const unsigned char* src, unsigned char* dst, std::size_t count, const unsigned char* keystream, std::size_t cycle,
+                                        std::size_t phase) noexcept
+        {
+            std::size_t i = 0;
+            for (; i + 64 <= count; i += 64)
+            {
+                const __m512i data = _mm512_loadu_si512(src + i);
+                const __m512i key = _mm512_loadu_si512(keystream + phase);
+                _mm512_storeu_si512(dst + i, _mm512_xor_si512(data, key));
+                phase += 64;
+                if (phase >= cycle)
+                    phase -= cycle;
+            }
+            if (i < count)
+            {
+                const std::size_t rest = count - i;
+                const __mmask64 tail = (~0ULL) >> (64 - rest);
+                const __m512i data = _mm512_maskz_loadu_epi8(tail, src + i);
+                const __m512i key = _mm512_maskz_loadu_epi8(tail, keystream + phase);
+                _mm512_mask_storeu_epi8(dst + i, tail, _mm512_xor_si512(data, key));
+                phase += rest;
+                if (phase >= cycle)
+                    phase -= cycle;
+            }
+            return phase;
+        }
+#endif
+
+        /**
+         * @brief Picks the widest XOR kernel supported by the running CPU.
+         */
+        inline xor_kernel select_xor_kernel() noexcept
+        {
+#if SWE_HAS_X86_SIMD
+            const cpu_features& features = get_cpu_features();
+            if (features.avx512bw)
+                return &xor_avx512bw;
+            if (features.avx2)
+                return &xor_avx2;
+            if (features.sse2)
+                return &xor_sse2;
+#endif
+            return &xor_scalar;
+        }
+
+        /**
+         * @brief Returns the XOR kernel, selected once on first use.
+         */
+        inline xor_kernel xor_dispatch() noexcept
+        {
+            static const xor_kernel kernel = select_xor_kernel();
+            return kernel;
+        }
+
+        /**
+         * @brief XORs count bytes of data in place with a repeating key, starting at the first key byte.
+         *
+         * Keys of at least xor_block_size bytes serve as their own keystream, one key period at a time.
+         * Shorter keys are expanded into a keystream on the stack, so no memory is allocated. An empty
+         * key leaves the data unchanged.
+         */
+        inline void xor_bytes(unsigned char* data, std::size_t count, const unsigned char* key, std::size_t key_size) noexcept
+        {
+            if (key_size == 0)
+                return;
+            const xor_kernel kernel = xor_dispatch();
+            if (key_size >= xor_block_size)
+            {
+                for (std::size_t i = 0; i < count; i += key_size)
+                    kernel(data + i, data + i, count - i < key_size ? count - i : key_size, key, key_size, 0);
+                return;
+            }
+            // The cycle of a key shorter than xor_block_size is below 2 * xor_block_size
+            unsigned char keystream[3 * xor_block_size];
+            const std::size_t cycle = xor_keystream_cycle(key_size);
+            xor_fill_keystream(key, key_size, keystream, cycle + xor_block_size);
+            kernel(data, data, count, keystream, cycle, 0);
+        }
+    } // namespace detail
+} // namespace swe
\ No newline at end of file
@@ -0,0 +1,182 @@
+/**
+ * @file xor_stream.ipp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Definitions of the xor_file functions declared in xor_stream.hpp.
+ *
+ * Compiled into the swe library by src/, or included by xor_stream.hpp when SWE_HEADER_ONLY is defined.
+ * It is an implementation detail and should not be included directly by user code.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "../xor_stream.hpp"
+
+#include <cstdio>
+#include <vector>
+
+#if defined(_WIN32)
+#if !defined(WIN32_LEAN_AND_MEAN)
+#define WIN32_LEAN_AND_MEAN
+#endif
+#if !defined(NOMINMAX)
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace swe
+{
+    namespace detail
+    {
+        /**
+         * @brief Bytes mapped at a time by xor_file. A multiple of every page size and of the Windows allocation granularity.
+         */
+        static const std::uint64_t xor_file_window = 64ull << 20;
+
+        /**
+         * @brief Bytes read at a time by the chunked file functions.
+         */
+        static const std::size_t xor_file_chunk = 1u << 20;
+    } // namespace detail
+
+#if defined(_WIN32)
+    SWE_DECL bool xor_file(const std::string& path, string_view key)
+    {
+        const HANDLE file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file, &file_size))
+        {
+            CloseHandle(file);
+            return false;
+        }
+        const std::uint64_t size = static_cast<std::uint64_t>(file_size.QuadPart);
+        if (size == 0 || key.empty())
+        {
+            CloseHandle(file);
+            return true;
+        }
+        const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READWRITE, 0, 0, nullptr);
+        if (!mapping)
+        {
+            CloseHandle(file);
+            return false;
+        }
+        xor_stream stream(key);
+        bool ok = true;
+        for (std::uint64_t offset = 0; ok && offset < size; offset += detail::xor_file_window)
+        {
+            const std::size_t length = static_cast<std::size_t>(size - offset < detail::xor_file_window ? size - offset : detail::xor_file_window);
+            void* view = MapViewOfFile(mapping, FILE_MAP_WRITE, static_cast<DWORD>(offset >> 32), static_cast<DWORD>(offset & 0xFFFFFFFFu), length);
+            if (!view)
+            {
+                ok = false;
+                break;
+            }
+            stream.apply(view, length);
+            ok = UnmapViewOfFile(view) != 0;
+        }
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return ok;
+    }
+#elif defined(__unix__) || defined(__APPLE__)
+    SWE_DECL bool xor_file(const std::string& path, string_view key)
+    {
+        const int fd = ::open(path.c_str(), O_RDWR);
+        if (fd < 0)
+            return false;
+        struct stat info;
+        if (::fstat(fd, &info) != 0)
+        {
+            ::close(fd);
+            return false;
+        }
+        const std::uint64_t size = static_cast<std::uint64_t>(info.st_size);
+        xor_stream stream(key);
+        bool ok = true;
+        for (std::uint64_t offset = 0; ok && !stream.empty() && offset < size; offset += detail::xor_file_window)
+        {
+            const std::size_t length = static_cast<std::size_t>(size - offset < detail::xor_file_window ? size - offset : detail::xor_file_window);
+            void* view = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, static_cast<off_t>(offset));
+            if (view == MAP_FAILED)
+            {
+                ok = false;
+                break;
+            }
+#if defined(MADV_SEQUENTIAL)
+            ::madvise(view, length, MADV_SEQUENTIAL);
+#endif
+            stream.apply(view, length);
+            ok = ::munmap(view, length) == 0;
+        }
+        return ::close(fd) == 0 && ok;
+    }
+#else
+    SWE_DECL bool xor_file(const std::string& path, string_view key)
+    {
+        std::FILE* file = std::fopen(path.c_str(), "r+b");
+        if (!file)
+            return false;
+        xor_stream stream(key);
+        std::vector<unsigned char> buffer(stream.empty() ? 0 : detail::xor_file_chunk);
+        bool ok = true;
+        while (ok && !stream.empty())
+        {
+            const std::size_t read = std::fread(buffer.data(), 1, buffer.size(), file);
+            if (read == 0)
+            {
+                ok = !std::ferror(file);
+                break;
+            }
+            stream.apply(buffer.data(), read);
+            // Switching from reading to writing requires a seek
+            ok = std::fseek(file, -static_cast<long>(read), SEEK_CUR) == 0 && std::fwrite(buffer.data(), 1, read, file) == read &&
+                 std::fseek(file, 0, SEEK_CUR) == 0;
+        }
+        return std::fclose(file) == 0 && ok;
+    }
+#endif
+
+    SWE_DECL bool xor_file(const std::string& source_path, const std::string& destination_path, string_view key)
+    {
+        std::FILE* source = std::fopen(source_path.c_str(), "rb");
+        if (!source)
+            return false;
+        std::FILE* destination = std::fopen(destination_path.c_str(), "wb");
+        if (!destination)
+        {
+            std::fclose(source);
+            return false;
+        }
+        xor_stream stream(key);
+        std::vector<unsigned char> buffer(detail::xor_file_chunk);
+        bool ok = true;
+        for (;;)
+        {
+            const std::size_t read = std::fread(buffer.data(), 1, buffer.size(), source);
+            if (read == 0)
+            {
+                ok = !std::ferror(source);
+                break;
+            }
+            stream.apply(buffer.data(), read);
+            if (std::fwrite(buffer.data(), 1, read, destination) != read)
+            {
+                ok = false;
+                break;
+            }
+        }
+        std::fclose(source);
+        return std::fclose(destination) == 0 && ok;
+    }
+} // namespace swe
\ No newline at end of file
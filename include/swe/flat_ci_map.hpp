@@ -0,0 +1,893 @@
+/**
+ * @file flat_ci_map.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Open-addressing hash map and the flat case-insensitive map types of the SWE library.
+ *
+ * This header provides swe::flat_hash_map, a hash map that stores its elements directly in one slot
+ * array instead of one heap node per element, in the style of SwissTable. Each slot has a control byte
+ * holding seven bits of the key's hash; a lookup matches the control bytes of 16 slots at once (with
+ * SSE2 on x86) and only compares keys whose byte matches. Each slot also caches the full hash of its key,
+ * which is compared before the key and reused on rehash, so case-insensitive keys are folded and hashed
+ * once. Short std::string keys live inside the slot thanks to the small string buffer, so a hit usually
+ * touches one control group and one slot.
+ *
+ * flat_ci_map, flat_ci_ascii_map and flat_wci_map use the functors of ci_map.hpp and can replace
+ * unordered_ci_map, unordered_ci_ascii_map and unordered_wci_map. Unlike std::unordered_map, inserting
+ * may move elements and invalidates iterators, pointers and references when the table grows.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "ci_map.hpp"
+#include "detail/bits.hpp"
+#include "detail/flat_group.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace swe
+{
+    namespace detail
+    {
+        template <typename Hash, typename KeyEqual, typename = void>
+        struct is_transparent_pair : std::false_type
+        {
+        };
+
+        template <typename Hash, typename KeyEqual>
+        struct is_transparent_pair<Hash, KeyEqual, typename std::conditional<true, void, std::pair<typename Hash::is_transparent, typename KeyEqual::is_transparent>>::type>
+            : std::true_type
+        {
+        };
+    } // namespace detail
+
+    /**
+     * @brief Open-addressing hash map with SIMD control byte probing.
+     *
+     * Offers the std::unordered_map interface apart from the bucket interface. Lookups with a type other
+     * than Key are accepted when both Hash and KeyEqual declare is_transparent. The table keeps at most
+     * 7/8 of its slots full; erasing leaves a tombstone unless the slot's group still has an empty slot.
+     *
+     * @tparam Key Key type.
+     * @tparam T Mapped type.
+     * @tparam Hash Hash functor.
+     * @tparam KeyEqual Equality functor, consistent with Hash.
+     * @tparam Alloc Allocator of std::pair<const Key, T>.
+     */
+    template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>,
+              typename Alloc = std::allocator<std::pair<const Key, T>>>
+    class flat_hash_map
+    {
+      public:
+        using key_type = Key;
+        using mapped_type = T;
+        using value_type = std::pair<const Key, T>;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+        using allocator_type = Alloc;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+        using pointer = value_type*;
+        using const_pointer = const value_type*;
+
+      private:
+        struct slot
+        {
+            std::size_t hash;
+            typename std::aligned_storage<sizeof(value_type), alignof(value_type)>::type storage;
+
+            value_type& value() noexcept
+            {
+                return *reinterpret_cast<value_type*>(&storage);
+            }
+        };
+
+        using value_traits = std::allocator_traits<Alloc>;
+        using slot_allocator = typename value_traits::template rebind_alloc<slot>;
+        using ctrl_allocator = typename value_traits::template rebind_alloc<detail::flat_ctrl>;
+
+        template <typename K>
+        using enable_transparent = typename std::enable_if<detail::is_transparent_pair<Hash, KeyEqual>::value, K>::type;
+
+        static constexpr size_type npos = size_type(-1);
+
+        template <bool Const>
+        class basic_iterator
+        {
+          public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = typename flat_hash_map::value_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = typename std::conditional<Const, const value_type*, value_type*>::type;
+            using reference = typename std::conditional<Const, const value_type&, value_type&>::type;
+
+            basic_iterator() noexcept : _ctrl(nullptr), _slot(nullptr)
+            {
+            }
+
+            // iterator converts to const_iterator
+            template <bool OtherConst, typename = typename std::enable_if<Const && !OtherConst>::type>
+            basic_iterator(const basic_iterator<OtherConst>& other) noexcept : _ctrl(other._ctrl), _slot(other._slot)
+            {
+            }
+
+            reference operator*() const noexcept
+            {
+                return _slot->value();
+            }
+
+            pointer operator->() const noexcept
+            {
+                return &_slot->value();
+            }
+
+            basic_iterator& operator++() noexcept
+            {
+                ++_ctrl;
+                ++_slot;
+                skip_free();
+                return *this;
+            }
+
+            basic_iterator operator++(int) noexcept
+            {
+                basic_iterator copy(*this);
+                ++*this;
+                return copy;
+            }
+
+            friend bool operator==(const basic_iterator& lhs, const basic_iterator& rhs) noexcept
+            {
+                return lhs._slot == rhs._slot;
+            }
+
+            friend bool operator!=(const basic_iterator& lhs, const basic_iterator& rhs) noexcept
+            {
+                return lhs._slot != rhs._slot;
+            }
+
+          private:
+            friend class flat_hash_map;
+            template <bool>
+            friend class basic_iterator;
+
+            basic_iterator(const detail::flat_ctrl* ctrl, slot* s) noexcept : _ctrl(ctrl), _slot(s)
+            {
+            }
+
+            void skip_free() noexcept
+            {
+                // The sentinel after the last slot is not negative, so this stops at end()
+                while (*_ctrl < 0)
+                {
+                    ++_ctrl;
+                    ++_slot;
+                }
+            }
+
+            const detail::flat_ctrl* _ctrl;
+            slot* _slot;
+        };
+
+      public:
+        using iterator = basic_iterator<false>;
+        using const_iterator = basic_iterator<true>;
+
+        flat_hash_map() : flat_hash_map(0)
+        {
+        }
+
+        explicit flat_hash_map(size_type bucket_count, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(), const Alloc& alloc = Alloc())
+            : _ctrl(nullptr), _slots(nullptr), _capacity(0), _size(0), _growth_left(0), _hash(hash), _equal(equal), _alloc(alloc)
+        {
+            if (bucket_count)
+                reserve(bucket_count);
+        }
+
+        explicit flat_hash_map(const Alloc& alloc) : flat_hash_map(0, Hash(), KeyEqual(), alloc)
+        {
+        }
+
+        template <typename InputIt>
+        flat_hash_map(InputIt first, InputIt last, size_type bucket_count = 0, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(),
+                      const Alloc& alloc = Alloc())
+            : flat_hash_map(bucket_count, hash, equal, alloc)
+        {
+            insert(first, last);
+        }
+
+        flat_hash_map(std::initializer_list<value_type> values, size_type bucket_count = 0, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(),
+                      const Alloc& alloc = Alloc())
+            : flat_hash_map(bucket_count, hash, equal, alloc)
+        {
+            insert(values);
+        }
+
+        flat_hash_map(const flat_hash_map& other)
+            : flat_hash_map(0, other._hash, other._equal, value_traits::select_on_container_copy_construction(other._alloc))
+        {
+            reserve(other._size);
+            for (size_type i = 0; i < other._capacity; ++i)
+            {
+                if (other._ctrl[i] >= 0)
+                    emplace_new(other._slots[i].hash, other._slots[i].value());
+            }
+        }
+
+        flat_hash_map(flat_hash_map&& other) noexcept
+            : _ctrl(other._ctrl), _slots(other._slots), _capacity(other._capacity), _size(other._size), _growth_left(other._growth_left),
+              _hash(std::move(other._hash)), _equal(std::move(other._equal)), _alloc(std::move(other._alloc))
+        {
+            other._ctrl = nullptr;
+            other._slots = nullptr;
+            other._capacity = other._size = other._growth_left = 0;
+        }
+
+        flat_hash_map& operator=(const flat_hash_map& other)
+        {
+            if (this != &other)
+            {
+                flat_hash_map copy(other);
+                swap(copy);
+            }
+            return *this;
+        }
+
+        flat_hash_map& operator=(flat_hash_map&& other) noexcept
+        {
+            swap(other);
+            return *this;
+        }
+
+        flat_hash_map& operator=(std::initializer_list<value_type> values)
+        {
+            clear();
+            insert(values);
+            return *this;
+        }
+
+        ~flat_hash_map()
+        {
+            destroy_all();
+            deallocate(_ctrl, _slots, _capacity);
+        }
+
+        iterator begin() noexcept
+        {
+            iterator it(_ctrl, _slots);
+            if (_capacity)
+                it.skip_free();
+            return it;
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return const_cast<flat_hash_map*>(this)->begin();
+        }
+
+        const_iterator cbegin() const noexcept
+        {
+            return begin();
+        }
+
+        iterator end() noexcept
+        {
+            return iterator(_ctrl + _capacity, _slots + _capacity);
+        }
+
+        const_iterator end() const noexcept
+        {
+            return const_cast<flat_hash_map*>(this)->end();
+        }
+
+        const_iterator cend() const noexcept
+        {
+            return end();
+        }
+
+        bool empty() const noexcept
+        {
+            return _size == 0;
+        }
+
+        size_type size() const noexcept
+        {
+            return _size;
+        }
+
+        size_type max_size() const noexcept
+        {
+            return std::allocator_traits<slot_allocator>::max_size(slot_allocator(_alloc)) / 8 * 7;
+        }
+
+        /**
+         * @brief Destroys every element and keeps the slot array for reuse.
+         */
+        void clear() noexcept
+        {
+            destroy_all();
+            reset_ctrl();
+            _size = 0;
+        }
+
+        /**
+         * @brief Inserts an element with key and a mapped value built from args if key is not present.
+         * @return Iterator to the element with key, and whether it was inserted.
+         */
+        template <typename... Args>
+        std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args)
+        {
+            return try_emplace_key(key, std::forward<Args>(args)...);
+        }
+
+        template <typename... Args>
+        std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args)
+        {
+            return try_emplace_key(std::move(key), std::forward<Args>(args)...);
+        }
+
+        template <typename... Args>
+        std::pair<iterator, bool> emplace(Args&&... args)
+        {
+            // The key is only known once the element exists, so it is built aside and moved into its slot
+            typename std::aligned_storage<sizeof(value_type), alignof(value_type)>::type storage;
+            value_type* value = reinterpret_cast<value_type*>(&storage);
+            value_traits::construct(_alloc, value, std::forward<Args>(args)...);
+            struct guard
+            {
+                Alloc& alloc;
+                value_type* value;
+                ~guard()
+                {
+                    value_traits::destroy(alloc, value);
+                }
+            } destroy_value = {_alloc, value};
+            return try_emplace_key(std::move(const_cast<key_type&>(value->first)), std::move(value->second));
+        }
+
+        std::pair<iterator, bool> insert(const value_type& value)
+        {
+            return try_emplace_key(value.first, value.second);
+        }
+
+        std::pair<iterator, bool> insert(value_type&& value)
+        {
+            return try_emplace_key(value.first, std::move(value.second));
+        }
+
+        template <typename P, typename = typename std::enable_if<std::is_constructible<value_type, P&&>::value>::type>
+        std::pair<iterator, bool> insert(P&& value)
+        {
+            return emplace(std::forward<P>(value));
+        }
+
+        template <typename InputIt>
+        void insert(InputIt first, InputIt last)
+        {
+            for (; first != last; ++first)
+                insert(*first);
+        }
+
+        void insert(std::initializer_list<value_type> values)
+        {
+            insert(values.begin(), values.end());
+        }
+
+        /**
+         * @brief Inserts key with value, or assigns value to the element that already has key.
+         */
+        template <typename M>
+        std::pair<iterator, bool> insert_or_assign(const key_type& key, M&& value)
+        {
+            std::pair<iterator, bool> result = try_emplace_key(key, std::forward<M>(value));
+            if (!result.second)
+                result.first->second = std::forward<M>(value);
+            return result;
+        }
+
+        template <typename M>
+        std::pair<iterator, bool> insert_or_assign(key_type&& key, M&& value)
+        {
+            std::pair<iterator, bool> result = try_emplace_key(std::move(key), std::forward<M>(value));
+            if (!result.second)
+                result.first->second = std::forward<M>(value);
+            return result;
+        }
+
+        /**
+         * @brief Erases the element at pos.
+         * @return Iterator to the element after pos.
+         */
+        iterator erase(const_iterator pos) noexcept
+        {
+            iterator next(pos._ctrl, pos._slot);
+            ++next;
+            erase_at(static_cast<size_type>(pos._slot - _slots));
+            return next;
+        }
+
+        iterator erase(iterator pos) noexcept
+        {
+            return erase(const_iterator(pos));
+        }
+
+        iterator erase(const_iterator first, const_iterator last) noexcept
+        {
+            while (first != last)
+                first = erase(first);
+            return iterator(last._ctrl, last._slot);
+        }
+
+        size_type erase(const key_type& key)
+        {
+            return erase_key(key);
+        }
+
+        template <typename K, typename = enable_transparent<K>>
+        size_type erase(const K& key)
+        {
+            return erase_key(key);
+        }
+
+        void swap(flat_hash_map& other) noexcept
+        {
+            using std::swap;
+            swap(_ctrl, other._ctrl);
+            swap(_slots, other._slots);
+            swap(_capacity, other._capacity);
+            swap(_size, other._size);
+            swap(_growth_left, other._growth_left);
+            swap(_hash, other._hash);
+            swap(_equal, other._equal);
+            swap(_alloc, other._alloc);
+        }
+
+        T& at(const key_type& key)
+        {
+            return at_key(key);
+        }
+
+        const T& at(const key_type& key) const
+        {
+            return const_cast<flat_hash_map*>(this)->at_key(key);
+        }
+
+        template <typename K, typename = enable_transparent<K>>
+        T& at(const K& key)
+        {
+            return at_key(key);
+        }
+
+        template <typename K, typename = enable_transparent<K>>
+        const T& at(const K& key) const
+        {
+            return const_cast<flat_hash_map*>(this)->at_key(key);
+        }
+
+        T& operator[](const key_type& key)
+        {
+            return try_emplace_key(key).first->second;
+        }
+
+        T& operator[](key_type&& key)
+        {
+            return try_emplace_key(std::move(key)).first->second;
+        }
+
+        iterator find(const key_type& key)
+        {
+            return iterator_at(find_index(key, _hash(key)));
+        }
+
+        const_iterator find(const key_type& key) const
+        {
+            return const_cast<flat_hash_map*>(this)->find(key);
+        }
+
+        /**
+         * @brief Finds an element by any key type Hash and KeyEqual accept, e.g. a string view or C string.
+         */
+        template <typename K, typename = enable_transparent<K>>
+        iterator find(const K& key)
+        {
+            return iterator_at(find_index(key, _hash(key)));
+        }
+
+        template <typename K, typename = enable_transparent<K>>
+        const_iterator find(const K& key) const
+        {
+            return const_cast<flat_hash_map*>(this)->find(key);
+        }
+
+        size_type count(const key_type& key) const
+        {
+            return contains(key) ? 1 : 0;
+        }
+
+        template <typename K, typename = enable_transparent<K>>
+        size_type count(const K& key) const
+        {
+            return contains(key) ? 1 : 0;
+        }
+
+        bool contains(const key_type& key) const
+        {
+            return find_index(key, _hash(key)) != npos;
+        }
+
+        template <typename K, typename = enable_transparent<K>>
+        bool contains(const K& key) const
+        {
+            return find_index(key, _hash(key)) != npos;
+        }
+
+        std::pair<iterator, iterator> equal_range(const key_type& key)
+        {
+            return range_at(find(key));
+        }
+
+        std::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+        {
+            return const_cast<flat_hash_map*>(this)->equal_range(key);
+        }
+
+        /**
+         * @brief Number of slots. Every slot is its own bucket.
+         */
+        size_type bucket_count() const noexcept
+        {
+            return _capacity;
+        }
+
+        float load_factor() const noexcept
+        {
+            return _capacity ? static_cast<float>(_size) / static_cast<float>(_capacity) : 0.0f;
+        }
+
+        /**
+         * @brief The table grows once 7/8 of its slots are in use; the limit is fixed.
+         */
+        float max_load_factor() const noexcept
+        {
+            return 0.875f;
+        }
+
+        /**
+         * @brief Rebuilds the table with at least count slots and room for the current elements, dropping tombstones.
+         */
+        void rehash(size_type count)
+        {
+            const size_type needed = _size ? capacity_for(_size) : 0;
+            size_type capacity = count ? capacity_for_slots(count) : 0;
+            if (capacity < needed)
+                capacity = needed;
+            if (capacity == 0)
+            {
+                deallocate(_ctrl, _slots, _capacity);
+                _ctrl = nullptr;
+                _slots = nullptr;
+                _capacity = _growth_left = 0;
+            }
+            else if (capacity != _capacity || _growth_left != _capacity / 8 * 7 - _size)
+            {
+                resize(capacity);
+            }
+        }
+
+        /**
+         * @brief Makes room for count elements without growing again.
+         */
+        void reserve(size_type count)
+        {
+            if (count > _size + _growth_left)
+                resize(capacity_for(count));
+        }
+
+        hasher hash_function() const
+        {
+            return _hash;
+        }
+
+        key_equal key_eq() const
+        {
+            return _equal;
+        }
+
+        allocator_type get_allocator() const
+        {
+            return _alloc;
+        }
+
+        friend bool operator==(const flat_hash_map& lhs, const flat_hash_map& rhs)
+        {
+            if (lhs._size != rhs._size)
+                return false;
+            for (const value_type& value : lhs)
+            {
+                const_iterator it = rhs.find(value.first);
+                if (it == rhs.end() || !(it->second == value.second))
+                    return false;
+            }
+            return true;
+        }
+
+        friend bool operator!=(const flat_hash_map& lhs, const flat_hash_map& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        friend void swap(flat_hash_map& lhs, flat_hash_map& rhs) noexcept
+        {
+            lhs.swap(rhs);
+        }
+
+      private:
+        /**
+         * @brief Smallest power-of-two slot count, at least one group, that is at least count.
+         */
+        static size_type capacity_for_slots(size_type count) noexcept
+        {
+            size_type capacity = detail::flat_group_width;
+            while (capacity < count)
+                capacity *= 2;
+            return capacity;
+        }
+
+        /**
+         * @brief Slot count that holds count elements within the load factor.
+         */
+        static size_type capacity_for(size_type count) noexcept
+        {
+            size_type capacity = detail::flat_group_width;
+            while (capacity / 8 * 7 < count)
+                capacity *= 2;
+            return capacity;
+        }
+
+        iterator iterator_at(size_type index) noexcept
+        {
+            return index == npos ? end() : iterator(_ctrl + index, _slots + index);
+        }
+
+        std::pair<iterator, iterator> range_at(iterator it) noexcept
+        {
+            if (it == end())
+                return std::pair<iterator, iterator>(it, it);
+            iterator next(it);
+            return std::pair<iterator, iterator>(it, ++next);
+        }
+
+        template <typename K>
+        size_type find_index(const K& key, std::size_t hash) const
+        {
+            if (_capacity == 0)
+                return npos;
+            const detail::flat_ctrl h2 = detail::flat_h2(hash);
+            const size_type mask = _capacity / detail::flat_group_width - 1;
+            size_type group = detail::flat_h1(hash) & mask;
+            // Triangular steps over a power-of-two number of groups visit every group
+            for (size_type step = 1;; ++step)
+            {
+                const detail::flat_ctrl* ctrl = _ctrl + group * detail::flat_group_width;
+                for (std::uint32_t match = detail::flat_match(ctrl, h2); match; match &= match - 1)
+                {
+                    const size_type index = group * detail::flat_group_width + detail::count_trailing_zeros(match);
+                    slot& s = _slots[index];
+                    if (s.hash == hash && _equal(s.value().first, key))
+                        return index;
+                }
+                if (detail::flat_match_empty(ctrl))
+                    return npos;
+                group = (group + step) & mask;
+            }
+        }
+
+        /**
+         * @brief First empty or deleted slot on the probe sequence of hash. The table must not be full.
+         */
+        size_type find_free(std::size_t hash) const noexcept
+        {
+            const size_type mask = _capacity / detail::flat_group_width - 1;
+            size_type group = detail::flat_h1(hash) & mask;
+            for (size_type step = 1;; ++step)
+            {
+                const std::uint32_t free = detail::flat_match_free(_ctrl + group * detail::flat_group_width);
+                if (free)
+                    return group * detail::flat_group_width + detail::count_trailing_zeros(free);
+                group = (group + step) & mask;
+            }
+        }
+
+        template <typename K, typename... Args>
+        std::pair<iterator, bool> try_emplace_key(K&& key, Args&&... args)
+        {
+            const std::size_t hash = _hash(key);
+            const size_type found = find_index(key, hash);
+            if (found != npos)
+                return std::pair<iterator, bool>(iterator_at(found), false);
+            const size_type index =
+                emplace_new(hash, std::piecewise_construct, std::forward_as_tuple(std::forward<K>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+            return std::pair<iterator, bool>(iterator_at(index), true);
+        }
+
+        /**
+         * @brief Constructs an element whose key is known not to be present and returns its slot.
+         */
+        template <typename... Args>
+        size_type emplace_new(std::size_t hash, Args&&... args)
+        {
+            if (_capacity == 0)
+                resize(capacity_for(1));
+            size_type index = find_free(hash);
+            if (_growth_left == 0 && _ctrl[index] == detail::flat_empty)
+            {
+                // Reuse the slots taken by tombstones before growing
+                resize(_size + 1 > _capacity / 16 * 7 ? _capacity * 2 : _capacity);
+                index = find_free(hash);
+            }
+            value_traits::construct(_alloc, &_slots[index].value(), std::forward<Args>(args)...);
+            if (_ctrl[index] == detail::flat_empty)
+                --_growth_left;
+            _ctrl[index] = detail::flat_h2(hash);
+            _slots[index].hash = hash;
+            ++_size;
+            return index;
+        }
+
+        void erase_at(size_type index) noexcept
+        {
+            value_traits::destroy(_alloc, &_slots[index].value());
+            --_size;
+            // A probe stops at a group with an empty slot, so no other key probes past this group
+            const detail::flat_ctrl* group = _ctrl + index / detail::flat_group_width * detail::flat_group_width;
+            if (detail::flat_match_empty(group))
+            {
+                _ctrl[index] = detail::flat_empty;
+                ++_growth_left;
+            }
+            else
+            {
+                _ctrl[index] = detail::flat_deleted;
+            }
+        }
+
+        template <typename K>
+        size_type erase_key(const K& key)
+        {
+            const size_type index = find_index(key, _hash(key));
+            if (index == npos)
+                return 0;
+            erase_at(index);
+            return 1;
+        }
+
+        template <typename K>
+        T& at_key(const K& key)
+        {
+            const size_type index = find_index(key, _hash(key));
+            if (index == npos)
+                throw std::out_of_range("swe::flat_hash_map::at: key not found");
+            return _slots[index].value().second;
+        }
+
+        void resize(size_type capacity)
+        {
+            ctrl_allocator ctrl_alloc(_alloc);
+            slot_allocator slot_alloc(_alloc);
+            detail::flat_ctrl* old_ctrl = _ctrl;
+            slot* old_slots = _slots;
+            const size_type old_capacity = _capacity;
+
+            _slots = std::allocator_traits<slot_allocator>::allocate(slot_alloc, capacity);
+            try
+            {
+                _ctrl = std::allocator_traits<ctrl_allocator>::allocate(ctrl_alloc, capacity + 1);
+            }
+            catch (...)
+            {
+                std::allocator_traits<slot_allocator>::deallocate(slot_alloc, _slots, capacity);
+                _slots = old_slots;
+                throw;
+            }
+            _capacity = capacity;
+            reset_ctrl();
+            _growth_left -= _size;
+
+            // The cached hashes place the elements without hashing their keys again
+            for (size_type i = 0; i < old_capacity; ++i)
+            {
+                if (old_ctrl[i] < 0)
+                    continue;
+                slot& from = old_slots[i];
+                const size_type index = find_free(from.hash);
+                value_traits::construct(_alloc, &_slots[index].value(), std::move(const_cast<key_type&>(from.value().first)), std::move(from.value().second));
+                value_traits::destroy(_alloc, &from.value());
+                _ctrl[index] = detail::flat_h2(from.hash);
+                _slots[index].hash = from.hash;
+            }
+            deallocate(old_ctrl, old_slots, old_capacity);
+        }
+
+        /**
+         * @brief Marks every slot empty; the caller accounts for the elements.
+         */
+        void reset_ctrl() noexcept
+        {
+            _growth_left = _capacity / 8 * 7;
+            if (_capacity == 0)
+                return;
+            for (size_type i = 0; i < _capacity; ++i)
+                _ctrl[i] = detail::flat_empty;
+            _ctrl[_capacity] = detail::flat_sentinel;
+        }
+
+        void destroy_all() noexcept
+        {
+            for (size_type i = 0; i < _capacity; ++i)
+            {
+                if (_ctrl[i] >= 0)
+                    value_traits::destroy(_alloc, &_slots[i].value());
+            }
+        }
+
+        void deallocate(detail::flat_ctrl* ctrl, slot* slots, size_type capacity) noexcept
+        {
+            if (capacity == 0)
+                return;
+            ctrl_allocator ctrl_alloc(_alloc);
+            slot_allocator slot_alloc(_alloc);
+            std::allocator_traits<ctrl_allocator>::deallocate(ctrl_alloc, ctrl, capacity + 1);
+            std::allocator_traits<slot_allocator>::deallocate(slot_alloc, slots, capacity);
+        }
+
+        detail::flat_ctrl* _ctrl;
+        slot* _slots;
+        size_type _capacity;
+        size_type _size;
+        size_type _growth_left;
+        Hash _hash;
+        KeyEqual _equal;
+        Alloc _alloc;
+    };
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    constexpr typename flat_hash_map<Key, T, Hash, KeyEqual, Alloc>::size_type flat_hash_map<Key, T, Hash, KeyEqual, Alloc>::npos;
+
+    /**
+     * @brief Case-insensitive flat hash map with std::string keys; a drop-in for unordered_ci_map.
+     * @tparam T Value type.
+     * @tparam Alloc Allocator type.
+     */
+    template <typename T, typename Alloc = std::allocator<std::pair<const std::string, T>>>
+    using flat_ci_map = flat_hash_map<std::string, T, ci_hash, ci_equal, Alloc>;
+
+    /**
+     * @brief Flat hash map with std::string keys that ignores the case of ASCII letters only; a drop-in for unordered_ci_ascii_map.
+     * @tparam T Value type.
+     * @tparam Alloc Allocator type.
+     */
+    template <typename T, typename Alloc = std::allocator<std::pair<const std::string, T>>>
+    using flat_ci_ascii_map = flat_hash_map<std::string, T, ci_ascii_hash, ci_ascii_equal, Alloc>;
+
+    /**
+     * @brief Case-insensitive flat hash map with std::wstring keys; a drop-in for unordered_wci_map.
+     * @tparam T Value type.
+     * @tparam Alloc Allocator type.
+     */
+    template <typename T, typename Alloc = std::allocator<std::pair<const std::wstring, T>>>
+    using flat_wci_map = flat_hash_map<std::wstring, T, wci_hash, wci_equal, Alloc>;
+
+} // namespace swe
@@ -0,0 +1,402 @@
+/**
+ * @file frozen_ci_map.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Immutable case-insensitive map over a fixed set of ASCII keys, built with a perfect hash.
+ *
+ * This header provides swe::frozen_ci_map for keyword sets that are known up front, such as HTTP header
+ * names or command keywords. The keys are placed by a two-level perfect hash: the folded hash of a key
+ * selects a bucket, and the bucket's displacement selects a slot no other key uses. A lookup is one pass
+ * over the key to hash it, one slot and one comparison, and there is no allocation or hashing at startup.
+ *
+ * In C++14 and later make_frozen_ci_map() runs at compile time, so a constexpr map is a constant in the
+ * binary. In C++11 the same function runs at run time; for a constant table, generate its initializer
+ * with tools/generate_frozen_ci_map.py instead.
+ *
+ * Keys must be ASCII. Lookups accept any UTF-8 text and match like ci_equal, so U+212A KELVIN SIGN
+ * finds the key "k".
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "ascii.hpp"
+#include "string_view.hpp"
+#include "detail/config.hpp"
+#include "detail/unicode_case.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+namespace swe
+{
+    namespace detail
+    {
+        constexpr std::uint64_t frozen_seed = 0x9E3779B97F4A7C15ull;
+        constexpr std::uint64_t frozen_multiplier = 0xBF58476D1CE4E5B9ull;
+        constexpr std::uint64_t frozen_step = 0x94D049BB133111EBull;
+
+        /**
+         * @brief Size of an empty slot, which no key can have.
+         */
+        constexpr std::size_t frozen_no_key = static_cast<std::size_t>(-1);
+
+        /**
+         * @brief Highest bucket displacement make_frozen_ci_map tries before giving up.
+         */
+        constexpr std::int32_t frozen_max_displacement = 1 << 16;
+
+        /**
+         * @brief Number of slots and buckets for count keys: the next power of two.
+         */
+        constexpr std::size_t frozen_table_size(std::size_t count, std::size_t size = 1) noexcept
+        {
+            return size >= count ? size : frozen_table_size(count, size * 2);
+        }
+
+        inline SWE_CONSTEXPR14 std::uint64_t frozen_finish(std::uint64_t hash) noexcept
+        {
+            hash ^= hash >> 33;
+            hash *= 0xFF51AFD7ED558CCDull;
+            hash ^= hash >> 33;
+            hash *= 0xC4CEB9FE1A85EC53ull;
+            hash ^= hash >> 33;
+            return hash;
+        }
+
+        inline SWE_CONSTEXPR14 std::uint64_t frozen_mix(std::uint64_t hash, std::uint64_t word) noexcept
+        {
+            hash = (hash ^ word) * frozen_multiplier;
+            return hash ^ (hash >> 31);
+        }
+
+        /**
+         * @brief Up to eight bytes of data as a word with ASCII letters folded, the first byte lowest.
+         */
+        inline SWE_CONSTEXPR14 std::uint64_t frozen_word(const char* data, std::size_t count) noexcept
+        {
+            std::uint64_t word = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                unsigned c = static_cast<unsigned char>(data[i]);
+                if (c - 'A' < 26u)
+                    c |= 0x20;
+                word |= static_cast<std::uint64_t>(c) << (8 * i);
+            }
+            return word;
+        }
+
+        /**
+         * @brief Folded hash of an ASCII key, usable in constant expressions from C++14.
+         */
+        inline SWE_CONSTEXPR14 std::uint64_t frozen_hash(const char* data, std::size_t count) noexcept
+        {
+            std::uint64_t hash = frozen_seed;
+            std::size_t i = 0;
+            for (; i + 8 <= count; i += 8)
+                hash = frozen_mix(hash, frozen_word(data + i, 8));
+            if (i < count)
+                hash = frozen_mix(hash, frozen_word(data + i, count - i));
+            return frozen_finish(hash + count);
+        }
+
+        /**
+         * @brief Run-time form of frozen_hash that folds eight bytes at a time.
+         * @return False, leaving hash unset, if data contains a byte beyond ASCII.
+         */
+        inline bool frozen_hash_ascii(const char* data, std::size_t count, std::uint64_t& hash) noexcept
+        {
+#if SWE_LITTLE_ENDIAN
+            std::uint64_t state = frozen_seed;
+            std::uint64_t seen = 0;
+            std::size_t i = 0;
+            for (; i + 8 <= count; i += 8)
+            {
+                std::uint64_t word;
+                std::memcpy(&word, data + i, 8);
+                seen |= word;
+                state = frozen_mix(state, ascii_fold_word(word));
+            }
+            if (i < count)
+            {
+                std::uint64_t word = 0;
+                std::memcpy(&word, data + i, count - i);
+                seen |= word;
+                state = frozen_mix(state, ascii_fold_word(word));
+            }
+            if (seen & 0x8080808080808080ull)
+                return false;
+            hash = frozen_finish(state + count);
+            return true;
+#else
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if (static_cast<unsigned char>(data[i]) >= 0x80)
+                    return false;
+            }
+            hash = frozen_hash(data, count);
+            return true;
+#endif
+        }
+
+        /**
+         * @brief Hashes UTF-8 text by its folded code points, which must all be ASCII to match a frozen key.
+         * @return False if a code point does not fold to ASCII or a byte is invalid, so the text matches no key.
+         */
+        inline bool frozen_hash_utf8(const char* data, std::size_t count, std::uint64_t& hash) noexcept
+        {
+            std::uint64_t state = frozen_seed;
+            std::uint64_t word = 0;
+            std::size_t length = 0;
+            for (std::size_t i = 0; i < count;)
+            {
+                const utf8_decoded decoded = utf8_decode(data + i, count - i);
+                const std::uint32_t folded = decoded.valid ? fold_code_point(decoded.code_point) : 0x80;
+                if (folded >= 0x80)
+                    return false;
+                word |= static_cast<std::uint64_t>(folded) << (8 * (length % 8));
+                if (++length % 8 == 0)
+                {
+                    state = frozen_mix(state, word);
+                    word = 0;
+                }
+                i += decoded.length;
+            }
+            if (length % 8)
+                state = frozen_mix(state, word);
+            hash = frozen_finish(state + length);
+            return true;
+        }
+
+        /**
+         * @brief Slot of a key with hash in a bucket with the given displacement.
+         *
+         * A negative displacement stores the slot of a bucket's only key directly; otherwise it seeds a
+         * second hash that spreads the bucket's keys over free slots.
+         */
+        inline SWE_CONSTEXPR14 std::size_t frozen_slot(std::uint64_t hash, std::int32_t displacement, std::size_t mask) noexcept
+        {
+            return displacement < 0 ? static_cast<std::size_t>(-(displacement + 1))
+                                    : static_cast<std::size_t>(frozen_finish(hash + static_cast<std::uint64_t>(displacement) * frozen_step)) & mask;
+        }
+
+        /**
+         * @brief Slot of a frozen map: a key and its value, or frozen_no_key as size when empty.
+         */
+        template <typename T>
+        struct frozen_ci_slot
+        {
+            const char* key;
+            std::size_t size;
+            T value;
+        };
+    } // namespace detail
+
+    /**
+     * @brief Key and value used to build a frozen_ci_map.
+     * @tparam T Value type.
+     */
+    template <typename T>
+    struct frozen_ci_entry
+    {
+        /**
+         * @brief Entry for a string literal key.
+         */
+        template <std::size_t Size>
+        constexpr frozen_ci_entry(const char (&k)[Size], const T& v) noexcept : key(k), size(Size - 1), value(v)
+        {
+        }
+
+        constexpr frozen_ci_entry(const char* k, std::size_t n, const T& v) noexcept : key(k), size(n), value(v)
+        {
+        }
+
+        const char* key;
+        std::size_t size;
+        T value;
+    };
+
+    /**
+     * @brief Immutable case-insensitive map from N ASCII keys to values of type T.
+     *
+     * Build one with make_frozen_ci_map() or tools/generate_frozen_ci_map.py. The keys are not copied, so
+     * they must outlive the map (string literals do). The tables are public only so that the map stays an
+     * aggregate that generated C++11 code can initialize as a constant; they are not part of the interface.
+     *
+     * @tparam T Value type.
+     * @tparam N Number of keys.
+     */
+    template <typename T, std::size_t N>
+    class frozen_ci_map
+    {
+        static_assert(N > 0, "a frozen_ci_map needs at least one key");
+
+      public:
+        using mapped_type = T;
+        using size_type = std::size_t;
+
+        /**
+         * @brief Number of slots, and of buckets, in the tables.
+         */
+        static constexpr size_type table_size = detail::frozen_table_size(N);
+
+        /**
+         * @brief Finds the value of key, ignoring case as ci_equal does.
+         * @return Pointer to the value, or nullptr if key is not in the map.
+         */
+        const T* find(string_view key) const noexcept
+        {
+            std::uint64_t hash;
+            if (detail::frozen_hash_ascii(key.data(), key.size(), hash))
+            {
+                const detail::frozen_ci_slot<T>& slot = slot_of(hash);
+                return slot.size == key.size() && detail::ascii_equal_ignore_case(slot.key, key.data(), key.size()) ? &slot.value : nullptr;
+            }
+            // Text beyond ASCII can still match through U+017F and U+212A, which fold to 's' and 'k'
+            if (!detail::frozen_hash_utf8(key.data(), key.size(), hash))
+                return nullptr;
+            const detail::frozen_ci_slot<T>& slot = slot_of(hash);
+            return slot.size != detail::frozen_no_key && detail::utf8_match_folded(key.data(), key.size(), slot.key, slot.size) == key.size()
+                       ? &slot.value
+                       : nullptr;
+        }
+
+        bool contains(string_view key) const noexcept
+        {
+            return find(key) != nullptr;
+        }
+
+        size_type count(string_view key) const noexcept
+        {
+            return contains(key) ? 1 : 0;
+        }
+
+        /**
+         * @brief Returns the value of key.
+         * @throws std::out_of_range if key is not in the map.
+         */
+        const T& at(string_view key) const
+        {
+            const T* value = find(key);
+            if (!value)
+                throw std::out_of_range("swe::frozen_ci_map::at: key not found");
+            return *value;
+        }
+
+        constexpr size_type size() const noexcept
+        {
+            return N;
+        }
+
+        detail::frozen_ci_slot<T> _slots[table_size];
+        std::int32_t _displacement[table_size];
+
+      private:
+        const detail::frozen_ci_slot<T>& slot_of(std::uint64_t hash) const noexcept
+        {
+            const size_type mask = table_size - 1;
+            return _slots[detail::frozen_slot(hash, _displacement[hash & mask], mask)];
+        }
+    };
+
+    template <typename T, std::size_t N>
+    constexpr typename frozen_ci_map<T, N>::size_type frozen_ci_map<T, N>::table_size;
+
+    /**
+     * @brief Builds a frozen_ci_map from its entries; a compile-time constant in C++14 and later.
+     *
+     * Buckets are placed largest first, each with the first displacement that sends all of its keys to
+     * free slots. Buckets of one key then take the remaining slots directly.
+     *
+     * @param entries Keys and values, e.g. {{"Accept", 1}, {"Content-Type", 2}}.
+     * @throws std::invalid_argument if a key is not ASCII or two keys are equal ignoring case; in a
+     * constant expression this is a compile error instead.
+     */
+    template <typename T, std::size_t N>
+    SWE_CONSTEXPR14 frozen_ci_map<T, N> make_frozen_ci_map(const frozen_ci_entry<T> (&entries)[N])
+    {
+        using map_type = frozen_ci_map<T, N>;
+        const std::size_t mask = map_type::table_size - 1;
+        map_type map{};
+        std::uint64_t hashes[N] = {};
+        std::size_t bucket_sizes[map_type::table_size] = {};
+        bool taken[map_type::table_size] = {};
+        std::size_t members[N] = {};
+        std::size_t slots[N] = {};
+
+        for (std::size_t i = 0; i < map_type::table_size; ++i)
+            map._slots[i] = detail::frozen_ci_slot<T>{nullptr, detail::frozen_no_key, T()};
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            for (std::size_t j = 0; j < entries[i].size; ++j)
+            {
+                if (static_cast<unsigned char>(entries[i].key[j]) >= 0x80)
+                    throw std::invalid_argument("swe::make_frozen_ci_map: keys must be ASCII");
+            }
+            hashes[i] = detail::frozen_hash(entries[i].key, entries[i].size);
+            // Equal keys hash equal; a full 64-bit collision of different keys is just as unplaceable
+            for (std::size_t j = 0; j < i; ++j)
+            {
+                if (hashes[j] == hashes[i])
+                    throw std::invalid_argument("swe::make_frozen_ci_map: duplicate key");
+            }
+            ++bucket_sizes[hashes[i] & mask];
+        }
+
+        for (std::size_t size = N; size >= 2; --size)
+        {
+            for (std::size_t bucket = 0; bucket < map_type::table_size; ++bucket)
+            {
+                if (bucket_sizes[bucket] != size)
+                    continue;
+                std::size_t count = 0;
+                for (std::size_t i = 0; i < N; ++i)
+                {
+                    if ((hashes[i] & mask) == bucket)
+                        members[count++] = i;
+                }
+                std::int32_t displacement = 0;
+                for (;; ++displacement)
+                {
+                    if (displacement == detail::frozen_max_displacement)
+                        throw std::invalid_argument("swe::make_frozen_ci_map: no perfect hash found");
+                    bool placed = true;
+                    for (std::size_t k = 0; k < count && placed; ++k)
+                    {
+                        slots[k] = detail::frozen_slot(hashes[members[k]], displacement, mask);
+                        placed = !taken[slots[k]];
+                        for (std::size_t m = 0; m < k && placed; ++m)
+                            placed = slots[m] != slots[k];
+                    }
+                    if (placed)
+                        break;
+                }
+                map._displacement[bucket] = displacement;
+                for (std::size_t k = 0; k < count; ++k)
+                {
+                    const frozen_ci_entry<T>& entry = entries[members[k]];
+                    taken[slots[k]] = true;
+                    map._slots[slots[k]] = detail::frozen_ci_slot<T>{entry.key, entry.size, entry.value};
+                }
+            }
+        }
+
+        std::size_t next_free = 0;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            const std::size_t bucket = hashes[i] & mask;
+            if (bucket_sizes[bucket] != 1)
+                continue;
+            while (taken[next_free])
+                ++next_free;
+            taken[next_free] = true;
+            map._displacement[bucket] = -static_cast<std::int32_t>(next_free + 1);
+            map._slots[next_free] = detail::frozen_ci_slot<T>{entries[i].key, entries[i].size, entries[i].value};
+        }
+        return map;
+    }
+
+} // namespace swe
@@ -0,0 +1,556 @@
+/**
+ * @file replacer.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Multi-pattern string replacement for the SWE library.
+ *
+ * This header provides swe::basic_replacer, a precompiled set of (pattern, replacement) pairs
+ * that substitutes every pattern in a single pass over the input. The patterns are compiled once
+ * into an Aho-Corasick automaton, so the cost of a replacement no longer grows with the number of
+ * patterns the way chained str_replace calls do, and stays linear in the input whatever the patterns
+ * are. Matching can be case-sensitive or case-insensitive; narrow text is matched case-insensitively by
+ * UTF-8 code point, like the other ordinal_ignore_case utilities.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "string.hpp"
+#include "string_view.hpp"
+#include "detail/case_fold.hpp"
+#include "detail/unicode_case.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace swe
+{
+    /**
+     * @brief Precompiled multi-pattern replacer.
+     *
+     * Matches are resolved leftmost-longest: scanning from the start of the input, the match that starts
+     * first wins, and among matches starting at the same position the longest pattern wins. Matches never
+     * overlap and replaced text is not scanned again. If the same pattern is given more than once, the first
+     * replacement is used. Empty patterns are ignored.
+     *
+     * With string_compare_type::ordinal_ignore_case, narrow patterns and text are folded by UTF-8 code point as in
+     * str_equals, so a match may be shorter or longer in bytes than its pattern. A pattern's length is then counted
+     * in code points wherever the replacement is compared with it below.
+     *
+     * A replacer is immutable once built, so a single instance can be shared between threads.
+     *
+     * @tparam CharT Character type.
+     * @tparam Traits Character traits type.
+     */
+    template <typename CharT, typename Traits = std::char_traits<CharT>>
+    class basic_replacer
+    {
+      public:
+        using view_type = basic_string_view<CharT, Traits>;
+        using string_type = std::basic_string<CharT, Traits>;
+        using size_type = std::size_t;
+
+        /**
+         * @brief Builds a replacer from a list of (pattern, replacement) pairs.
+         * @param pairs Patterns and their replacements.
+         * @param compare_type Whether patterns match case-sensitively or case-insensitively.
+         */
+        basic_replacer(std::initializer_list<std::pair<view_type, view_type>> pairs, string_compare_type compare_type = string_compare_type::ordinal)
+            : _compare_type(compare_type), _utf8(std::is_same<CharT, char>::value && compare_type == string_compare_type::ordinal_ignore_case),
+              _max_growth(0), _max_span(0)
+        {
+            build(pairs.begin(), pairs.end());
+        }
+
+        /**
+         * @brief Builds a replacer from a range of pair-like (pattern, replacement) elements.
+         * @param first Iterator to the first pair. Both members must be convertible to a string view.
+         * @param last Iterator past the last pair.
+         * @param compare_type Whether patterns match case-sensitively or case-insensitively.
+         */
+        template <typename InputIt>
+        basic_replacer(InputIt first, InputIt last, string_compare_type compare_type = string_compare_type::ordinal)
+            : _compare_type(compare_type), _utf8(std::is_same<CharT, char>::value && compare_type == string_compare_type::ordinal_ignore_case),
+              _max_growth(0), _max_span(0)
+        {
+            build(first, last);
+        }
+
+        /**
+         * @brief Number of distinct patterns in the replacer.
+         */
+        size_type size() const noexcept
+        {
+            return _patterns.size();
+        }
+
+        /**
+         * @brief Checks whether the replacer has no patterns.
+         */
+        bool empty() const noexcept
+        {
+            return _patterns.empty();
+        }
+
+        /**
+         * @brief Counts the replacements that replace() would make.
+         * @param str Input string.
+         * @return Number of non-overlapping matches.
+         */
+        size_type count(view_type str) const
+        {
+            size_type result = 0;
+            scan(str, [&result](size_type, size_type, size_type) { ++result; });
+            return result;
+        }
+
+        /**
+         * @brief Replaces every pattern in a string.
+         *
+         * The output is allocated once. If no replacement is longer than its pattern the matches are applied
+         * in the same pass that finds them; otherwise the exact output length is computed first.
+         *
+         * @param str Input string.
+         * @return Copy of str with all replacements applied.
+         */
+        string_type replace(view_type str) const
+        {
+            string_type result(output_capacity(str), CharT());
+            const size_type length = write(str, &result[0]);
+            result.resize(length);
+            return result;
+        }
+
+        /**
+         * @brief Replaces every pattern in a string in place.
+         *
+         * When no replacement is longer than its pattern the string is rewritten within its own buffer without
+         * allocating; otherwise the result is built once at its exact size and swapped in.
+         *
+         * @param str String to modify.
+         */
+        void replace_inplace(string_type& str) const
+        {
+            if (_max_growth == 0)
+            {
+                // Writes never overtake the read position, so the buffer can be its own output
+                str.resize(write(str, &str[0]));
+                return;
+            }
+            string_type result = replace(str);
+            str.swap(result);
+        }
+
+      private:
+        static const std::uint32_t no_match = 0xFFFFFFFFu;
+
+        // Positions scan() resolves per backward pass, unless the longest pattern needs more
+        static const size_type scan_block = 512;
+
+        struct pattern
+        {
+            size_type length; // In symbols, see fold_symbol()
+            size_type replacement_offset;
+            size_type replacement_length;
+        };
+
+        struct node
+        {
+            std::uint32_t fail;        // Longest proper suffix that is also a trie node
+            std::uint32_t edges_begin; // Range of this node's children in _edges
+            std::uint32_t edges_end;
+            std::uint32_t match;       // Longest pattern whose reversal is a suffix of this node, or no_match
+        };
+
+        struct candidate
+        {
+            size_type start;       // Position of the candidate match
+            std::uint32_t pattern; // Longest pattern starting there
+        };
+
+        struct edge
+        {
+            CharT label;
+            std::uint32_t target;
+        };
+
+        /**
+         * @brief Folds a character of text that is matched one character at a time.
+         *
+         * Narrow text matched with ordinal_ignore_case is folded by code point instead, see fold_symbol(); its
+         * ASCII characters fold as they do here.
+         */
+        CharT fold(CharT c) const noexcept
+        {
+            if (_compare_type == string_compare_type::ordinal)
+                return c;
+            if (_compare_type == string_compare_type::ordinal_ignore_case_ascii || sizeof(CharT) == 1)
+                return detail::fold_case_ascii(c);
+            return static_cast<CharT>(detail::fold_case(static_cast<wchar_t>(c)));
+        }
+
+        /**
+         * @brief Writes the folded form of the symbol of str starting at begin to folded and returns its length in str.
+         *
+         * A symbol is a single character, except in narrow text matched with ordinal_ignore_case, where it is a
+         * code point and folds to up to four bytes of UTF-8. An invalid byte folds to two bytes led by 0xFA or
+         * 0xFB, which UTF-8 never contains, so it only matches itself and no match begins inside a sequence.
+         */
+        size_type fold_symbol(view_type str, size_type begin, CharT* folded, size_type& folded_count) const noexcept
+        {
+            if (_utf8)
+                return fold_utf8(str, begin, folded, folded_count, std::is_same<CharT, char>());
+            folded[0] = fold(str[begin]);
+            folded_count = 1;
+            return 1;
+        }
+
+        static size_type fold_utf8_symbol(const detail::utf8_decoded& decoded, char* folded) noexcept
+        {
+            if (!decoded.valid)
+            {
+                folded[0] = static_cast<char>(0xF8 | (decoded.code_point >> 6));
+                folded[1] = static_cast<char>(0x80 | (decoded.code_point & 0x3F));
+                return 2;
+            }
+            const std::uint32_t cp = detail::fold_code_point(decoded.code_point);
+            detail::utf8_encode(cp, folded);
+            return detail::utf8_length(cp);
+        }
+
+        size_type fold_utf8(view_type str, size_type begin, char* folded, size_type& folded_count, std::true_type) const noexcept
+        {
+            const detail::utf8_decoded decoded = detail::utf8_decode(str.data() + begin, str.size() - begin);
+            folded_count = fold_utf8_symbol(decoded, folded);
+            return decoded.length;
+        }
+
+        // As fold_utf8() for the code point that ends at end
+        size_type fold_utf8_backward(view_type str, size_type end, char* folded, size_type& folded_count, std::true_type) const noexcept
+        {
+            const detail::utf8_decoded decoded = detail::utf8_decode_backward(str.data(), end);
+            folded_count = fold_utf8_symbol(decoded, folded);
+            return decoded.length;
+        }
+
+        // Only narrow text is folded by code point; wider text is never in UTF-8 mode and folds one character
+        size_type fold_utf8(view_type str, size_type begin, CharT* folded, size_type& folded_count, std::false_type) const noexcept
+        {
+            folded[0] = fold(str[begin]);
+            folded_count = 1;
+            return 1;
+        }
+
+        size_type fold_utf8_backward(view_type str, size_type end, CharT* folded, size_type& folded_count, std::false_type) const noexcept
+        {
+            folded[0] = fold(str[end - 1]);
+            folded_count = 1;
+            return 1;
+        }
+
+        /**
+         * @brief End of a match of the pattern at index that starts at start.
+         */
+        size_type match_end(view_type str, size_type start, std::uint32_t index) const noexcept
+        {
+            const size_type length = _patterns[index].length;
+            if (!_utf8)
+                return start + length;
+            CharT folded[4];
+            size_type folded_count;
+            for (size_type i = 0; i < length; ++i)
+                start += fold_symbol(str, start, folded, folded_count);
+            return start;
+        }
+
+        template <typename InputIt>
+        void build(InputIt first, InputIt last)
+        {
+            // Build the trie of the reversed patterns with per-node child lists
+            std::vector<std::vector<std::pair<CharT, std::uint32_t>>> children(1);
+            std::vector<std::uint32_t> terminal(1, no_match);
+
+            for (; first != last; ++first)
+            {
+                const view_type from = first->first;
+                const view_type to = first->second;
+                if (from.empty())
+                    continue;
+
+                std::vector<CharT> labels;
+                size_type symbols = 0;
+                for (size_type i = 0; i < from.size(); ++symbols)
+                {
+                    CharT folded[4];
+                    size_type folded_count;
+                    i += fold_symbol(from, i, folded, folded_count);
+                    labels.insert(labels.end(), folded, folded + folded_count);
+                }
+
+                std::uint32_t state = 0;
+                for (size_type i = labels.size(); i-- > 0;)
+                {
+                    const CharT label = labels[i];
+                    std::uint32_t next = no_match;
+                    for (const auto& child : children[state])
+                        if (Traits::eq(child.first, label))
+                            next = child.second;
+                    if (next == no_match)
+                    {
+                        next = static_cast<std::uint32_t>(children.size());
+                        children[state].emplace_back(label, next);
+                        children.emplace_back();
+                        terminal.push_back(no_match);
+                    }
+                    state = next;
+                }
+
+                if (terminal[state] != no_match)
+                    continue; // duplicate pattern, the first replacement wins
+
+                terminal[state] = static_cast<std::uint32_t>(_patterns.size());
+                pattern p = {symbols, _replacements.size(), to.size()};
+                _patterns.push_back(p);
+                _replacements.append(to.data(), to.size());
+                // A folded code point matches one to four bytes, so a match covers at least one byte per symbol
+                _max_span = (std::max)(_max_span, _utf8 ? 4 * symbols : symbols);
+                if (to.size() > symbols)
+                    _max_growth = (std::max)(_max_growth, to.size() - symbols);
+            }
+
+            // Flatten the children into sorted edge ranges
+            _nodes.resize(children.size());
+            for (size_type i = 0; i < children.size(); ++i)
+            {
+                std::sort(children[i].begin(), children[i].end(),
+                          [](const std::pair<CharT, std::uint32_t>& a, const std::pair<CharT, std::uint32_t>& b) { return Traits::lt(a.first, b.first); });
+                _nodes[i].edges_begin = static_cast<std::uint32_t>(_edges.size());
+                for (const auto& child : children[i])
+                {
+                    edge e = {child.first, child.second};
+                    _edges.push_back(e);
+                }
+                _nodes[i].edges_end = static_cast<std::uint32_t>(_edges.size());
+                _nodes[i].fail = 0;
+                _nodes[i].match = terminal[i];
+            }
+
+            // Breadth-first pass computing failure links and the longest pattern suffix of every node
+            std::vector<std::uint32_t> queue;
+            queue.reserve(_nodes.size());
+            for (std::uint32_t e = _nodes[0].edges_begin; e != _nodes[0].edges_end; ++e)
+                queue.push_back(_edges[e].target);
+            for (size_type head = 0; head < queue.size(); ++head)
+            {
+                const std::uint32_t state = queue[head];
+                node& current = _nodes[state];
+                if (current.match == no_match)
+                    current.match = _nodes[current.fail].match;
+                for (std::uint32_t e = current.edges_begin; e != current.edges_end; ++e)
+                {
+                    const std::uint32_t child = _edges[e].target;
+                    std::uint32_t fallback = current.fail;
+                    std::uint32_t target = find_edge(fallback, _edges[e].label);
+                    while (target == no_match && fallback != 0)
+                    {
+                        fallback = _nodes[fallback].fail;
+                        target = find_edge(fallback, _edges[e].label);
+                    }
+                    _nodes[child].fail = target == no_match || target == child ? 0 : target;
+                    queue.push_back(child);
+                }
+            }
+
+            // Narrow alphabets get a dense root row
+            if (sizeof(CharT) == 1)
+            {
+                _root.assign(256, 0);
+                for (std::uint32_t e = _nodes[0].edges_begin; e != _nodes[0].edges_end; ++e)
+                    _root[static_cast<unsigned char>(_edges[e].label)] = _edges[e].target;
+            }
+        }
+
+        std::uint32_t find_edge(std::uint32_t state, CharT c) const noexcept
+        {
+            const node& n = _nodes[state];
+            const edge* begin = _edges.data() + n.edges_begin;
+            const edge* end = _edges.data() + n.edges_end;
+            if (end - begin <= 8)
+            {
+                for (; begin != end; ++begin)
+                    if (Traits::eq(begin->label, c))
+                        return begin->target;
+                return no_match;
+            }
+            const edge* it = std::lower_bound(begin, end, c, [](const edge& e, CharT value) { return Traits::lt(e.label, value); });
+            return it != end && Traits::eq(it->label, c) ? it->target : no_match;
+        }
+
+        std::uint32_t next_state(std::uint32_t state, CharT c) const noexcept
+        {
+            for (;;)
+            {
+                if (state == 0)
+                {
+                    if (!_root.empty())
+                        return _root[static_cast<unsigned char>(c)];
+                    const std::uint32_t target = find_edge(0, c);
+                    return target == no_match ? 0 : target;
+                }
+                const std::uint32_t target = find_edge(state, c);
+                if (target != no_match)
+                    return target;
+                state = _nodes[state].fail;
+            }
+        }
+
+        /**
+         * @brief Reports each leftmost-longest, non-overlapping match as on_match(start, end, pattern index), in order.
+         *
+         * The automaton holds the reversed patterns and runs backwards over a block of the input, so its state at
+         * each position names the longest pattern starting there; the matches are then picked from these
+         * candidates front to back. The input read past a block for patterns that cross its end is read again
+         * by the next block, and blocks are at least four times the longest pattern, so every character is read
+         * at most twice.
+         */
+        template <typename OnMatch>
+        void scan(view_type str, OnMatch on_match) const
+        {
+            if (_patterns.empty())
+                return;
+
+            candidate local[scan_block];
+            std::vector<candidate> heap;
+            candidate* candidates = local;
+            size_type block = scan_block;
+            if (_max_span > block / 4)
+            {
+                block = _max_span * 4;
+                heap.resize(block);
+                candidates = heap.data();
+            }
+
+            const unsigned skip_limit = _utf8 ? 0x80 : 0x100;
+            const size_type n = str.size();
+            size_type i = 0;
+            while (i < n)
+            {
+                // scan_end may split a UTF-8 sequence; the backward decoding realigns before block_end
+                const size_type block_end = n - i > block ? i + block : n;
+                const size_type scan_end = n - block_end > _max_span - 1 ? block_end + _max_span - 1 : n;
+
+                std::uint32_t state = 0;
+                size_type found = 0;
+                for (size_type j = scan_end; j > i;)
+                {
+                    if (state == 0 && !_root.empty())
+                    {
+                        // Skip characters that cannot end any pattern; bytes beyond ASCII can end a code point that does
+                        while (j > i && static_cast<unsigned char>(str[j - 1]) < skip_limit && _root[static_cast<unsigned char>(fold(str[j - 1]))] == 0)
+                            --j;
+                        if (j == i)
+                            break;
+                    }
+
+                    if (_utf8)
+                    {
+                        CharT folded[4];
+                        size_type folded_count;
+                        j -= fold_utf8_backward(str, j, folded, folded_count, std::is_same<CharT, char>());
+                        while (folded_count > 0)
+                            state = next_state(state, folded[--folded_count]);
+                    }
+                    else
+                    {
+                        --j;
+                        state = next_state(state, fold(str[j]));
+                    }
+                    const std::uint32_t match = _nodes[state].match;
+                    if (match != no_match && j < block_end)
+                    {
+                        candidates[found].start = j;
+                        candidates[found].pattern = match;
+                        ++found;
+                    }
+                }
+
+                // Candidates were found back to front; take each one that does not overlap the previous match
+                size_type next = i;
+                while (found > 0)
+                {
+                    const candidate& c = candidates[--found];
+                    if (c.start >= next)
+                    {
+                        next = match_end(str, c.start, c.pattern);
+                        on_match(c.start, next, static_cast<size_type>(c.pattern));
+                    }
+                }
+                i = (std::max)(next, block_end);
+            }
+        }
+
+        size_type output_capacity(view_type str) const
+        {
+            if (_max_growth == 0)
+                return str.size();
+            size_type length = str.size();
+            scan(str, [this, &length](size_type start, size_type end, size_type index) { length = length - (end - start) + _patterns[index].replacement_length; });
+            return length;
+        }
+
+        /**
+         * @brief Writes str with all replacements applied to out and returns the number of characters written.
+         * out may alias str as long as no replacement is longer than the text its pattern matches.
+         */
+        size_type write(view_type str, CharT* out) const
+        {
+            CharT* const begin = out;
+            size_type prev = 0;
+            scan(str, [this, str, &out, &prev](size_type start, size_type end, size_type index) {
+                const pattern& p = _patterns[index];
+                Traits::move(out, str.data() + prev, start - prev);
+                out += start - prev;
+                Traits::copy(out, _replacements.data() + p.replacement_offset, p.replacement_length);
+                out += p.replacement_length;
+                prev = end;
+            });
+            Traits::move(out, str.data() + prev, str.size() - prev);
+            out += str.size() - prev;
+            return static_cast<size_type>(out - begin);
+        }
+
+        string_compare_type _compare_type;
+        bool _utf8; // Narrow text folded by code point, see fold_symbol()
+        size_type _max_growth;
+        size_type _max_span; // Most characters of str a match can cover
+        std::vector<pattern> _patterns;
+        string_type _replacements;
+        std::vector<node> _nodes;
+        std::vector<edge> _edges;
+        std::vector<std::uint32_t> _root;
+    };
+
+    template <typename CharT, typename Traits>
+    const std::uint32_t basic_replacer<CharT, Traits>::no_match;
+
+    template <typename CharT, typename Traits>
+    const std::size_t basic_replacer<CharT, Traits>::scan_block;
+
+    /**
+     * @brief Multi-pattern replacer for narrow strings.
+     */
+    using replacer = basic_replacer<char>;
+
+    /**
+     * @brief Multi-pattern replacer for wide strings.
+     */
+    using wreplacer = basic_replacer<wchar_t>;
+
+} // namespace swe
\ No newline at end of file
@@ -0,0 +1,200 @@
+/**
+ * @file searcher.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Precompiled substring searcher for the SWE library.
+ *
+ * This header provides swe::basic_searcher, which preprocesses a needle once so that it can be
+ * searched for repeatedly in any number of strings. Narrow needles are located with SIMD kernels
+ * that filter candidate positions on the needle's first and last byte; where SIMD is unavailable,
+ * and for wide strings, a Boyer-Moore-Horspool skip table is used instead.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "string_view.hpp"
+#include "detail/find_kernels.hpp"
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace swe
+{
+    /**
+     * @brief Reusable, precompiled substring searcher.
+     *
+     * The searcher owns a copy of its needle, so the string it was built from may be discarded.
+     * It is immutable once built and can be shared between threads.
+     *
+     * @tparam CharT Character type.
+     * @tparam Traits Character traits type.
+     */
+    template <typename CharT, typename Traits = std::char_traits<CharT>>
+    class basic_searcher
+    {
+      public:
+        using view_type = basic_string_view<CharT, Traits>;
+        using string_type = std::basic_string<CharT, Traits>;
+        using size_type = std::size_t;
+
+        /**
+         * @brief Value returned by find() when the needle does not occur.
+         */
+        static constexpr size_type npos = size_type(-1);
+
+        /**
+         * @brief Builds a searcher for a needle.
+         * @param needle String to search for.
+         */
+        explicit basic_searcher(view_type needle) : _needle(needle.data(), needle.size()), _use_kernel(false)
+        {
+            _use_kernel = byte_sized && detail::find_dispatch() != &detail::find_scalar;
+            build_skip_table();
+        }
+
+        /**
+         * @brief The needle this searcher looks for.
+         */
+        view_type needle() const noexcept
+        {
+            return view_type(_needle.data(), _needle.size());
+        }
+
+        /**
+         * @brief Finds the first occurrence of the needle.
+         * @param str String to search in.
+         * @param pos Position at which to start searching.
+         * @return Position of the first occurrence at or after pos, or npos. An empty needle is found at pos.
+         */
+        size_type find(view_type str, size_type pos = 0) const noexcept
+        {
+            if (pos > str.size())
+                return npos;
+            const size_type found = search(str.data() + pos, str.size() - pos);
+            return found == npos ? npos : pos + found;
+        }
+
+        /**
+         * @brief Checks whether the needle occurs in a string.
+         * @param str String to search in.
+         * @return True if the needle occurs in str, false otherwise.
+         */
+        bool contains(view_type str) const noexcept
+        {
+            return find(str) != npos;
+        }
+
+        /**
+         * @brief Counts the non-overlapping occurrences of the needle, scanning from the start.
+         * @param str String to search in.
+         * @return Number of occurrences; 0 for an empty needle.
+         */
+        size_type count(view_type str) const noexcept
+        {
+            size_type result = 0;
+            for_each(str, [&result](size_type) { ++result; });
+            return result;
+        }
+
+        /**
+         * @brief Finds every non-overlapping occurrence of the needle, scanning from the start.
+         * @param str String to search in.
+         * @return Positions of the occurrences in increasing order; empty for an empty needle.
+         */
+        std::vector<size_type> find_all(view_type str) const
+        {
+            std::vector<size_type> result;
+            for_each(str, [&result](size_type pos) { result.push_back(pos); });
+            return result;
+        }
+
+        /**
+         * @brief Calls fn(position) for every non-overlapping occurrence of the needle, scanning from the start.
+         * @param str String to search in.
+         * @param fn Callable invoked with the position of each occurrence. Not called for an empty needle.
+         */
+        template <typename Fn>
+        void for_each(view_type str, Fn fn) const
+        {
+            if (_needle.empty())
+                return;
+            for (size_type pos = find(str); pos != npos; pos = find(str, pos + _needle.size()))
+                fn(pos);
+        }
+
+      private:
+        static constexpr bool byte_sized = sizeof(CharT) == 1 && std::is_same<Traits, std::char_traits<CharT>>::value;
+
+        static std::size_t skip_index(CharT c) noexcept
+        {
+            // Wide characters share the 256 entries; colliding characters keep the smallest, still safe, shift
+            return static_cast<std::size_t>(static_cast<typename std::make_unsigned<CharT>::type>(c)) & 0xFF;
+        }
+
+        void build_skip_table() noexcept
+        {
+            const size_type m = _needle.size();
+            for (size_type& shift : _skip)
+                shift = m;
+            for (size_type i = 0; i + 1 < m; ++i)
+                _skip[skip_index(_needle[i])] = m - 1 - i;
+        }
+
+        size_type search(const CharT* haystack, size_type count) const noexcept
+        {
+            const size_type m = _needle.size();
+            if (_use_kernel)
+            {
+                const std::size_t found =
+                    detail::find_bytes(reinterpret_cast<const char*>(haystack), count, reinterpret_cast<const char*>(_needle.data()), m);
+                return found == detail::find_npos ? npos : found;
+            }
+
+            if (m == 0)
+                return 0;
+            if (m > count)
+                return npos;
+            if (m == 1)
+            {
+                const CharT* found = Traits::find(haystack, count, _needle[0]);
+                return found ? static_cast<size_type>(found - haystack) : npos;
+            }
+
+            // Boyer-Moore-Horspool: compare the window's last character, then shift by the skip table
+            const CharT last = _needle[m - 1];
+            for (size_type i = 0; i <= count - m;)
+            {
+                const CharT c = haystack[i + m - 1];
+                if (Traits::eq(c, last) && Traits::compare(haystack + i, _needle.data(), m - 1) == 0)
+                    return i;
+                i += _skip[skip_index(c)];
+            }
+            return npos;
+        }
+
+        string_type _needle;
+        bool _use_kernel;
+        size_type _skip[256];
+    };
+
+    template <typename CharT, typename Traits>
+    constexpr typename basic_searcher<CharT, Traits>::size_type basic_searcher<CharT, Traits>::npos;
+
+    template <typename CharT, typename Traits>
+    constexpr bool basic_searcher<CharT, Traits>::byte_sized;
+
+    /**
+     * @brief Precompiled searcher for narrow strings.
+     */
+    using searcher = basic_searcher<char>;
+
+    /**
+     * @brief Precompiled searcher for wide strings.
+     */
+    using wsearcher = basic_searcher<wchar_t>;
+
+} // namespace swe
\ No newline at end of file
@@ -0,0 +1,898 @@
+/**
+ * @file split_view.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Lazy, allocation-free string splitting for the SWE library.
+ *
+ * This header provides swe::basic_split_view, a forward range that yields the tokens of a
+ * string as string views, computing each one only when the iterator is advanced. Nothing is
+ * copied or allocated, so looking at the first few fields of a line only costs the work needed
+ * to find them. Splitting honors the same string_split_options flags as str_split, and can be
+ * limited to a maximum number of tokens or run from the end of the string (rsplit).
+ *
+ * swe::basic_split_any_view splits on any character of a delimiter set instead, classifying the
+ * input with SIMD byte-set kernels; str_split_whitespace_view uses it to split on runs of whitespace
+ * like Python's str.split().
+ *
+ * The str_split_into family writes the tokens, as views or as (offset, length) slices, into
+ * caller-owned storage instead, for hot loops that must not touch the heap.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "char_set.hpp"
+#include "string_options.hpp"
+#include "string_view.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace swe
+{
+    /**
+     * @brief Direction in which a split_view walks its input.
+     */
+    enum class split_direction
+    {
+        forward, ///< Tokens are produced from the start of the string to the end.
+        reverse, ///< Tokens are produced from the end of the string to the start (rsplit).
+    };
+
+    /**
+     * @brief Position of a token within the string it was split from.
+     */
+    struct split_slice
+    {
+        std::size_t offset; ///< Index of the token's first character.
+        std::size_t length; ///< Number of characters in the token.
+    };
+
+    namespace detail
+    {
+        inline bool has_split_flag(string_split_options options, string_split_options flag) noexcept
+        {
+            return (static_cast<int>(options) & static_cast<int>(flag)) == static_cast<int>(flag);
+        }
+
+        /**
+         * @brief Applies the trim flags of options to token. The result always points into the token's storage.
+         */
+        template <typename CharT, typename Traits>
+        basic_string_view<CharT, Traits> trim_split_entry(basic_string_view<CharT, Traits> token, string_split_options options) noexcept
+        {
+            const bool left = has_split_flag(options, string_split_options::trim_left);
+            const bool right = has_split_flag(options, string_split_options::trim_right);
+            if (!left && !right)
+                return token;
+            // The whitespace set is compiled once and shared by every token of every split
+            static const char_set_view<CharT, Traits> whitespace(default_whitespace<CharT, Traits>());
+            return trim_view(token, whitespace, left, right);
+        }
+    } // namespace detail
+
+    /**
+     * @brief Lazy range over the tokens of a string split by a delimiter character.
+     *
+     * The view does not own the string it splits; the string must outlive the view and every token
+     * obtained from it. Tokens follow the same rules as str_split: an empty input yields no tokens,
+     * a trailing delimiter yields a trailing empty token, and remove_empty_entries is applied before
+     * trimming.
+     *
+     * When max_count is given, at most max_count tokens are produced and the last one holds the
+     * unsplit remainder of the string. With split_direction::reverse the tokens are produced from the
+     * end of the string, so the remainder is the leading part of the string.
+     *
+     * @tparam CharT Character type.
+     * @tparam Traits Character traits type.
+     */
+    template <typename CharT, typename Traits = std::char_traits<CharT>>
+    class basic_split_view
+    {
+      public:
+        using view_type = basic_string_view<CharT, Traits>;
+        using size_type = std::size_t;
+
+        /**
+         * @brief Value of max_count meaning "no limit".
+         */
+        static constexpr size_type npos = size_type(-1);
+
+        /**
+         * @brief Forward iterator over the tokens of a basic_split_view.
+         */
+        class iterator
+        {
+          public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = view_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const view_type*;
+            using reference = const view_type&;
+
+            /**
+             * @brief Constructs an end iterator.
+             */
+            iterator() noexcept
+                : _first(nullptr), _pos(nullptr), _last(nullptr), _delimiter(), _options(string_split_options::none), _direction(split_direction::forward),
+                  _max_count(0), _count(0), _has_more(false), _at_end(true)
+            {
+            }
+
+            reference operator*() const noexcept
+            {
+                return _token;
+            }
+
+            pointer operator->() const noexcept
+            {
+                return &_token;
+            }
+
+            iterator& operator++() noexcept
+            {
+                advance();
+                return *this;
+            }
+
+            iterator operator++(int) noexcept
+            {
+                iterator copy(*this);
+                advance();
+                return copy;
+            }
+
+            friend bool operator==(const iterator& lhs, const iterator& rhs) noexcept
+            {
+                return lhs._at_end == rhs._at_end && (lhs._at_end || lhs._count == rhs._count);
+            }
+
+            friend bool operator!=(const iterator& lhs, const iterator& rhs) noexcept
+            {
+                return !(lhs == rhs);
+            }
+
+          private:
+            friend class basic_split_view;
+
+            iterator(view_type str, CharT delimiter, string_split_options options, split_direction direction, size_type max_count) noexcept
+                : _first(str.data()), _pos(str.data()), _last(str.data() + str.size()), _delimiter(delimiter), _options(options), _direction(direction),
+                  _max_count(max_count), _count(0), _has_more(!str.empty()), _at_end(false)
+            {
+                if (_direction == split_direction::reverse)
+                    _pos = _last;
+                advance();
+            }
+
+            void advance() noexcept
+            {
+                const bool remove_empty = detail::has_split_flag(_options, string_split_options::remove_empty_entries);
+                for (;;)
+                {
+                    if (!_has_more || _count >= _max_count)
+                    {
+                        _at_end = true;
+                        return;
+                    }
+
+                    const bool remainder = _max_count != npos && _count + 1 == _max_count;
+                    if (_direction == split_direction::forward)
+                        next_forward(remainder, remove_empty);
+                    else
+                        next_reverse(remainder, remove_empty);
+
+                    if (_token.empty() && remove_empty)
+                        continue;
+
+                    _token = detail::trim_split_entry(_token, _options);
+                    ++_count;
+                    return;
+                }
+            }
+
+            void next_forward(bool remainder, bool remove_empty) noexcept
+            {
+                if (remainder)
+                {
+                    if (remove_empty)
+                        while (_pos != _last && Traits::eq(*_pos, _delimiter))
+                            ++_pos;
+                    _token = view_type(_pos, static_cast<size_type>(_last - _pos));
+                    _has_more = false;
+                    return;
+                }
+
+                const CharT* found = Traits::find(_pos, static_cast<size_type>(_last - _pos), _delimiter);
+                if (found)
+                {
+                    _token = view_type(_pos, static_cast<size_type>(found - _pos));
+                    _pos = found + 1;
+                }
+                else
+                {
+                    _token = view_type(_pos, static_cast<size_type>(_last - _pos));
+                    _pos = _last;
+                    _has_more = false;
+                }
+            }
+
+            void next_reverse(bool remainder, bool remove_empty) noexcept
+            {
+                if (remainder)
+                {
+                    if (remove_empty)
+                        while (_pos != _first && Traits::eq(_pos[-1], _delimiter))
+                            --_pos;
+                    _token = view_type(_first, static_cast<size_type>(_pos - _first));
+                    _has_more = false;
+                    return;
+                }
+
+                const CharT* it = _pos;
+                while (it != _first && !Traits::eq(it[-1], _delimiter))
+                    --it;
+                _token = view_type(it, static_cast<size_type>(_pos - it));
+                if (it != _first)
+                {
+                    _pos = it - 1;
+                }
+                else
+                {
+                    _pos = _first;
+                    _has_more = false;
+                }
+            }
+
+            const CharT* _first;
+            const CharT* _pos;
+            const CharT* _last;
+            CharT _delimiter;
+            string_split_options _options;
+            split_direction _direction;
+            size_type _max_count;
+            size_type _count;
+            bool _has_more;
+            bool _at_end;
+            view_type _token;
+        };
+
+        using const_iterator = iterator;
+
+        /**
+         * @brief Constructs a split view.
+         * @param str String to split. Must outlive the view and its tokens.
+         * @param delimiter Delimiter character.
+         * @param options Split options.
+         * @param max_count Maximum number of tokens to produce; the last one holds the unsplit remainder.
+         * @param direction Whether tokens are produced from the start or from the end of the string.
+         */
+        basic_split_view(view_type str, CharT delimiter, string_split_options options = string_split_options::remove_empty_entries,
+                         size_type max_count = npos, split_direction direction = split_direction::forward) noexcept
+            : _str(str), _delimiter(delimiter), _options(options), _max_count(max_count), _direction(direction)
+        {
+        }
+
+        /**
+         * @brief Returns an iterator to the first token. Finding it is the only work done up front.
+         */
+        iterator begin() const noexcept
+        {
+            return iterator(_str, _delimiter, _options, _direction, _max_count);
+        }
+
+        /**
+         * @brief Returns the end iterator.
+         */
+        iterator end() const noexcept
+        {
+            return iterator();
+        }
+
+        /**
+         * @brief Checks whether the view produces no tokens.
+         */
+        bool empty() const noexcept
+        {
+            return begin() == end();
+        }
+
+      private:
+        view_type _str;
+        CharT _delimiter;
+        string_split_options _options;
+        size_type _max_count;
+        split_direction _direction;
+    };
+
+    template <typename CharT, typename Traits>
+    constexpr typename basic_split_view<CharT, Traits>::size_type basic_split_view<CharT, Traits>::npos;
+
+    /**
+     * @brief Lazy split range over a narrow string.
+     */
+    using split_view = basic_split_view<char>;
+
+    /**
+     * @brief Lazy split range over a wide string.
+     */
+    using wsplit_view = basic_split_view<wchar_t>;
+
+    /**
+     * @brief Lazily splits a string by a delimiter character.
+     * @param str Input string. Must outlive the returned view and its tokens.
+     * @param delimiter Delimiter character.
+     * @param options Split options.
+     * @param max_count Maximum number of tokens; the last one holds the unsplit remainder.
+     * @return Range of string views over the tokens, from first to last.
+     */
+    inline split_view str_split_view(string_view str, char delimiter, string_split_options options = string_split_options::remove_empty_entries,
+                                     std::size_t max_count = split_view::npos) noexcept
+    {
+        return split_view(str, delimiter, options, max_count, split_direction::forward);
+    }
+
+    /**
+     * @brief Lazily splits a string by a delimiter character, starting from the end.
+     * @param str Input string. Must outlive the returned view and its tokens.
+     * @param delimiter Delimiter character.
+     * @param options Split options.
+     * @param max_count Maximum number of tokens; the last one holds the unsplit leading remainder.
+     * @return Range of string views over the tokens, from last to first.
+     */
+    inline split_view str_rsplit_view(string_view str, char delimiter, string_split_options options = string_split_options::remove_empty_entries,
+                                      std::size_t max_count = split_view::npos) noexcept
+    {
+        return split_view(str, delimiter, options, max_count, split_direction::reverse);
+    }
+
+    /**
+     * @brief Lazily splits a wide string by a delimiter character.
+     * @param str Input wide string. Must outlive the returned view and its tokens.
+     * @param delimiter Delimiter character.
+     * @param options Split options.
+     * @param max_count Maximum number of tokens; the last one holds the unsplit remainder.
+     * @return Range of wide string views over the tokens, from first to last.
+     */
+    inline wsplit_view wstr_split_view(wstring_view str, wchar_t delimiter, string_split_options options = string_split_options::remove_empty_entries,
+                                       std::size_t max_count = wsplit_view::npos) noexcept
+    {
+        return wsplit_view(str, delimiter, options, max_count, split_direction::forward);
+    }
+
+    /**
+     * @brief Lazily splits a wide string by a delimiter character, starting from the end.
+     * @param str Input wide string. Must outlive the returned view and its tokens.
+     * @param delimiter Delimiter character.
+     * @param options Split options.
+     * @param max_count Maximum number of tokens; the last one holds the unsplit leading remainder.
+     * @return Range of wide string views over the tokens, from last to first.
+     */
+    inline wsplit_view wstr_rsplit_view(wstring_view str, wchar_t delimiter, string_split_options options = string_split_options::remove_empty_entries,
+                                        std::size_t max_count = wsplit_view::npos) noexcept
+    {
+        return wsplit_view(str, delimiter, options, max_count, split_direction::reverse);
+    }
+
+    /**
+     * @brief Lazy range over the tokens of a string split on any character of a delimiter set.
+     *
+     * Tokens follow the same rules as basic_split_view, with every character of the set acting as
+     * a delimiter. Combined with remove_empty_entries, runs of delimiters are skipped with a single
+     * SIMD scan, which makes splitting on runs of whitespace as cheap as splitting on one character.
+     * Iterators carry their own copy of the classification tables, so they stay valid after the view
+     * is destroyed; the string and the delimiter set must outlive the view and every token.
+     *
+     * @tparam CharT Character type.
+     * @tparam Traits Character traits type.
+     */
+    template <typename CharT, typename Traits = std::char_traits<CharT>>
+    class basic_split_any_view
+    {
+      public:
+        using view_type = basic_string_view<CharT, Traits>;
+        using size_type = std::size_t;
+
+        /**
+         * @brief Value of max_count meaning "no limit".
+         */
+        static constexpr size_type npos = size_type(-1);
+
+        /**
+         * @brief Forward iterator over the tokens of a basic_split_any_view.
+         */
+        class iterator
+        {
+          public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = view_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const view_type*;
+            using reference = const view_type&;
+
+            /**
+             * @brief Constructs an end iterator.
+             */
+            iterator() noexcept
+                : _pos(nullptr), _last(nullptr), _delimiters(), _options(string_split_options::none), _max_count(0), _count(0), _has_more(false), _at_end(true)
+            {
+            }
+
+            reference operator*() const noexcept
+            {
+                return _token;
+            }
+
+            pointer operator->() const noexcept
+            {
+                return &_token;
+            }
+
+            iterator& operator++() noexcept
+            {
+                advance();
+                return *this;
+            }
+
+            iterator operator++(int) noexcept
+            {
+                iterator copy(*this);
+                advance();
+                return copy;
+            }
+
+            friend bool operator==(const iterator& lhs, const iterator& rhs) noexcept
+            {
+                return lhs._at_end == rhs._at_end && (lhs._at_end || lhs._count == rhs._count);
+            }
+
+            friend bool operator!=(const iterator& lhs, const iterator& rhs) noexcept
+            {
+                return !(lhs == rhs);
+            }
+
+          private:
+            friend class basic_split_any_view;
+
+            iterator(view_type str, const detail::char_set_view<CharT, Traits>& delimiters, string_split_options options, size_type max_count) noexcept
+                : _pos(str.data()), _last(str.data() + str.size()), _delimiters(delimiters), _options(options), _max_count(max_count), _count(0),
+                  _has_more(!str.empty()), _at_end(false)
+            {
+                advance();
+            }
+
+            void advance() noexcept
+            {
+                const bool remove_empty = detail::has_split_flag(_options, string_split_options::remove_empty_entries);
+                for (;;)
+                {
+                    if (!_has_more || _count >= _max_count)
+                    {
+                        _at_end = true;
+                        return;
+                    }
+
+                    // Empty tokens would be dropped anyway, so skip the whole run of delimiters at once
+                    if (remove_empty)
+                    {
+                        _pos = _delimiters.find(_pos, _last, false);
+                        if (_pos == _last)
+                        {
+                            _at_end = true;
+                            return;
+                        }
+                    }
+
+                    if (_max_count != npos && _count + 1 == _max_count)
+                    {
+                        _token = view_type(_pos, static_cast<size_type>(_last - _pos));
+                        _has_more = false;
+                    }
+                    else
+                    {
+                        const CharT* found = _delimiters.find(_pos, _last, true);
+                        _token = view_type(_pos, static_cast<size_type>(found - _pos));
+                        _has_more = found != _last;
+                        _pos = _has_more ? found + 1 : _last;
+                    }
+
+                    if (_token.empty() && remove_empty)
+                        continue;
+
+                    _token = detail::trim_split_entry(_token, _options);
+                    ++_count;
+                    return;
+                }
+            }
+
+            const CharT* _pos;
+            const CharT* _last;
+            detail::char_set_view<CharT, Traits> _delimiters;
+            string_split_options _options;
+            size_type _max_count;
+            size_type _count;
+            bool _has_more;
+            bool _at_end;
+            view_type _token;
+        };
+
+        using const_iterator = iterator;
+
+        /**
+         * @brief Constructs a split view over a delimiter set.
+         * @param str String to split. Must outlive the view and its tokens.
+         * @param delimiters Characters that each act as a delimiter. Must outlive the view and its iterators.
+         * @param options Split options.
+         * @param max_count Maximum number of tokens to produce; the last one holds the unsplit remainder.
+         */
+        basic_split_any_view(view_type str, view_type delimiters, string_split_options options = string_split_options::remove_empty_entries,
+                             size_type max_count = npos) noexcept
+            : _str(str), _delimiters(delimiters), _options(options), _max_count(max_count)
+        {
+        }
+
+        /**
+         * @brief Constructs a split view over a precompiled delimiter set.
+         * @param str String to split. Must outlive the view and its tokens.
+         * @param delimiters Characters that each act as a delimiter. Must outlive the view and its iterators.
+         * @param options Split options.
+         * @param max_count Maximum number of tokens to produce; the last one holds the unsplit remainder.
+         */
+        basic_split_any_view(view_type str, const basic_char_set<CharT, Traits>& delimiters,
+                             string_split_options options = string_split_options::remove_empty_entries, size_type max_count = npos) noexcept
+            : _str(str), _delimiters(delimiters.view()), _options(options), _max_count(max_count)
+        {
+        }
+
+        /**
+         * @brief Returns an iterator to the first token. Finding it is the only work done up front.
+         */
+        iterator begin() const noexcept
+        {
+            return iterator(_str, _delimiters, _options, _max_count);
+        }
+
+        /**
+         * @brief Returns the end iterator.
+         */
+        iterator end() const noexcept
+        {
+            return iterator();
+        }
+
+        /**
+         * @brief Checks whether the view produces no tokens.
+         */
+        bool empty() const noexcept
+        {
+            return begin() == end();
+        }
+
+      private:
+        view_type _str;
+        detail::char_set_view<CharT, Traits> _delimiters;
+        string_split_options _options;
+        size_type _max_count;
+    };
+
+    template <typename CharT, typename Traits>
+    constexpr typename basic_split_any_view<CharT, Traits>::size_type basic_split_any_view<CharT, Traits>::npos;
+
+    /**
+     * @brief Lazy delimiter-set split range over a narrow string.
+     */
+    using split_any_view = basic_split_any_view<char>;
+
+    /**
+     * @brief Lazy delimiter-set split range over a wide string.
+     */
+    using wsplit_any_view = basic_split_any_view<wchar_t>;
+
+    /**
+     * @brief Lazily splits a string on any character of a delimiter set.
+     * @param str Input string. Must outlive the returned view and its tokens.
+     * @param delimiters Delimiter characters, e.g. ",;\t". Must outlive the returned view.
+     * @param options Split options.
+     * @param max_count Maximum number of tokens; the last one holds the unsplit remainder.
+     * @return Range of string views over the tokens.
+     */
+    inline split_any_view str_split_any_view(string_view str, string_view delimiters, string_split_options options = string_split_options::remove_empty_entries,
+                                             std::size_t max_count = split_any_view::npos) noexcept
+    {
+        return split_any_view(str, delimiters, options, max_count);
+    }
+
+    /**
+     * @brief Lazily splits a string on any character of a precompiled delimiter set.
+     * @param str Input string. Must outlive the returned view and its tokens.
+     * @param delimiters Delimiter set. Must outlive the returned view.
+     * @param options Split options.
+     * @param max_count Maximum number of tokens; the last one holds the unsplit remainder.
+     * @return Range of string views over the tokens.
+     */
+    inline split_any_view str_split_any_view(string_view str, const char_set& delimiters,
+                                             string_split_options options = string_split_options::remove_empty_entries,
+                                             std::size_t max_count = split_any_view::npos) noexcept
+    {
+        return split_any_view(str, delimiters, options, max_count);
+    }
+
+    /**
+     * @brief Lazily splits a string on runs of whitespace, like Python's str.split().
+     *
+     * Leading and trailing whitespace produce no tokens, and an input of only whitespace produces none.
+     *
+     * @param str Input string. Must outlive the returned view and its tokens.
+     * @return Range of string views over the whitespace-separated words.
+     */
+    inline split_any_view str_split_whitespace_view(string_view str) noexcept
+    {
+        return split_any_view(str, char_set::whitespace(), string_split_options::remove_empty_entries);
+    }
+
+    /**
+     * @brief Lazily splits a wide string on any character of a delimiter set.
+     * @param str Input wide string. Must outlive the returned view and its tokens.
+     * @param delimiters Delimiter characters. Must outlive the returned view.
+     * @param options Split options.
+     * @param max_count Maximum number of tokens; the last one holds the unsplit remainder.
+     * @return Range of wide string views over the tokens.
+     */
+    inline wsplit_any_view wstr_split_any_view(wstring_view str, wstring_view delimiters,
+                                               string_split_options options = string_split_options::remove_empty_entries,
+                                               std::size_t max_count = wsplit_any_view::npos) noexcept
+    {
+        return wsplit_any_view(str, delimiters, options, max_count);
+    }
+
+    /**
+     * @brief Lazily splits a wide string on any character of a precompiled delimiter set.
+     * @param str Input wide string. Must outlive the returned view and its tokens.
+     * @param delimiters Delimiter set. Must outlive the returned view.
+     * @param options Split options.
+     * @param max_count Maximum number of tokens; the last one holds the unsplit remainder.
+     * @return Range of wide string views over the tokens.
+     */
+    inline wsplit_any_view wstr_split_any_view(wstring_view str, const wchar_set& delimiters,
+                                               string_split_options options = string_split_options::remove_empty_entries,
+                                               std::size_t max_count = wsplit_any_view::npos) noexcept
+    {
+        return wsplit_any_view(str, delimiters, options, max_count);
+    }
+
+    /**
+     * @brief Lazily splits a wide string on runs of whitespace, like Python's str.split().
+     * @param str Input wide string. Must outlive the returned view and its tokens.
+     * @return Range of wide string views over the whitespace-separated words.
+     */
+    inline wsplit_any_view wstr_split_whitespace_view(wstring_view str) noexcept
+    {
+        return wsplit_any_view(str, wchar_set::whitespace(), string_split_options::remove_empty_entries);
+    }
+
+    namespace detail
+    {
+        template <typename CharT, typename Traits>
+        void store_split_entry(basic_string_view<CharT, Traits>& out, basic_string_view<CharT, Traits>, basic_string_view<CharT, Traits> token) noexcept
+        {
+            out = token;
+        }
+
+        template <typename CharT, typename Traits>
+        void store_split_entry(split_slice& out, basic_string_view<CharT, Traits> str, basic_string_view<CharT, Traits> token) noexcept
+        {
+            out.offset = static_cast<std::size_t>(token.data() - str.data());
+            out.length = token.size();
+        }
+
+        /**
+         * @brief Writes up to capacity tokens to out and returns the total number of tokens.
+         */
+        template <typename CharT, typename Traits, typename Entry>
+        std::size_t split_into(basic_string_view<CharT, Traits> str, CharT delimiter, Entry* out, std::size_t capacity, string_split_options options) noexcept
+        {
+            std::size_t count = 0;
+            for (basic_string_view<CharT, Traits> token : basic_split_view<CharT, Traits>(str, delimiter, options))
+            {
+                if (count < capacity)
+                    store_split_entry(out[count], str, token);
+                ++count;
+            }
+            return count;
+        }
+
+        /**
+         * @brief Replaces the contents of out with the tokens, reusing its capacity.
+         */
+        template <typename CharT, typename Traits, typename Entry, typename Alloc>
+        std::size_t split_into(basic_string_view<CharT, Traits> str, CharT delimiter, std::vector<Entry, Alloc>& out, string_split_options options)
+        {
+            out.clear();
+            for (basic_string_view<CharT, Traits> token : basic_split_view<CharT, Traits>(str, delimiter, options))
+            {
+                out.emplace_back();
+                store_split_entry(out.back(), str, token);
+            }
+            return out.size();
+        }
+    } // namespace detail
+
+    /**
+     * @brief Splits a string by a delimiter character into caller-provided storage, as views.
+     *
+     * Tokens follow the same rules as str_split. At most capacity tokens are written; the return value
+     * is the total number of tokens, so a result larger than capacity means the output was truncated.
+     *
+     * @param str Input string. Must outlive the stored views.
+     * @param delimiter Delimiter character.
+     * @param out Storage for at least capacity tokens.
+     * @param capacity Number of entries available at out.
+     * @param options Split options.
+     * @return Total number of tokens in str.
+     */
+    inline std::size_t str_split_into(string_view str, char delimiter, string_view* out, std::size_t capacity,
+                                      string_split_options options = string_split_options::remove_empty_entries) noexcept
+    {
+        return detail::split_into(str, delimiter, out, capacity, options);
+    }
+
+    /**
+     * @brief Splits a string by a delimiter character into a reusable vector, as views.
+     *
+     * The vector is cleared first and only allocates when it needs more capacity than any previous
+     * call, so reusing it across calls keeps a tokenizing loop free of heap traffic.
+     *
+     * @param str Input string. Must outlive the stored views.
+     * @param delimiter Delimiter character.
+     * @param out Vector that receives the tokens.
+     * @param options Split options.
+     * @return Number of tokens, equal to out.size().
+     */
+    inline std::size_t str_split_into(string_view str, char delimiter, std::vector<string_view>& out,
+                                      string_split_options options = string_split_options::remove_empty_entries)
+    {
+        return detail::split_into(str, delimiter, out, options);
+    }
+
+    /**
+     * @brief Splits a string by a delimiter character into caller-provided storage, as (offset, length) slices.
+     *
+     * Tokens follow the same rules as str_split. At most capacity tokens are written; the return value
+     * is the total number of tokens, so a result larger than capacity means the output was truncated.
+     *
+     * @param str Input string.
+     * @param delimiter Delimiter character.
+     * @param out Storage for at least capacity tokens.
+     * @param capacity Number of entries available at out.
+     * @param options Split options.
+     * @return Total number of tokens in str.
+     */
+    inline std::size_t str_split_into(string_view str, char delimiter, split_slice* out, std::size_t capacity,
+                                      string_split_options options = string_split_options::remove_empty_entries) noexcept
+    {
+        return detail::split_into(str, delimiter, out, capacity, options);
+    }
+
+    /**
+     * @brief Splits a string by a delimiter character into a reusable vector, as (offset, length) slices.
+     *
+     * The vector is cleared first and only allocates when it needs more capacity than any previous
+     * call, so reusing it across calls keeps a tokenizing loop free of heap traffic.
+     *
+     * @param str Input string.
+     * @param delimiter Delimiter character.
+     * @param out Vector that receives the tokens.
+     * @param options Split options.
+     * @return Number of tokens, equal to out.size().
+     */
+    inline std::size_t str_split_into(string_view str, char delimiter, std::vector<split_slice>& out,
+                                      string_split_options options = string_split_options::remove_empty_entries)
+    {
+        return detail::split_into(str, delimiter, out, options);
+    }
+
+    /**
+     * @brief Splits a string by a delimiter character into a fixed-size array of string_view or split_slice.
+     * @param str Input string.
+     * @param delimiter Delimiter character.
+     * @param out Array that receives up to N tokens.
+     * @param options Split options.
+     * @return Total number of tokens in str; larger than N if the output was truncated.
+     */
+    template <typename Entry, std::size_t N>
+    std::size_t str_split_into(string_view str, char delimiter, Entry (&out)[N], string_split_options options = string_split_options::remove_empty_entries) noexcept
+    {
+        return str_split_into(str, delimiter, static_cast<Entry*>(out), N, options);
+    }
+
+    /**
+     * @brief Splits a wide string by a delimiter character into caller-provided storage, as views.
+     *
+     * Tokens follow the same rules as wstr_split. At most capacity tokens are written; the return value
+     * is the total number of tokens, so a result larger than capacity means the output was truncated.
+     *
+     * @param str Input wide string. Must outlive the stored views.
+     * @param delimiter Delimiter character.
+     * @param out Storage for at least capacity tokens.
+     * @param capacity Number of entries available at out.
+     * @param options Split options.
+     * @return Total number of tokens in str.
+     */
+    inline std::size_t wstr_split_into(wstring_view str, wchar_t delimiter, wstring_view* out, std::size_t capacity,
+                                       string_split_options options = string_split_options::remove_empty_entries) noexcept
+    {
+        return detail::split_into(str, delimiter, out, capacity, options);
+    }
+
+    /**
+     * @brief Splits a wide string by a delimiter character into a reusable vector, as views.
+     *
+     * The vector is cleared first and only allocates when it needs more capacity than any previous
+     * call, so reusing it across calls keeps a tokenizing loop free of heap traffic.
+     *
+     * @param str Input wide string. Must outlive the stored views.
+     * @param delimiter Delimiter character.
+     * @param out Vector that receives the tokens.
+     * @param options Split options.
+     * @return Number of tokens, equal to out.size().
+     */
+    inline std::size_t wstr_split_into(wstring_view str, wchar_t delimiter, std::vector<wstring_view>& out,
+                                       string_split_options options = string_split_options::remove_empty_entries)
+    {
+        return detail::split_into(str, delimiter, out, options);
+    }
+
+    /**
+     * @brief Splits a wide string by a delimiter character into caller-provided storage, as (offset, length) slices.
+     *
+     * Tokens follow the same rules as wstr_split. At most capacity tokens are written; the return value
+     * is the total number of tokens, so a result larger than capacity means the output was truncated.
+     *
+     * @param str Input wide string.
+     * @param delimiter Delimiter character.
+     * @param out Storage for at least capacity tokens.
+     * @param capacity Number of entries available at out.
+     * @param options Split options.
+     * @return Total number of tokens in str.
+     */
+    inline std::size_t wstr_split_into(wstring_view str, wchar_t delimiter, split_slice* out, std::size_t capacity,
+                                       string_split_options options = string_split_options::remove_empty_entries) noexcept
+    {
+        return detail::split_into(str, delimiter, out, capacity, options);
+    }
+
+    /**
+     * @brief Splits a wide string by a delimiter character into a reusable vector, as (offset, length) slices.
+     *
+     * The vector is cleared first and only allocates when it needs more capacity than any previous
+     * call, so reusing it across calls keeps a tokenizing loop free of heap traffic.
+     *
+     * @param str Input wide string.
+     * @param delimiter Delimiter character.
+     * @param out Vector that receives the tokens.
+     * @param options Split options.
+     * @return Number of tokens, equal to out.size().
+     */
+    inline std::size_t wstr_split_into(wstring_view str, wchar_t delimiter, std::vector<split_slice>& out,
+                                       string_split_options options = string_split_options::remove_empty_entries)
+    {
+        return detail::split_into(str, delimiter, out, options);
+    }
+
+    /**
+     * @brief Splits a wide string by a delimiter character into a fixed-size array of wstring_view or split_slice.
+     * @param str Input wide string.
+     * @param delimiter Delimiter character.
+     * @param out Array that receives up to N tokens.
+     * @param options Split options.
+     * @return Total number of tokens in str; larger than N if the output was truncated.
+     */
+    template <typename Entry, std::size_t N>
+    std::size_t wstr_split_into(wstring_view str, wchar_t delimiter, Entry (&out)[N], string_split_options options = string_split_options::remove_empty_entries) noexcept
+    {
+        return wstr_split_into(str, delimiter, static_cast<Entry*>(out), N, options);
+    }
+
+} // namespace swe
\ No newline at end of file
@@ -5,111 +5,900 @@
  *
  * This header provides a collection of reusable string manipulation utilities,
  * including case conversion, trimming, splitting, joining, comparison, and
- * formatting helpers. All functions are provided for both std::string and std::wstring types,
- * using a consistent naming convention (str_* & wstr_*). These utilities are designed for
+ * formatting helpers. Each utility is written once as a basic_str_* template over the character
+ * type, traits and allocator, so it works for std::string, std::wstring, std::u16string,
+ * std::u32string and (from C++20) std::u8string alike. The str_* and wstr_* functions are thin
+ * wrappers over the templates for std::string and std::wstring. These utilities are designed for
  * efficiency and convenience in modern C++ projects.
  *
+ * Query functions take swe::string_view / swe::wstring_view parameters, so they accept
+ * std::string, string literals and slices of larger buffers without allocating. They are defined
+ * inline, so short checks such as str_starts_with and str_equals can be inlined at the call site.
+ *
  * @copyright MIT License
  * @date created 2025-05-16
  * @version 1.0
  */
 #pragma once
 
-#include <algorithm>
-#include <cctype>
-#include <cwctype>
-#include <sstream>
+#include "char_set.hpp"
+#include "split_view.hpp"
+#include "string_options.hpp"
+#include "string_view.hpp"
+#include "detail/config.hpp"
+#include "detail/join.hpp"
+#include "detail/string_algorithms.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
 #include <string>
 #include <vector>
 
 namespace swe
 {
+    // Generic (std::basic_string) utilities
+
+    /**
+     * @brief Converts a string to lowercase.
+     *
+     * char and char8_t strings are treated as UTF-8, char16_t strings as UTF-16 and char32_t strings as
+     * UTF-32, and every code point is mapped with its Unicode simple lower-case mapping. wchar_t strings
+     * are mapped character by character with std::towlower.
+     *
+     * @param str Input string.
+     * @return Lowercase version of the input string.
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    std::basic_string<CharT, Traits, Alloc> basic_str_to_lower(const std::basic_string<CharT, Traits, Alloc>& str)
+    {
+        return detail::case_mapped(str, detail::lower_case_mapper(), detail::encoding_of<CharT>());
+    }
+
+    /**
+     * @brief Converts a string to lowercase in place.
+     * @param str String to convert.
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    void basic_str_to_lower_inplace(std::basic_string<CharT, Traits, Alloc>& str)
+    {
+        detail::case_map_inplace(str, detail::lower_case_mapper(), detail::encoding_of<CharT>());
+    }
+
+    /**
+     * @brief Converts a string to lowercase, reusing the storage of a temporary.
+     * @param str Input string, converted in place and moved into the result.
+     * @return Lowercase version of the input string.
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    std::basic_string<CharT, Traits, Alloc> basic_str_to_lower(std::basic_string<CharT, Traits, Alloc>&& str)
+    {
+        basic_str_to_lower_inplace(str);
+        return std::move(str);
+    }
+
+    /**
+     * @brief Converts a string to uppercase, with the same per-character-type rules as basic_str_to_lower.
+     * @param str Input string.
+     * @return Uppercase version of the input string.
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    std::basic_string<CharT, Traits, Alloc> basic_str_to_upper(const std::basic_string<CharT, Traits, Alloc>& str)
+    {
+        return detail::case_mapped(str, detail::upper_case_mapper(), detail::encoding_of<CharT>());
+    }
+
+    /**
+     * @brief Converts a string to uppercase in place.
+     * @param str String to convert.
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    void basic_str_to_upper_inplace(std::basic_string<CharT, Traits, Alloc>& str)
+    {
+        detail::case_map_inplace(str, detail::upper_case_mapper(), detail::encoding_of<CharT>());
+    }
+
+    /**
+     * @brief Converts a string to uppercase, reusing the storage of a temporary.
+     * @param str Input string, converted in place and moved into the result.
+     * @return Uppercase version of the input string.
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    std::basic_string<CharT, Traits, Alloc> basic_str_to_upper(std::basic_string<CharT, Traits, Alloc>&& str)
+    {
+        basic_str_to_upper_inplace(str);
+        return std::move(str);
+    }
+
+    /**
+     * @brief Converts a string to title case.
+     *
+     * The first character of each word gets its title-case mapping and the others their lower-case
+     * mapping. Words are separated by ASCII whitespace, or by std::iswspace for wchar_t strings.
+     *
+     * @param str Input string.
+     * @return Title-cased version of the input string.
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    std::basic_string<CharT, Traits, Alloc> basic_str_to_title(const std::basic_string<CharT, Traits, Alloc>& str)
+    {
+        return detail::case_mapped(str, detail::title_case_mapper(), detail::encoding_of<CharT>());
+    }
+
+    /**
+     * @brief Converts a string to title case in place.
+     * @param str String to convert.
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    void basic_str_to_title_inplace(std::basic_string<CharT, Traits, Alloc>& str)
+    {
+        detail::case_map_inplace(str, detail::title_case_mapper(), detail::encoding_of<CharT>());
+    }
+
+    /**
+     * @brief Converts a string to title case, reusing the storage of a temporary.
+     * @param str Input string, converted in place and moved into the result.
+     * @return Title-cased version of the input string.
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    std::basic_string<CharT, Traits, Alloc> basic_str_to_title(std::basic_string<CharT, Traits, Alloc>&& str)
+    {
+        basic_str_to_title_inplace(str);
+        return std::move(str);
+    }
+
+    /**
+     * @brief Converts a string to a slug in place.
+     *
+     * char and char8_t strings are classified with the locale-free ASCII tables, 32 bytes at a time, and
+     * keep ASCII letters and digits only; wchar_t strings are classified with the C library, and char16_t
+     * and char32_t strings keep ASCII letters and digits only. The slug is never longer than the input,
+     * except for wide strings whose transliteration spells a letter with two, such as U+00DF as "ss".
+     *
+     * @param str String to convert.
+     * @param separator Character to use as separator (default '_').
+     * @param transliteration Transliteration applied before classifying (default none).
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    void basic_str_to_slug_inplace(std::basic_string<CharT, Traits, Alloc>& str, detail::type_identity_t<CharT> separator = CharT('_'),
+                                   string_slug_transliteration transliteration = string_slug_transliteration::none)
+    {
+        detail::to_slug_inplace(str, separator, transliteration);
+    }
+
+    /**
+     * @brief Converts a string to a slug (lowercase, alphanumeric, separator).
+     * @param str Input string.
+     * @param separator Character to use as separator (default '_').
+     * @param transliteration Transliteration applied before classifying (default none).
+     * @return Slugified string.
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    std::basic_string<CharT, Traits, Alloc> basic_str_to_slug(const std::basic_string<CharT, Traits, Alloc>& str,
+                                                              detail::type_identity_t<CharT> separator = CharT('_'),
+                                                              string_slug_transliteration transliteration = string_slug_transliteration::none)
+    {
+        return detail::to_slug(str, separator, transliteration, detail::encoding_of<CharT>());
+    }
+
+    /**
+     * @brief Converts a string to a slug, reusing the storage of a temporary.
+     * @param str Input string, converted in place and moved into the result.
+     * @param separator Character to use as separator (default '_').
+     * @param transliteration Transliteration applied before classifying (default none).
+     * @return Slugified string.
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    std::basic_string<CharT, Traits, Alloc> basic_str_to_slug(std::basic_string<CharT, Traits, Alloc>&& str, detail::type_identity_t<CharT> separator = CharT('_'),
+                                                              string_slug_transliteration transliteration = string_slug_transliteration::none)
+    {
+        detail::to_slug_inplace(str, separator, transliteration);
+        return std::move(str);
+    }
+
+    /**
+     * @brief Trims whitespace from both ends of a string view without allocating.
+     *
+     * Like every basic_str_* function that takes only views, the character type is not deduced and is
+     * named explicitly, e.g. basic_str_trim_view<char16_t>(text).
+     *
+     * @param str Input string view.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     * @return View of the trimmed range of str; it refers to the same storage as str.
+     */
+    template <typename CharT, typename Traits = std::char_traits<CharT>>
+    basic_string_view<CharT, Traits> basic_str_trim_view(detail::type_identity_t<basic_string_view<CharT, Traits>> str,
+                                                         detail::type_identity_t<basic_string_view<CharT, Traits>> whitespace =
+                                                             detail::default_whitespace<CharT, Traits>()) noexcept
+    {
+        return detail::trim_view(str, detail::char_set_view<CharT, Traits>(whitespace), true, true);
+    }
+
+    /**
+     * @brief Trims whitespace from the left of a string view without allocating.
+     * @param str Input string view.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     * @return View of the left-trimmed range of str; it refers to the same storage as str.
+     */
+    template <typename CharT, typename Traits = std::char_traits<CharT>>
+    basic_string_view<CharT, Traits> basic_str_trim_left_view(detail::type_identity_t<basic_string_view<CharT, Traits>> str,
+                                                              detail::type_identity_t<basic_string_view<CharT, Traits>> whitespace =
+                                                                  detail::default_whitespace<CharT, Traits>()) noexcept
+    {
+        return detail::trim_view(str, detail::char_set_view<CharT, Traits>(whitespace), true, false);
+    }
+
+    /**
+     * @brief Trims whitespace from the right of a string view without allocating.
+     * @param str Input string view.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     * @return View of the right-trimmed range of str; it refers to the same storage as str.
+     */
+    template <typename CharT, typename Traits = std::char_traits<CharT>>
+    basic_string_view<CharT, Traits> basic_str_trim_right_view(detail::type_identity_t<basic_string_view<CharT, Traits>> str,
+                                                               detail::type_identity_t<basic_string_view<CharT, Traits>> whitespace =
+                                                                   detail::default_whitespace<CharT, Traits>()) noexcept
+    {
+        return detail::trim_view(str, detail::char_set_view<CharT, Traits>(whitespace), false, true);
+    }
+
+    /**
+     * @brief Trims whitespace from both ends of a string.
+     * @param str Input string.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     * @return Trimmed string.
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    std::basic_string<CharT, Traits, Alloc> basic_str_trim(const std::basic_string<CharT, Traits, Alloc>& str,
+                                                           detail::type_identity_t<basic_string_view<CharT, Traits>> whitespace =
+                                                               detail::default_whitespace<CharT, Traits>())
+    {
+        const basic_string_view<CharT, Traits> trimmed = basic_str_trim_view<CharT, Traits>(str, whitespace);
+        return std::basic_string<CharT, Traits, Alloc>(trimmed.data(), trimmed.size(), str.get_allocator());
+    }
+
+    /**
+     * @brief Trims whitespace from both ends of a string, reusing the storage of a temporary.
+     * @param str Input string, trimmed in place and moved into the result.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     * @return Trimmed string.
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    std::basic_string<CharT, Traits, Alloc> basic_str_trim(std::basic_string<CharT, Traits, Alloc>&& str,
+                                                           detail::type_identity_t<basic_string_view<CharT, Traits>> whitespace =
+                                                               detail::default_whitespace<CharT, Traits>())
+    {
+        detail::trim_inplace(str, detail::char_set_view<CharT, Traits>(whitespace), true, true);
+        return std::move(str);
+    }
+
     /**
-     * @brief String comparison type for swe string utilities.
+     * @brief Trims whitespace from both ends of a string in place.
+     * @param str String to trim.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    void basic_str_trim_inplace(std::basic_string<CharT, Traits, Alloc>& str,
+                                detail::type_identity_t<basic_string_view<CharT, Traits>> whitespace = detail::default_whitespace<CharT, Traits>())
+    {
+        detail::trim_inplace(str, detail::char_set_view<CharT, Traits>(whitespace), true, true);
+    }
+
+    /**
+     * @brief Trims whitespace from the left of a string.
+     * @param str Input string.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     * @return Left-trimmed string.
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    std::basic_string<CharT, Traits, Alloc> basic_str_trim_left(const std::basic_string<CharT, Traits, Alloc>& str,
+                                                                detail::type_identity_t<basic_string_view<CharT, Traits>> whitespace =
+                                                                    detail::default_whitespace<CharT, Traits>())
+    {
+        const basic_string_view<CharT, Traits> trimmed = basic_str_trim_left_view<CharT, Traits>(str, whitespace);
+        return std::basic_string<CharT, Traits, Alloc>(trimmed.data(), trimmed.size(), str.get_allocator());
+    }
+
+    /**
+     * @brief Trims whitespace from the left of a string, reusing the storage of a temporary.
+     * @param str Input string, trimmed in place and moved into the result.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     * @return Trimmed string.
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    std::basic_string<CharT, Traits, Alloc> basic_str_trim_left(std::basic_string<CharT, Traits, Alloc>&& str,
+                                                                detail::type_identity_t<basic_string_view<CharT, Traits>> whitespace =
+                                                                    detail::default_whitespace<CharT, Traits>())
+    {
+        detail::trim_inplace(str, detail::char_set_view<CharT, Traits>(whitespace), true, false);
+        return std::move(str);
+    }
+
+    /**
+     * @brief Trims whitespace from the left of a string in place.
+     * @param str String to trim.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    void basic_str_trim_left_inplace(std::basic_string<CharT, Traits, Alloc>& str,
+                                     detail::type_identity_t<basic_string_view<CharT, Traits>> whitespace = detail::default_whitespace<CharT, Traits>())
+    {
+        detail::trim_inplace(str, detail::char_set_view<CharT, Traits>(whitespace), true, false);
+    }
+
+    /**
+     * @brief Trims whitespace from the right of a string.
+     * @param str Input string.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     * @return Right-trimmed string.
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    std::basic_string<CharT, Traits, Alloc> basic_str_trim_right(const std::basic_string<CharT, Traits, Alloc>& str,
+                                                                 detail::type_identity_t<basic_string_view<CharT, Traits>> whitespace =
+                                                                     detail::default_whitespace<CharT, Traits>())
+    {
+        const basic_string_view<CharT, Traits> trimmed = basic_str_trim_right_view<CharT, Traits>(str, whitespace);
+        return std::basic_string<CharT, Traits, Alloc>(trimmed.data(), trimmed.size(), str.get_allocator());
+    }
+
+    /**
+     * @brief Trims whitespace from the right of a string, reusing the storage of a temporary.
+     * @param str Input string, trimmed in place and moved into the result.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     * @return Trimmed string.
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    std::basic_string<CharT, Traits, Alloc> basic_str_trim_right(std::basic_string<CharT, Traits, Alloc>&& str,
+                                                                 detail::type_identity_t<basic_string_view<CharT, Traits>> whitespace =
+                                                                     detail::default_whitespace<CharT, Traits>())
+    {
+        detail::trim_inplace(str, detail::char_set_view<CharT, Traits>(whitespace), false, true);
+        return std::move(str);
+    }
+
+    /**
+     * @brief Trims whitespace from the right of a string in place.
+     * @param str String to trim.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    void basic_str_trim_right_inplace(std::basic_string<CharT, Traits, Alloc>& str,
+                                      detail::type_identity_t<basic_string_view<CharT, Traits>> whitespace = detail::default_whitespace<CharT, Traits>())
+    {
+        detail::trim_inplace(str, detail::char_set_view<CharT, Traits>(whitespace), false, true);
+    }
+
+    /**
+     * @brief Trims the members of a precompiled set from both ends of a string view without allocating.
+     * @param str Input string view.
+     * @param set Characters to trim, e.g. basic_char_set<CharT>::whitespace().
+     * @return View of the trimmed range of str; it refers to the same storage as str.
+     */
+    template <typename CharT, typename Traits>
+    basic_string_view<CharT, Traits> basic_str_trim_view(detail::type_identity_t<basic_string_view<CharT, Traits>> str,
+                                                         const basic_char_set<CharT, Traits>& set) noexcept
+    {
+        return detail::trim_view(str, set.view(), true, true);
+    }
+
+    /**
+     * @brief Trims the members of a precompiled set from the left of a string view without allocating.
+     * @param str Input string view.
+     * @param set Characters to trim, e.g. basic_char_set<CharT>::whitespace().
+     * @return View of the left-trimmed range of str; it refers to the same storage as str.
+     */
+    template <typename CharT, typename Traits>
+    basic_string_view<CharT, Traits> basic_str_trim_left_view(detail::type_identity_t<basic_string_view<CharT, Traits>> str,
+                                                              const basic_char_set<CharT, Traits>& set) noexcept
+    {
+        return detail::trim_view(str, set.view(), true, false);
+    }
+
+    /**
+     * @brief Trims the members of a precompiled set from the right of a string view without allocating.
+     * @param str Input string view.
+     * @param set Characters to trim, e.g. basic_char_set<CharT>::whitespace().
+     * @return View of the right-trimmed range of str; it refers to the same storage as str.
      */
-    enum class string_compare_type
+    template <typename CharT, typename Traits>
+    basic_string_view<CharT, Traits> basic_str_trim_right_view(detail::type_identity_t<basic_string_view<CharT, Traits>> str,
+                                                               const basic_char_set<CharT, Traits>& set) noexcept
     {
-        ordinal,             ///< Case-sensitive comparison.
-        ordinal_ignore_case, ///< Case-insensitive comparison.
-    };
+        return detail::trim_view(str, set.view(), false, true);
+    }
 
     /**
-     * @brief String split options for swe string utilities.
+     * @brief Trims the members of a precompiled set from both ends of a string in place.
+     * @param str String to trim.
+     * @param set Characters to trim.
      */
-    enum class string_split_options
+    template <typename CharT, typename Traits, typename Alloc>
+    void basic_str_trim_inplace(std::basic_string<CharT, Traits, Alloc>& str, const basic_char_set<CharT, Traits>& set)
     {
-        none = 0,                     ///< No options.
-        remove_empty_entries = 1,     ///< Remove empty entries from the result.
-        trim_left = 2,                ///< Trim whitespace from the left of each entry.
-        trim_right = 4,               ///< Trim whitespace from the right of each entry.
-        trim = trim_left | trim_right ///< Trim whitespace from both ends of each entry.
-    };
+        detail::trim_inplace(str, set.view(), true, true);
+    }
 
     /**
-     * @brief Bitwise OR operator for string_split_options.
+     * @brief Trims the members of a precompiled set from the left of a string in place.
+     * @param str String to trim.
+     * @param set Characters to trim.
      */
-    string_split_options operator|(string_split_options lhs, string_split_options rhs);
+    template <typename CharT, typename Traits, typename Alloc>
+    void basic_str_trim_left_inplace(std::basic_string<CharT, Traits, Alloc>& str, const basic_char_set<CharT, Traits>& set)
+    {
+        detail::trim_inplace(str, set.view(), true, false);
+    }
 
     /**
-     * @brief Bitwise AND operator for string_split_options.
+     * @brief Trims the members of a precompiled set from the right of a string in place.
+     * @param str String to trim.
+     * @param set Characters to trim.
      */
-    string_split_options operator&(string_split_options lhs, string_split_options rhs);
+    template <typename CharT, typename Traits, typename Alloc>
+    void basic_str_trim_right_inplace(std::basic_string<CharT, Traits, Alloc>& str, const basic_char_set<CharT, Traits>& set)
+    {
+        detail::trim_inplace(str, set.view(), false, true);
+    }
 
     /**
-     * @brief Bitwise XOR operator for string_split_options.
+     * @brief Replaces all occurrences of a substring with another string.
+     * @param str Input string.
+     * @param from Substring to replace.
+     * @param to Replacement string.
+     * @return Modified string with replacements.
      */
-    string_split_options operator^(string_split_options lhs, string_split_options rhs);
+    template <typename CharT, typename Traits, typename Alloc>
+    std::basic_string<CharT, Traits, Alloc> basic_str_replace(const std::basic_string<CharT, Traits, Alloc>& str,
+                                                              detail::type_identity_t<basic_string_view<CharT, Traits>> from,
+                                                              detail::type_identity_t<basic_string_view<CharT, Traits>> to)
+    {
+        return detail::replace(str, from, to);
+    }
 
     /**
-     * @brief Bitwise NOT operator for string_split_options.
+     * @brief Replaces all occurrences of a substring, reusing the storage of a temporary.
+     * @param str Input string, modified in place and moved into the result.
+     * @param from Substring to replace.
+     * @param to Replacement string.
+     * @return Modified string with replacements.
      */
-    string_split_options operator~(string_split_options lhs);
+    template <typename CharT, typename Traits, typename Alloc>
+    std::basic_string<CharT, Traits, Alloc> basic_str_replace(std::basic_string<CharT, Traits, Alloc>&& str,
+                                                              detail::type_identity_t<basic_string_view<CharT, Traits>> from,
+                                                              detail::type_identity_t<basic_string_view<CharT, Traits>> to)
+    {
+        detail::replace_inplace(str, from, to);
+        return std::move(str);
+    }
 
     /**
-     * @brief Bitwise OR assignment operator for string_split_options.
+     * @brief Replaces all occurrences of a substring in place.
+     *
+     * When from and to have the same length the matches are overwritten where they stand, and a
+     * shorter replacement compacts the string within its own buffer. A longer replacement
+     * allocates the result once, at its exact final size.
+     *
+     * @param str String to modify.
+     * @param from Substring to replace.
+     * @param to Replacement string.
      */
-    string_split_options& operator|=(string_split_options& lhs, string_split_options rhs);
+    template <typename CharT, typename Traits, typename Alloc>
+    void basic_str_replace_inplace(std::basic_string<CharT, Traits, Alloc>& str, detail::type_identity_t<basic_string_view<CharT, Traits>> from,
+                                   detail::type_identity_t<basic_string_view<CharT, Traits>> to)
+    {
+        detail::replace_inplace(str, from, to);
+    }
 
     /**
-     * @brief Bitwise AND assignment operator for string_split_options.
+     * @brief Checks if a string starts with a given prefix.
+     *
+     * With ordinal_ignore_case, UTF-8, UTF-16 and UTF-32 strings are compared with Unicode simple case
+     * folding and wchar_t strings with std::towlower.
+     *
+     * @param str Input string.
+     * @param prefix Prefix string.
+     * @param compare_type Comparison type (case-sensitive or case-insensitive).
+     * @return True if str starts with prefix, false otherwise.
      */
-    string_split_options& operator&=(string_split_options& lhs, string_split_options rhs);
+    template <typename CharT, typename Traits = std::char_traits<CharT>>
+    bool basic_str_starts_with(detail::type_identity_t<basic_string_view<CharT, Traits>> str, detail::type_identity_t<basic_string_view<CharT, Traits>> prefix,
+                               string_compare_type compare_type = string_compare_type::ordinal) noexcept
+    {
+        return detail::has_prefix(str, prefix, compare_type, detail::encoding_of<CharT>());
+    }
 
     /**
-     * @brief Bitwise XOR assignment operator for string_split_options.
+     * @brief Checks if a string ends with a given suffix.
+     * @param str Input string.
+     * @param suffix Suffix string.
+     * @param compare_type Comparison type (case-sensitive or case-insensitive).
+     * @return True if str ends with suffix, false otherwise.
+     */
+    template <typename CharT, typename Traits = std::char_traits<CharT>>
+    bool basic_str_ends_with(detail::type_identity_t<basic_string_view<CharT, Traits>> str, detail::type_identity_t<basic_string_view<CharT, Traits>> suffix,
+                             string_compare_type compare_type = string_compare_type::ordinal) noexcept
+    {
+        return detail::has_suffix(str, suffix, compare_type, detail::encoding_of<CharT>());
+    }
+
+    /**
+     * @brief Compares two strings for equality.
+     * @param str1 First string.
+     * @param str2 Second string.
+     * @param compare_type Comparison type (case-sensitive or case-insensitive).
+     * @return True if strings are equal, false otherwise.
      */
-    string_split_options& operator^=(string_split_options& lhs, string_split_options rhs);
+    template <typename CharT, typename Traits = std::char_traits<CharT>>
+    bool basic_str_equals(detail::type_identity_t<basic_string_view<CharT, Traits>> str1, detail::type_identity_t<basic_string_view<CharT, Traits>> str2,
+                          string_compare_type compare_type = string_compare_type::ordinal) noexcept
+    {
+        return detail::equal_strings(str1, str2, compare_type, detail::encoding_of<CharT>());
+    }
+
+    /**
+     * @brief Finds the first occurrence of a substring in a string.
+     *
+     * Byte-sized strings are searched with the SIMD find kernels. For repeated searches of the same
+     * needle, build a swe::basic_searcher once instead.
+     *
+     * @param str Input string.
+     * @param needle Substring to search for.
+     * @param pos Position at which to start searching.
+     * @return Position of the first occurrence at or after pos, or npos. An empty needle is found at pos.
+     */
+    template <typename CharT, typename Traits = std::char_traits<CharT>>
+    size_t basic_str_find(detail::type_identity_t<basic_string_view<CharT, Traits>> str, detail::type_identity_t<basic_string_view<CharT, Traits>> needle,
+                          size_t pos = 0)
+    {
+        return detail::find_chars(str, needle, pos, detail::is_byte_string<CharT, Traits>());
+    }
+
+    /**
+     * @brief Finds the first occurrence of a substring in a string under a comparison type.
+     *
+     * Neither string is copied. With ordinal_ignore_case_ascii, byte-sized strings are searched with SIMD
+     * kernels that fold the needle's first and last byte. With ordinal_ignore_case, UTF-8 needles made of
+     * ASCII characters other than 's' and 'k' take the same path; any other UTF-8 needle is located by
+     * filtering on its folded first character and verified with Unicode simple case folding, so the
+     * match may span a different number of bytes than the needle. Other character types are compared
+     * position by position with the same folding as basic_str_equals.
+     *
+     * @param str Input string.
+     * @param needle Substring to search for.
+     * @param compare_type Comparison type (case-sensitive or case-insensitive).
+     * @param pos Position at which to start searching.
+     * @return Position of the first occurrence at or after pos, or npos. An empty needle is found at pos.
+     */
+    template <typename CharT, typename Traits = std::char_traits<CharT>>
+    size_t basic_str_find(detail::type_identity_t<basic_string_view<CharT, Traits>> str, detail::type_identity_t<basic_string_view<CharT, Traits>> needle,
+                          string_compare_type compare_type, size_t pos = 0)
+    {
+        return detail::find_chars(str, needle, pos, compare_type);
+    }
+
+    /**
+     * @brief Checks whether a string contains a substring.
+     * @param str Input string.
+     * @param needle Substring to search for.
+     * @param compare_type Comparison type (case-sensitive or case-insensitive).
+     * @return True if needle occurs in str, false otherwise.
+     */
+    template <typename CharT, typename Traits = std::char_traits<CharT>>
+    bool basic_str_contains(detail::type_identity_t<basic_string_view<CharT, Traits>> str, detail::type_identity_t<basic_string_view<CharT, Traits>> needle,
+                            string_compare_type compare_type = string_compare_type::ordinal)
+    {
+        return detail::find_chars(str, needle, 0, compare_type) != basic_string_view<CharT, Traits>::npos;
+    }
+
+    /**
+     * @brief Counts the non-overlapping occurrences of a substring in a string.
+     * @param str Input string.
+     * @param needle Substring to count.
+     * @return Number of occurrences; 0 for an empty needle.
+     */
+    template <typename CharT, typename Traits = std::char_traits<CharT>>
+    size_t basic_str_count(detail::type_identity_t<basic_string_view<CharT, Traits>> str, detail::type_identity_t<basic_string_view<CharT, Traits>> needle)
+    {
+        return detail::count_chars(str, needle, detail::is_byte_string<CharT, Traits>());
+    }
+
+    /**
+     * @brief Splits a string by a delimiter character.
+     * @param str Input string.
+     * @param delimiter Delimiter character.
+     * @param options Split options.
+     * @return Vector of split substrings.
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    std::vector<std::basic_string<CharT, Traits, Alloc>> basic_str_split(const std::basic_string<CharT, Traits, Alloc>& str, detail::type_identity_t<CharT> delimiter,
+                                                                         string_split_options options = string_split_options::remove_empty_entries)
+    {
+        using view_type = basic_split_view<CharT, Traits>;
+        std::vector<std::basic_string<CharT, Traits, Alloc>> result;
+        const view_type tokens(basic_string_view<CharT, Traits>(str.data(), str.size()), delimiter, options, view_type::npos, split_direction::forward);
+        for (basic_string_view<CharT, Traits> token : tokens)
+            result.emplace_back(token.data(), token.size(), str.get_allocator());
+        return result;
+    }
+
+    /**
+     * @brief Splits a string on any character of a delimiter set.
+     *
+     * Each character of delimiters acts as a delimiter. Byte-sized strings are classified with SIMD
+     * byte-set kernels, so splitting on several delimiters takes a single pass.
+     *
+     * @param str Input string.
+     * @param delimiters Delimiter characters, e.g. ",;\t".
+     * @param options Split options.
+     * @return Vector of split substrings.
+     */
+    template <typename CharT, typename Traits = std::char_traits<CharT>, typename Alloc = std::allocator<CharT>>
+    std::vector<std::basic_string<CharT, Traits, Alloc>> basic_str_split_any(detail::type_identity_t<basic_string_view<CharT, Traits>> str,
+                                                                             detail::type_identity_t<basic_string_view<CharT, Traits>> delimiters,
+                                                                             string_split_options options = string_split_options::remove_empty_entries)
+    {
+        using view_type = basic_split_any_view<CharT, Traits>;
+        std::vector<std::basic_string<CharT, Traits, Alloc>> result;
+        for (basic_string_view<CharT, Traits> token : view_type(str, delimiters, options, view_type::npos))
+            result.emplace_back(token.data(), token.size());
+        return result;
+    }
+
+    /**
+     * @brief Splits a string on runs of whitespace, like Python's str.split().
+     * @param str Input string.
+     * @return Vector of the whitespace-separated words; empty if str holds only whitespace.
+     */
+    template <typename CharT, typename Traits = std::char_traits<CharT>, typename Alloc = std::allocator<CharT>>
+    std::vector<std::basic_string<CharT, Traits, Alloc>> basic_str_split_whitespace(detail::type_identity_t<basic_string_view<CharT, Traits>> str)
+    {
+        return basic_str_split_any<CharT, Traits, Alloc>(str, detail::default_whitespace<CharT, Traits>());
+    }
+
+    /**
+     * @brief Appends a range of string-like values, joined with a delimiter, to an existing string.
+     *
+     * Elements may be anything convertible to the string's view type. Nothing is inserted between the
+     * existing contents of out and the first element, and the output grows at most once.
+     *
+     * @param out String to append to.
+     * @param first Forward iterator to the first element.
+     * @param last Forward iterator past the last element.
+     * @param delimiter Delimiter string.
+     * @return Reference to out.
+     */
+    template <typename CharT, typename Traits, typename Alloc, typename ForwardIt>
+    std::basic_string<CharT, Traits, Alloc>& basic_str_join_append(std::basic_string<CharT, Traits, Alloc>& out, ForwardIt first, ForwardIt last,
+                                                                   detail::type_identity_t<basic_string_view<CharT, Traits>> delimiter)
+    {
+        detail::join_append(out, first, last, delimiter);
+        return out;
+    }
+
+    /**
+     * @brief Appends a container of string-like values, joined with a delimiter, to an existing string.
+     * @param out String to append to.
+     * @param strings Container (or array) of values convertible to the string's view type.
+     * @param delimiter Delimiter string.
+     * @return Reference to out.
+     */
+    template <typename CharT, typename Traits, typename Alloc, typename Range>
+    std::basic_string<CharT, Traits, Alloc>& basic_str_join_append(std::basic_string<CharT, Traits, Alloc>& out, const Range& strings,
+                                                                   detail::type_identity_t<basic_string_view<CharT, Traits>> delimiter)
+    {
+        detail::join_append(out, std::begin(strings), std::end(strings), delimiter);
+        return out;
+    }
+
+    /**
+     * @brief Joins a vector of strings with a delimiter.
+     * @param strings Vector of strings to join.
+     * @param delimiter Delimiter string.
+     * @return Joined string, allocated once at its final size.
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    std::basic_string<CharT, Traits, Alloc> basic_str_join(const std::vector<std::basic_string<CharT, Traits, Alloc>>& strings,
+                                                           detail::type_identity_t<basic_string_view<CharT, Traits>> delimiter)
+    {
+        std::basic_string<CharT, Traits, Alloc> result;
+        detail::join_append(result, strings.begin(), strings.end(), delimiter);
+        return result;
+    }
+
+    /**
+     * @brief Joins a range of string-like values with a delimiter, e.g. basic_str_join<char16_t>(first, last, u", ").
+     * @param first Forward iterator to the first element.
+     * @param last Forward iterator past the last element.
+     * @param delimiter Delimiter string.
+     * @return Joined string.
+     */
+    template <typename CharT, typename Traits = std::char_traits<CharT>, typename Alloc = std::allocator<CharT>, typename ForwardIt>
+    std::basic_string<CharT, Traits, Alloc> basic_str_join(ForwardIt first, ForwardIt last, detail::type_identity_t<basic_string_view<CharT, Traits>> delimiter)
+    {
+        std::basic_string<CharT, Traits, Alloc> result;
+        detail::join_append(result, first, last, delimiter);
+        return result;
+    }
+
+    /**
+     * @brief Obfuscates a string in place using a simple XOR cipher, wrapping the key around as needed.
+     * @param str String to transform.
+     * @param key Key for the XOR cipher. An empty key leaves the string unchanged.
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    void basic_str_obfuscate_inplace(std::basic_string<CharT, Traits, Alloc>& str, detail::type_identity_t<basic_string_view<CharT, Traits>> key) noexcept
+    {
+        detail::obfuscate_inplace(str, key);
+    }
+
+    /**
+     * @brief Obfuscates a string using a simple XOR cipher with a key.
+     * @param str Input string.
+     * @param key Key for the XOR cipher.
+     * @return Obfuscated string.
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    std::basic_string<CharT, Traits, Alloc> basic_str_obfuscate(const std::basic_string<CharT, Traits, Alloc>& str,
+                                                                detail::type_identity_t<basic_string_view<CharT, Traits>> key)
+    {
+        std::basic_string<CharT, Traits, Alloc> result(str);
+        detail::obfuscate_inplace(result, key);
+        return result;
+    }
+
+    /**
+     * @brief Obfuscates a string using a simple XOR cipher, reusing the storage of a temporary.
+     * @param str Input string, transformed in place and moved into the result.
+     * @param key Key for the XOR cipher.
+     * @return Obfuscated string.
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    std::basic_string<CharT, Traits, Alloc> basic_str_obfuscate(std::basic_string<CharT, Traits, Alloc>&& str,
+                                                                detail::type_identity_t<basic_string_view<CharT, Traits>> key) noexcept
+    {
+        detail::obfuscate_inplace(str, key);
+        return std::move(str);
+    }
+
+    /**
+     * @brief De-obfuscates a string in place; the XOR cipher is its own inverse.
+     * @param str String to transform.
+     * @param key Key the string was obfuscated with.
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    void basic_str_deobfuscate_inplace(std::basic_string<CharT, Traits, Alloc>& str, detail::type_identity_t<basic_string_view<CharT, Traits>> key) noexcept
+    {
+        detail::obfuscate_inplace(str, key);
+    }
+
+    /**
+     * @brief De-obfuscates a string; the XOR cipher is its own inverse.
+     * @param str Input string.
+     * @param key Key the string was obfuscated with.
+     * @return De-obfuscated string.
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    std::basic_string<CharT, Traits, Alloc> basic_str_deobfuscate(const std::basic_string<CharT, Traits, Alloc>& str,
+                                                                  detail::type_identity_t<basic_string_view<CharT, Traits>> key)
+    {
+        return basic_str_obfuscate(str, key);
+    }
+
+    /**
+     * @brief De-obfuscates a string, reusing the storage of a temporary.
+     * @param str Input string, transformed in place and moved into the result.
+     * @param key Key the string was obfuscated with.
+     * @return De-obfuscated string.
+     */
+    template <typename CharT, typename Traits, typename Alloc>
+    std::basic_string<CharT, Traits, Alloc> basic_str_deobfuscate(std::basic_string<CharT, Traits, Alloc>&& str,
+                                                                  detail::type_identity_t<basic_string_view<CharT, Traits>> key) noexcept
+    {
+        detail::obfuscate_inplace(str, key);
+        return std::move(str);
+    }
 
     // Narrow string (std::string) utilities
 
     /**
      * @brief Converts a string to lowercase.
+     *
+     * The string is treated as UTF-8 and every code point is mapped with its Unicode simple lower-case
+     * mapping, independent of the current C locale. Runs of ASCII are detected and converted with the
+     * widest SIMD instruction set supported by the CPU. Invalid UTF-8 bytes are copied unchanged.
+     *
      * @param str Input string.
      * @return Lowercase version of the input string.
      */
-    std::string str_to_lower(const std::string& str);
+    SWE_DECL std::string str_to_lower(const std::string& str);
+
+    /**
+     * @brief Converts a string to lowercase, reusing the storage of a temporary.
+     * @param str Input string, converted in place and moved into the result.
+     * @return Lowercase version of the input string.
+     */
+    SWE_DECL std::string str_to_lower(std::string&& str);
+
+    /**
+     * @brief Converts a string to lowercase in place.
+     * @param str String to convert.
+     */
+    SWE_DECL void str_to_lower_inplace(std::string& str);
 
     /**
      * @brief Converts a string to uppercase.
+     *
+     * The string is treated as UTF-8 and every code point is mapped with its Unicode simple upper-case
+     * mapping, independent of the current C locale; characters whose upper case is more than one code
+     * point, such as U+00DF, are left unchanged. Runs of ASCII are converted with SIMD.
+     *
      * @param str Input string.
      * @return Uppercase version of the input string.
      */
-    std::string str_to_upper(const std::string& str);
+    SWE_DECL std::string str_to_upper(const std::string& str);
+
+    /**
+     * @brief Converts a string to uppercase, reusing the storage of a temporary.
+     * @param str Input string, converted in place and moved into the result.
+     * @return Uppercase version of the input string.
+     */
+    SWE_DECL std::string str_to_upper(std::string&& str);
+
+    /**
+     * @brief Converts a string to uppercase in place.
+     * @param str String to convert.
+     */
+    SWE_DECL void str_to_upper_inplace(std::string& str);
 
     /**
      * @brief Converts a string to title case.
+     *
+     * The string is treated as UTF-8: the first code point of each word (words are separated by ASCII
+     * whitespace) gets its Unicode simple title-case mapping and the others their lower-case mapping.
+     *
      * @param str Input string.
      * @return Title-cased version of the input string.
      */
-    std::string str_to_title(const std::string& str);
+    SWE_DECL std::string str_to_title(const std::string& str);
+
+    /**
+     * @brief Converts a string to title case, reusing the storage of a temporary.
+     * @param str Input string, converted in place and moved into the result.
+     * @return Title-cased version of the input string.
+     */
+    SWE_DECL std::string str_to_title(std::string&& str);
+
+    /**
+     * @brief Converts a string to title case in place.
+     * @param str String to convert.
+     */
+    SWE_DECL void str_to_title_inplace(std::string& str);
 
     /**
      * @brief Converts a string to a slug (lowercase, alphanumeric, separator).
      * @param str Input string.
      * @param separator Character to use as separator (default '_').
+     * @param transliteration Transliteration applied before classifying (default none).
      * @return Slugified string.
      */
-    std::string str_to_slug(const std::string& str, char separator = '_');
+    SWE_DECL std::string str_to_slug(const std::string& str, char separator = '_', string_slug_transliteration transliteration = string_slug_transliteration::none);
+
+    /**
+     * @brief Converts a string to a slug, reusing the storage of a temporary.
+     * @param str Input string, converted in place and moved into the result.
+     * @param separator Character to use as separator (default '_').
+     * @param transliteration Transliteration applied before classifying (default none).
+     * @return Slugified string.
+     */
+    SWE_DECL std::string str_to_slug(std::string&& str, char separator = '_', string_slug_transliteration transliteration = string_slug_transliteration::none);
+
+    /**
+     * @brief Converts a string to a slug in place. The slug is never longer than the input.
+     * @param str String to convert.
+     * @param separator Character to use as separator (default '_').
+     * @param transliteration Transliteration applied before classifying (default none).
+     */
+    SWE_DECL void str_to_slug_inplace(std::string& str, char separator = '_', string_slug_transliteration transliteration = string_slug_transliteration::none);
 
     /**
      * @brief Trims whitespace from both ends of a string.
@@ -117,7 +906,22 @@ namespace swe
      * @param whitespace Characters to trim (default: space, tab, newline, etc.).
      * @return Trimmed string.
      */
-    std::string str_trim(const std::string& str, const std::string& whitespace = " \t\n\r\f\v");
+    SWE_DECL std::string str_trim(const std::string& str, string_view whitespace = " \t\n\r\f\v");
+
+    /**
+     * @brief Trims whitespace from both ends of a string, reusing the storage of a temporary.
+     * @param str Input string, trimmed in place and moved into the result.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     * @return Trimmed string.
+     */
+    SWE_DECL std::string str_trim(std::string&& str, string_view whitespace = " \t\n\r\f\v");
+
+    /**
+     * @brief Trims whitespace from both ends of a string in place.
+     * @param str String to trim.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     */
+    SWE_DECL void str_trim_inplace(std::string& str, string_view whitespace = " \t\n\r\f\v");
 
     /**
      * @brief Trims whitespace from the left of a string.
@@ -125,7 +929,22 @@ namespace swe
      * @param whitespace Characters to trim (default: space, tab, newline, etc.).
      * @return Left-trimmed string.
      */
-    std::string str_trim_left(const std::string& str, const std::string& whitespace = " \t\n\r\f\v");
+    SWE_DECL std::string str_trim_left(const std::string& str, string_view whitespace = " \t\n\r\f\v");
+
+    /**
+     * @brief Trims whitespace from the left of a string, reusing the storage of a temporary.
+     * @param str Input string, trimmed in place and moved into the result.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     * @return Trimmed string.
+     */
+    SWE_DECL std::string str_trim_left(std::string&& str, string_view whitespace = " \t\n\r\f\v");
+
+    /**
+     * @brief Trims whitespace from the left of a string in place.
+     * @param str String to trim.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     */
+    SWE_DECL void str_trim_left_inplace(std::string& str, string_view whitespace = " \t\n\r\f\v");
 
     /**
      * @brief Trims whitespace from the right of a string.
@@ -133,16 +952,149 @@ namespace swe
      * @param whitespace Characters to trim (default: space, tab, newline, etc.).
      * @return Right-trimmed string.
      */
-    std::string str_trim_right(const std::string& str, const std::string& whitespace = " \t\n\r\f\v");
+    SWE_DECL std::string str_trim_right(const std::string& str, string_view whitespace = " \t\n\r\f\v");
+
+    /**
+     * @brief Trims whitespace from the right of a string, reusing the storage of a temporary.
+     * @param str Input string, trimmed in place and moved into the result.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     * @return Trimmed string.
+     */
+    SWE_DECL std::string str_trim_right(std::string&& str, string_view whitespace = " \t\n\r\f\v");
+
+    /**
+     * @brief Trims whitespace from the right of a string in place.
+     * @param str String to trim.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     */
+    SWE_DECL void str_trim_right_inplace(std::string& str, string_view whitespace = " \t\n\r\f\v");
+
+    /**
+     * @brief Trims whitespace from both ends of a string view without allocating.
+     * @param str Input string view.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     * @return View of the trimmed range of str; it refers to the same storage as str.
+     */
+    inline string_view str_trim_view(string_view str, string_view whitespace = " \t\n\r\f\v") noexcept
+    {
+        return basic_str_trim_view<char>(str, whitespace);
+    }
+
+    /**
+     * @brief Trims whitespace from the left of a string view without allocating.
+     * @param str Input string view.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     * @return View of the left-trimmed range of str; it refers to the same storage as str.
+     */
+    inline string_view str_trim_left_view(string_view str, string_view whitespace = " \t\n\r\f\v") noexcept
+    {
+        return basic_str_trim_left_view<char>(str, whitespace);
+    }
+
+    /**
+     * @brief Trims whitespace from the right of a string view without allocating.
+     * @param str Input string view.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     * @return View of the right-trimmed range of str; it refers to the same storage as str.
+     */
+    inline string_view str_trim_right_view(string_view str, string_view whitespace = " \t\n\r\f\v") noexcept
+    {
+        return basic_str_trim_right_view<char>(str, whitespace);
+    }
+
+    /**
+     * @brief Trims the members of a precompiled set from both ends of a string view without allocating.
+     * @param str Input string view.
+     * @param set Characters to trim.
+     * @return View of the trimmed range of str; it refers to the same storage as str.
+     */
+    inline string_view str_trim_view(string_view str, const char_set& set) noexcept
+    {
+        return basic_str_trim_view<char>(str, set);
+    }
+
+    /**
+     * @brief Trims the members of a precompiled set from the left of a string view without allocating.
+     * @param str Input string view.
+     * @param set Characters to trim.
+     * @return View of the left-trimmed range of str; it refers to the same storage as str.
+     */
+    inline string_view str_trim_left_view(string_view str, const char_set& set) noexcept
+    {
+        return basic_str_trim_left_view<char>(str, set);
+    }
+
+    /**
+     * @brief Trims the members of a precompiled set from the right of a string view without allocating.
+     * @param str Input string view.
+     * @param set Characters to trim.
+     * @return View of the right-trimmed range of str; it refers to the same storage as str.
+     */
+    inline string_view str_trim_right_view(string_view str, const char_set& set) noexcept
+    {
+        return basic_str_trim_right_view<char>(str, set);
+    }
+
+    /**
+     * @brief Trims the members of a precompiled set from both ends of a string in place.
+     * @param str String to trim.
+     * @param set Characters to trim.
+     */
+    inline void str_trim_inplace(std::string& str, const char_set& set)
+    {
+        basic_str_trim_inplace(str, set);
+    }
+
+    /**
+     * @brief Trims the members of a precompiled set from the left of a string in place.
+     * @param str String to trim.
+     * @param set Characters to trim.
+     */
+    inline void str_trim_left_inplace(std::string& str, const char_set& set)
+    {
+        basic_str_trim_left_inplace(str, set);
+    }
+
+    /**
+     * @brief Trims the members of a precompiled set from the right of a string in place.
+     * @param str String to trim.
+     * @param set Characters to trim.
+     */
+    inline void str_trim_right_inplace(std::string& str, const char_set& set)
+    {
+        basic_str_trim_right_inplace(str, set);
+    }
+
+    /**
+     * @brief Replaces all occurrences of a substring with another string.
+     * @param str Input string.
+     * @param from Substring to replace.
+     * @param to Replacement string.
+     * @return Modified string with replacements.
+     */
+    SWE_DECL std::string str_replace(const std::string& str, string_view from, string_view to);
+
+    /**
+     * @brief Replaces all occurrences of a substring, reusing the storage of a temporary.
+     * @param str Input string, modified in place and moved into the result.
+     * @param from Substring to replace.
+     * @param to Replacement string.
+     * @return Modified string with replacements.
+     */
+    SWE_DECL std::string str_replace(std::string&& str, string_view from, string_view to);
 
     /**
-     * @brief Replaces all occurrences of a substring with another string.
-     * @param str Input string.
+     * @brief Replaces all occurrences of a substring in place.
+     *
+     * When from and to have the same length the matches are overwritten where they stand, and a
+     * shorter replacement compacts the string within its own buffer. A longer replacement
+     * allocates the result once, at its exact final size.
+     *
+     * @param str String to modify.
      * @param from Substring to replace.
      * @param to Replacement string.
-     * @return Modified string with replacements.
      */
-    std::string str_replace(const std::string& str, const std::string& from, const std::string& to);
+    SWE_DECL void str_replace_inplace(std::string& str, string_view from, string_view to);
 
     /**
      * @brief Checks if a string starts with a given prefix.
@@ -151,7 +1103,10 @@ namespace swe
      * @param compare_type Comparison type (case-sensitive or case-insensitive).
      * @return True if str starts with prefix, false otherwise.
      */
-    bool str_starts_with(const std::string& str, const std::string& prefix, string_compare_type compare_type = string_compare_type::ordinal);
+    inline bool str_starts_with(string_view str, string_view prefix, string_compare_type compare_type = string_compare_type::ordinal) noexcept
+    {
+        return basic_str_starts_with<char>(str, prefix, compare_type);
+    }
 
     /**
      * @brief Checks if a string ends with a given suffix.
@@ -160,7 +1115,10 @@ namespace swe
      * @param compare_type Comparison type (case-sensitive or case-insensitive).
      * @return True if str ends with suffix, false otherwise.
      */
-    bool str_ends_with(const std::string& str, const std::string& suffix, string_compare_type compare_type = string_compare_type::ordinal);
+    inline bool str_ends_with(string_view str, string_view suffix, string_compare_type compare_type = string_compare_type::ordinal) noexcept
+    {
+        return basic_str_ends_with<char>(str, suffix, compare_type);
+    }
 
     /**
      * @brief Compares two strings for equality.
@@ -169,7 +1127,61 @@ namespace swe
      * @param compare_type Comparison type (case-sensitive or case-insensitive).
      * @return True if strings are equal, false otherwise.
      */
-    bool str_equals(const std::string& str1, const std::string& str2, string_compare_type compare_type = string_compare_type::ordinal);
+    inline bool str_equals(string_view str1, string_view str2, string_compare_type compare_type = string_compare_type::ordinal) noexcept
+    {
+        return basic_str_equals<char>(str1, str2, compare_type);
+    }
+
+    /**
+     * @brief Finds the first occurrence of a substring in a string.
+     *
+     * For repeated searches of the same needle, build a swe::basic_searcher once instead.
+     *
+     * @param str Input string.
+     * @param needle Substring to search for.
+     * @param pos Position at which to start searching.
+     * @return Position of the first occurrence at or after pos, or string_view::npos. An empty needle is found at pos.
+     */
+    inline size_t str_find(string_view str, string_view needle, size_t pos = 0)
+    {
+        return basic_str_find<char>(str, needle, pos);
+    }
+
+    /**
+     * @brief Finds the first occurrence of a substring in a string under a comparison type, without copying either string.
+     * @param str Input string.
+     * @param needle Substring to search for.
+     * @param compare_type Comparison type (case-sensitive or case-insensitive).
+     * @param pos Position at which to start searching.
+     * @return Position of the first occurrence at or after pos, or string_view::npos. An empty needle is found at pos.
+     */
+    inline size_t str_find(string_view str, string_view needle, string_compare_type compare_type, size_t pos = 0)
+    {
+        return basic_str_find<char>(str, needle, compare_type, pos);
+    }
+
+    /**
+     * @brief Checks whether a string contains a substring.
+     * @param str Input string.
+     * @param needle Substring to search for.
+     * @param compare_type Comparison type (case-sensitive or case-insensitive).
+     * @return True if needle occurs in str, false otherwise.
+     */
+    inline bool str_contains(string_view str, string_view needle, string_compare_type compare_type = string_compare_type::ordinal)
+    {
+        return basic_str_contains<char>(str, needle, compare_type);
+    }
+
+    /**
+     * @brief Counts the non-overlapping occurrences of a substring in a string.
+     * @param str Input string.
+     * @param needle Substring to count.
+     * @return Number of occurrences; 0 for an empty needle.
+     */
+    inline size_t str_count(string_view str, string_view needle)
+    {
+        return basic_str_count<char>(str, needle);
+    }
 
     /**
      * @brief Splits a string by a delimiter character.
@@ -177,43 +1189,156 @@ namespace swe
      * @param delimiter Delimiter character.
      * @return Vector of split substrings.
      */
-    std::vector<std::string> str_split(const std::string& str, char delimiter, string_split_options options = string_split_options::remove_empty_entries);
+    SWE_DECL std::vector<std::string> str_split(const std::string& str, char delimiter, string_split_options options = string_split_options::remove_empty_entries);
+
+    /**
+     * @brief Splits a string on any character of a delimiter set.
+     *
+     * Each character of delimiters acts as a delimiter; the input is classified with SIMD byte-set
+     * kernels, so splitting on several delimiters takes a single pass.
+     *
+     * @param str Input string.
+     * @param delimiters Delimiter characters, e.g. ",;\t".
+     * @param options Split options.
+     * @return Vector of split substrings.
+     */
+    SWE_DECL std::vector<std::string> str_split_any(string_view str, string_view delimiters, string_split_options options = string_split_options::remove_empty_entries);
+
+    /**
+     * @brief Splits a string on runs of whitespace, like Python's str.split().
+     * @param str Input string.
+     * @return Vector of the whitespace-separated words; empty if str holds only whitespace.
+     */
+    SWE_DECL std::vector<std::string> str_split_whitespace(string_view str);
 
     /**
      * @brief Joins a vector of strings with a delimiter.
      * @param strings Vector of strings to join.
      * @param delimiter Delimiter string.
+     * @return Joined string, allocated once at its final size.
+     */
+    SWE_DECL std::string str_join(const std::vector<std::string>& strings, string_view delimiter);
+
+    /**
+     * @brief Joins a range of string-like values with a delimiter.
+     *
+     * Elements may be anything convertible to swe::string_view, such as std::string, string_view or
+     * character pointers. The range is walked twice, so the result is allocated once at its final size.
+     *
+     * @param first Forward iterator to the first element.
+     * @param last Forward iterator past the last element.
+     * @param delimiter Delimiter string.
+     * @return Joined string.
+     */
+    template <typename ForwardIt>
+    std::string str_join(ForwardIt first, ForwardIt last, string_view delimiter)
+    {
+        std::string result;
+        detail::join_append(result, first, last, delimiter);
+        return result;
+    }
+
+    /**
+     * @brief Joins a container of string-like values with a delimiter.
+     * @param strings Container (or array) of values convertible to swe::string_view.
+     * @param delimiter Delimiter string.
      * @return Joined string.
      */
-    std::string str_join(const std::vector<std::string>& strings, const std::string& delimiter);
+    template <typename Range>
+    std::string str_join(const Range& strings, string_view delimiter)
+    {
+        return str_join(std::begin(strings), std::end(strings), delimiter);
+    }
+
+    /**
+     * @brief Appends a range of string-like values, joined with a delimiter, to an existing string.
+     *
+     * Nothing is inserted between the existing contents of out and the first element. The output
+     * grows at most once, so repeated calls can build a line into a reused buffer.
+     *
+     * @param out String to append to.
+     * @param first Forward iterator to the first element.
+     * @param last Forward iterator past the last element.
+     * @param delimiter Delimiter string.
+     * @return Reference to out.
+     */
+    template <typename ForwardIt>
+    std::string& str_join_append(std::string& out, ForwardIt first, ForwardIt last, string_view delimiter)
+    {
+        detail::join_append(out, first, last, delimiter);
+        return out;
+    }
+
+    /**
+     * @brief Appends a container of string-like values, joined with a delimiter, to an existing string.
+     * @param out String to append to.
+     * @param strings Container (or array) of values convertible to swe::string_view.
+     * @param delimiter Delimiter string.
+     * @return Reference to out.
+     */
+    template <typename Range>
+    std::string& str_join_append(std::string& out, const Range& strings, string_view delimiter)
+    {
+        return str_join_append(out, std::begin(strings), std::end(strings), delimiter);
+    }
 
     /**
      * @brief Obfuscates a string using a simple XOR cipher with a key.
      * 
      * This function performs a simple XOR operation on each character of the input string
      * with the corresponding character of the key. If the key is shorter than the string,     * 
-     * it wraps around to the beginning of the key.
+     * it wraps around to the beginning of the key. An empty key leaves the string unchanged.
      * 
      * @param str Input string.
      * @param key Key for the XOR cipher.
      * 
      * @return Obfuscated string.
      */
-    std::string str_obfuscate(const std::string& str, const std::string& key);
+    SWE_DECL std::string str_obfuscate(const std::string& str, string_view key);
+
+    /**
+     * @brief Obfuscates a string using a simple XOR cipher, reusing the storage of a temporary.
+     * @param str Input string, transformed in place and moved into the result.
+     * @param key Key for the XOR cipher.
+     * @return Obfuscated string.
+     */
+    SWE_DECL std::string str_obfuscate(std::string&& str, string_view key);
+
+    /**
+     * @brief Obfuscates a string in place using a simple XOR cipher.
+     * @param str String to transform.
+     * @param key Key for the XOR cipher.
+     */
+    SWE_DECL void str_obfuscate_inplace(std::string& str, string_view key);
 
     /**
      * @brief De-obfuscates a string using a simple XOR cipher with a key.
      * 
      * This function reverses the obfuscation process by performing a simple XOR operation
      * on each character of the input string with the corresponding character of the key.
-     * If the key is shorter than the string, it wraps around to the beginning of the key.
+     * If the key is shorter than the string, it wraps around to the beginning of the key. An empty key leaves the string unchanged.
      * 
      * @param str Input string.
      * @param key Key for the XOR cipher.
      * 
      * @return De-obfuscated string.
      */
-    std::string str_deobfuscate(const std::string& str, const std::string& key);
+    SWE_DECL std::string str_deobfuscate(const std::string& str, string_view key);
+
+    /**
+     * @brief De-obfuscates a string using a simple XOR cipher, reusing the storage of a temporary.
+     * @param str Input string, transformed in place and moved into the result.
+     * @param key Key for the XOR cipher.
+     * @return De-obfuscated string.
+     */
+    SWE_DECL std::string str_deobfuscate(std::string&& str, string_view key);
+
+    /**
+     * @brief De-obfuscates a string in place using a simple XOR cipher.
+     * @param str String to transform.
+     * @param key Key for the XOR cipher.
+     */
+    SWE_DECL void str_deobfuscate_inplace(std::string& str, string_view key);
 
     // Wide string (std::wstring) utilities
 
@@ -222,29 +1347,86 @@ namespace swe
      * @param str Input wide string.
      * @return Lowercase version of the input wide string.
      */
-    std::wstring wstr_to_lower(const std::wstring& str);
+    SWE_DECL std::wstring wstr_to_lower(const std::wstring& str);
+
+    /**
+     * @brief Converts a wide string to lowercase, reusing the storage of a temporary.
+     * @param str Input wide string, converted in place and moved into the result.
+     * @return Lowercase version of the input wide string.
+     */
+    SWE_DECL std::wstring wstr_to_lower(std::wstring&& str);
+
+    /**
+     * @brief Converts a wide string to lowercase in place.
+     * @param str Wide string to convert.
+     */
+    SWE_DECL void wstr_to_lower_inplace(std::wstring& str);
 
     /**
      * @brief Converts a wide string to uppercase.
      * @param str Input wide string.
      * @return Uppercase version of the input wide string.
      */
-    std::wstring wstr_to_upper(const std::wstring& str);
+    SWE_DECL std::wstring wstr_to_upper(const std::wstring& str);
+
+    /**
+     * @brief Converts a wide string to uppercase, reusing the storage of a temporary.
+     * @param str Input wide string, converted in place and moved into the result.
+     * @return Uppercase version of the input wide string.
+     */
+    SWE_DECL std::wstring wstr_to_upper(std::wstring&& str);
+
+    /**
+     * @brief Converts a wide string to uppercase in place.
+     * @param str Wide string to convert.
+     */
+    SWE_DECL void wstr_to_upper_inplace(std::wstring& str);
 
     /**
      * @brief Converts a wide string to title case.
      * @param str Input wide string.
      * @return Title-cased version of the input wide string.
      */
-    std::wstring wstr_to_title(const std::wstring& str);
+    SWE_DECL std::wstring wstr_to_title(const std::wstring& str);
+
+    /**
+     * @brief Converts a wide string to title case, reusing the storage of a temporary.
+     * @param str Input wide string, converted in place and moved into the result.
+     * @return Title-cased version of the input wide string.
+     */
+    SWE_DECL std::wstring wstr_to_title(std::wstring&& str);
+
+    /**
+     * @brief Converts a wide string to title case in place.
+     * @param str Wide string to convert.
+     */
+    SWE_DECL void wstr_to_title_inplace(std::wstring& str);
 
     /**
      * @brief Converts a wide string to a slug (lowercase, alphanumeric, separator).
      * @param str Input wide string.
      * @param separator Separator character (default L'_').
+     * @param transliteration Transliteration applied before classifying (default none).
+     * @return Slugified wide string.
+     */
+    SWE_DECL std::wstring wstr_to_slug(const std::wstring& str, wchar_t separator = L'_', string_slug_transliteration transliteration = string_slug_transliteration::none);
+
+    /**
+     * @brief Converts a wide string to a slug, reusing the storage of a temporary.
+     * @param str Input wide string, converted in place and moved into the result.
+     * @param separator Character to use as separator (default L'_').
+     * @param transliteration Transliteration applied before classifying (default none).
      * @return Slugified wide string.
      */
-    std::wstring wstr_to_slug(const std::wstring& str, wchar_t separator = L'_');
+    SWE_DECL std::wstring wstr_to_slug(std::wstring&& str, wchar_t separator = L'_', string_slug_transliteration transliteration = string_slug_transliteration::none);
+
+    /**
+     * @brief Converts a wide string to a slug in place. Without transliteration the slug is never longer than the input.
+     * @param str Wide string to convert.
+     * @param separator Character to use as separator (default L'_').
+     * @param transliteration Transliteration applied before classifying (default none).
+     */
+    SWE_DECL void wstr_to_slug_inplace(std::wstring& str, wchar_t separator = L'_', string_slug_transliteration transliteration = string_slug_transliteration::none);
 
     /**
      * @brief Trims whitespace from both ends of a wide string.
@@ -252,7 +1434,22 @@ namespace swe
      * @param whitespace Characters to trim (default: space, tab, newline, etc.).
      * @return Trimmed wide string.
      */
-    std::wstring wstr_trim(const std::wstring& str, const std::wstring& whitespace = L" \t\n\r\f\v");
+    SWE_DECL std::wstring wstr_trim(const std::wstring& str, wstring_view whitespace = L" \t\n\r\f\v");
+
+    /**
+     * @brief Trims whitespace from both ends of a wide string, reusing the storage of a temporary.
+     * @param str Input wide string, trimmed in place and moved into the result.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     * @return Trimmed wide string.
+     */
+    SWE_DECL std::wstring wstr_trim(std::wstring&& str, wstring_view whitespace = L" \t\n\r\f\v");
+
+    /**
+     * @brief Trims whitespace from both ends of a wide string in place.
+     * @param str Wide string to trim.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     */
+    SWE_DECL void wstr_trim_inplace(std::wstring& str, wstring_view whitespace = L" \t\n\r\f\v");
 
     /**
      * @brief Trims whitespace from the left of a wide string.
@@ -260,7 +1457,22 @@ namespace swe
      * @param whitespace Characters to trim (default: space, tab, newline, etc.).
      * @return Left-trimmed wide string.
      */
-    std::wstring wstr_trim_left(const std::wstring& str, const std::wstring& whitespace = L" \t\n\r\f\v");
+    SWE_DECL std::wstring wstr_trim_left(const std::wstring& str, wstring_view whitespace = L" \t\n\r\f\v");
+
+    /**
+     * @brief Trims whitespace from the left of a wide string, reusing the storage of a temporary.
+     * @param str Input wide string, trimmed in place and moved into the result.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     * @return Trimmed wide string.
+     */
+    SWE_DECL std::wstring wstr_trim_left(std::wstring&& str, wstring_view whitespace = L" \t\n\r\f\v");
+
+    /**
+     * @brief Trims whitespace from the left of a wide string in place.
+     * @param str Wide string to trim.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     */
+    SWE_DECL void wstr_trim_left_inplace(std::wstring& str, wstring_view whitespace = L" \t\n\r\f\v");
 
     /**
      * @brief Trims whitespace from the right of a wide string.
@@ -268,7 +1480,118 @@ namespace swe
      * @param whitespace Characters to trim (default: space, tab, newline, etc.).
      * @return Right-trimmed wide string.
      */
-    std::wstring wstr_trim_right(const std::wstring& str, const std::wstring& whitespace = L" \t\n\r\f\v");
+    SWE_DECL std::wstring wstr_trim_right(const std::wstring& str, wstring_view whitespace = L" \t\n\r\f\v");
+
+    /**
+     * @brief Trims whitespace from the right of a wide string, reusing the storage of a temporary.
+     * @param str Input wide string, trimmed in place and moved into the result.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     * @return Trimmed wide string.
+     */
+    SWE_DECL std::wstring wstr_trim_right(std::wstring&& str, wstring_view whitespace = L" \t\n\r\f\v");
+
+    /**
+     * @brief Trims whitespace from the right of a wide string in place.
+     * @param str Wide string to trim.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     */
+    SWE_DECL void wstr_trim_right_inplace(std::wstring& str, wstring_view whitespace = L" \t\n\r\f\v");
+
+    /**
+     * @brief Trims whitespace from both ends of a wide string view without allocating.
+     * @param str Input wide string view.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     * @return View of the trimmed range of str; it refers to the same storage as str.
+     */
+    inline wstring_view wstr_trim_view(wstring_view str, wstring_view whitespace = L" \t\n\r\f\v") noexcept
+    {
+        return basic_str_trim_view<wchar_t>(str, whitespace);
+    }
+
+    /**
+     * @brief Trims whitespace from the left of a wide string view without allocating.
+     * @param str Input wide string view.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     * @return View of the left-trimmed range of str; it refers to the same storage as str.
+     */
+    inline wstring_view wstr_trim_left_view(wstring_view str, wstring_view whitespace = L" \t\n\r\f\v") noexcept
+    {
+        return basic_str_trim_left_view<wchar_t>(str, whitespace);
+    }
+
+    /**
+     * @brief Trims whitespace from the right of a wide string view without allocating.
+     * @param str Input wide string view.
+     * @param whitespace Characters to trim (default: space, tab, newline, etc.).
+     * @return View of the right-trimmed range of str; it refers to the same storage as str.
+     */
+    inline wstring_view wstr_trim_right_view(wstring_view str, wstring_view whitespace = L" \t\n\r\f\v") noexcept
+    {
+        return basic_str_trim_right_view<wchar_t>(str, whitespace);
+    }
+
+    /**
+     * @brief Trims the members of a precompiled set from both ends of a wide string view without allocating.
+     * @param str Input wide string view.
+     * @param set Characters to trim.
+     * @return View of the trimmed range of str; it refers to the same storage as str.
+     */
+    inline wstring_view wstr_trim_view(wstring_view str, const wchar_set& set) noexcept
+    {
+        return basic_str_trim_view<wchar_t>(str, set);
+    }
+
+    /**
+     * @brief Trims the members of a precompiled set from the left of a wide string view without allocating.
+     * @param str Input wide string view.
+     * @param set Characters to trim.
+     * @return View of the left-trimmed range of str; it refers to the same storage as str.
+     */
+    inline wstring_view wstr_trim_left_view(wstring_view str, const wchar_set& set) noexcept
+    {
+        return basic_str_trim_left_view<wchar_t>(str, set);
+    }
+
+    /**
+     * @brief Trims the members of a precompiled set from the right of a wide string view without allocating.
+     * @param str Input wide string view.
+     * @param set Characters to trim.
+     * @return View of the right-trimmed range of str; it refers to the same storage as str.
+     */
+    inline wstring_view wstr_trim_right_view(wstring_view str, const wchar_set& set) noexcept
+    {
+        return basic_str_trim_right_view<wchar_t>(str, set);
+    }
+
+    /**
+     * @brief Trims the members of a precompiled set from both ends of a wide string in place.
+     * @param str Wide string to trim.
+     * @param set Characters to trim.
+     */
+    inline void wstr_trim_inplace(std::wstring& str, const wchar_set& set)
+    {
+        basic_str_trim_inplace(str, set);
+    }
+
+    /**
+     * @brief Trims the members of a precompiled set from the left of a wide string in place.
+     * @param str Wide string to trim.
+     * @param set Characters to trim.
+     */
+    inline void wstr_trim_left_inplace(std::wstring& str, const wchar_set& set)
+    {
+        basic_str_trim_left_inplace(str, set);
+    }
+
+    /**
+     * @brief Trims the members of a precompiled set from the right of a wide string in place.
+     * @param str Wide string to trim.
+     * @param set Characters to trim.
+     */
+    inline void wstr_trim_right_inplace(std::wstring& str, const wchar_set& set)
+    {
+        basic_str_trim_right_inplace(str, set);
+    }
 
     /**
      * @brief Replaces all occurrences of a substring with another wide string.
@@ -277,7 +1600,29 @@ namespace swe
      * @param to Replacement wide string.
      * @return Modified wide string with replacements.
      */
-    std::wstring wstr_replace(const std::wstring& str, const std::wstring& from, const std::wstring& to);
+    SWE_DECL std::wstring wstr_replace(const std::wstring& str, wstring_view from, wstring_view to);
+
+    /**
+     * @brief Replaces all occurrences of a substring, reusing the storage of a temporary.
+     * @param str Input wide string, modified in place and moved into the result.
+     * @param from Substring to replace.
+     * @param to Replacement wide string.
+     * @return Modified wide string with replacements.
+     */
+    SWE_DECL std::wstring wstr_replace(std::wstring&& str, wstring_view from, wstring_view to);
+
+    /**
+     * @brief Replaces all occurrences of a substring in place.
+     *
+     * When from and to have the same length the matches are overwritten where they stand, and a
+     * shorter replacement compacts the wide string within its own buffer. A longer replacement
+     * allocates the result once, at its exact final size.
+     *
+     * @param str Wide string to modify.
+     * @param from Substring to replace.
+     * @param to Replacement wide string.
+     */
+    SWE_DECL void wstr_replace_inplace(std::wstring& str, wstring_view from, wstring_view to);
 
     /**
      * @brief Checks if a wide string starts with a given prefix.
@@ -286,7 +1631,10 @@ namespace swe
      * @param compare_type Comparison type (case-sensitive or case-insensitive).
      * @return True if str starts with prefix, false otherwise.
      */
-    bool wstr_starts_with(const std::wstring& str, const std::wstring& prefix, string_compare_type compare_type = string_compare_type::ordinal);
+    inline bool wstr_starts_with(wstring_view str, wstring_view prefix, string_compare_type compare_type = string_compare_type::ordinal) noexcept
+    {
+        return basic_str_starts_with<wchar_t>(str, prefix, compare_type);
+    }
 
     /**
      * @brief Checks if a wide string ends with a given suffix.
@@ -295,7 +1643,10 @@ namespace swe
      * @param compare_type Comparison type (case-sensitive or case-insensitive).
      * @return True if str ends with suffix, false otherwise.
      */
-    bool wstr_ends_with(const std::wstring& str, const std::wstring& suffix, string_compare_type compare_type = string_compare_type::ordinal);
+    inline bool wstr_ends_with(wstring_view str, wstring_view suffix, string_compare_type compare_type = string_compare_type::ordinal) noexcept
+    {
+        return basic_str_ends_with<wchar_t>(str, suffix, compare_type);
+    }
 
     /**
      * @brief Compares two wide strings for equality.
@@ -304,7 +1655,61 @@ namespace swe
      * @param compare_type Comparison type (case-sensitive or case-insensitive).
      * @return True if wide strings are equal, false otherwise.
      */
-    bool wstr_equals(const std::wstring& str1, const std::wstring& str2, string_compare_type compare_type = string_compare_type::ordinal);
+    inline bool wstr_equals(wstring_view str1, wstring_view str2, string_compare_type compare_type = string_compare_type::ordinal) noexcept
+    {
+        return basic_str_equals<wchar_t>(str1, str2, compare_type);
+    }
+
+    /**
+     * @brief Finds the first occurrence of a substring in a wide string.
+     *
+     * For repeated searches of the same needle, build a swe::basic_searcher once instead.
+     *
+     * @param str Input wide string.
+     * @param needle Substring to search for.
+     * @param pos Position at which to start searching.
+     * @return Position of the first occurrence at or after pos, or wstring_view::npos. An empty needle is found at pos.
+     */
+    inline size_t wstr_find(wstring_view str, wstring_view needle, size_t pos = 0)
+    {
+        return basic_str_find<wchar_t>(str, needle, pos);
+    }
+
+    /**
+     * @brief Finds the first occurrence of a substring in a wide string under a comparison type, without copying either string.
+     * @param str Input wide string.
+     * @param needle Substring to search for.
+     * @param compare_type Comparison type (case-sensitive or case-insensitive).
+     * @param pos Position at which to start searching.
+     * @return Position of the first occurrence at or after pos, or wstring_view::npos. An empty needle is found at pos.
+     */
+    inline size_t wstr_find(wstring_view str, wstring_view needle, string_compare_type compare_type, size_t pos = 0)
+    {
+        return basic_str_find<wchar_t>(str, needle, compare_type, pos);
+    }
+
+    /**
+     * @brief Checks whether a wide string contains a substring.
+     * @param str Input wide string.
+     * @param needle Substring to search for.
+     * @param compare_type Comparison type (case-sensitive or case-insensitive).
+     * @return True if needle occurs in str, false otherwise.
+     */
+    inline bool wstr_contains(wstring_view str, wstring_view needle, string_compare_type compare_type = string_compare_type::ordinal)
+    {
+        return basic_str_contains<wchar_t>(str, needle, compare_type);
+    }
+
+    /**
+     * @brief Counts the non-overlapping occurrences of a substring in a wide string.
+     * @param str Input wide string.
+     * @param needle Substring to count.
+     * @return Number of occurrences; 0 for an empty needle.
+     */
+    inline size_t wstr_count(wstring_view str, wstring_view needle)
+    {
+        return basic_str_count<wchar_t>(str, needle);
+    }
 
     /**
      * @brief Splits a wide string by a delimiter character.
@@ -312,42 +1717,159 @@ namespace swe
      * @param delimiter Delimiter character.
      * @return Vector of split wide substrings.
      */
-    std::vector<std::wstring> wstr_split(const std::wstring& str, wchar_t delimiter, string_split_options options = string_split_options::remove_empty_entries);
+    SWE_DECL std::vector<std::wstring> wstr_split(const std::wstring& str, wchar_t delimiter, string_split_options options = string_split_options::remove_empty_entries);
+
+    /**
+     * @brief Splits a wide string on any character of a delimiter set.
+     *
+     * Each character of delimiters acts as a delimiter; the input is classified with SIMD byte-set
+     * kernels, so splitting on several delimiters takes a single pass.
+     *
+     * @param str Input wide string.
+     * @param delimiters Delimiter characters, e.g. ",;\t".
+     * @param options Split options.
+     * @return Vector of split substrings.
+     */
+    SWE_DECL std::vector<std::wstring> wstr_split_any(wstring_view str, wstring_view delimiters, string_split_options options = string_split_options::remove_empty_entries);
+
+    /**
+     * @brief Splits a wide string on runs of whitespace, like Python's str.split().
+     * @param str Input wide string.
+     * @return Vector of the whitespace-separated words; empty if str holds only whitespace.
+     */
+    SWE_DECL std::vector<std::wstring> wstr_split_whitespace(wstring_view str);
 
     /**
      * @brief Joins a vector of wide strings with a delimiter.
      * @param strings Vector of wide strings to join.
      * @param delimiter Delimiter wide string.
+     * @return Joined wide string, allocated once at its final size.
+     */
+    SWE_DECL std::wstring wstr_join(const std::vector<std::wstring>& strings, wstring_view delimiter);
+
+    /**
+     * @brief Joins a range of wide string-like values with a delimiter.
+     *
+     * Elements may be anything convertible to swe::wstring_view, such as std::wstring, wstring_view or
+     * character pointers. The range is walked twice, so the result is allocated once at its final size.
+     *
+     * @param first Forward iterator to the first element.
+     * @param last Forward iterator past the last element.
+     * @param delimiter Delimiter wide string.
+     * @return Joined wide string.
+     */
+    template <typename ForwardIt>
+    std::wstring wstr_join(ForwardIt first, ForwardIt last, wstring_view delimiter)
+    {
+        std::wstring result;
+        detail::join_append(result, first, last, delimiter);
+        return result;
+    }
+
+    /**
+     * @brief Joins a container of wide string-like values with a delimiter.
+     * @param strings Container (or array) of values convertible to swe::wstring_view.
+     * @param delimiter Delimiter wide string.
      * @return Joined wide string.
      */
-    std::wstring wstr_join(const std::vector<std::wstring>& strings, const std::wstring& delimiter);
+    template <typename Range>
+    std::wstring wstr_join(const Range& strings, wstring_view delimiter)
+    {
+        return wstr_join(std::begin(strings), std::end(strings), delimiter);
+    }
+
+    /**
+     * @brief Appends a range of wide string-like values, joined with a delimiter, to an existing wide string.
+     *
+     * Nothing is inserted between the existing contents of out and the first element. The output
+     * grows at most once, so repeated calls can build a line into a reused buffer.
+     *
+     * @param out Wide string to append to.
+     * @param first Forward iterator to the first element.
+     * @param last Forward iterator past the last element.
+     * @param delimiter Delimiter wide string.
+     * @return Reference to out.
+     */
+    template <typename ForwardIt>
+    std::wstring& wstr_join_append(std::wstring& out, ForwardIt first, ForwardIt last, wstring_view delimiter)
+    {
+        detail::join_append(out, first, last, delimiter);
+        return out;
+    }
+
+    /**
+     * @brief Appends a container of wide string-like values, joined with a delimiter, to an existing wide string.
+     * @param out Wide string to append to.
+     * @param strings Container (or array) of values convertible to swe::wstring_view.
+     * @param delimiter Delimiter wide string.
+     * @return Reference to out.
+     */
+    template <typename Range>
+    std::wstring& wstr_join_append(std::wstring& out, const Range& strings, wstring_view delimiter)
+    {
+        return wstr_join_append(out, std::begin(strings), std::end(strings), delimiter);
+    }
 
     /**
      * @brief Obfuscates a wide string using a simple XOR cipher with a key.
      * 
      * This function performs a simple XOR operation on each character of the input wide string
      * with the corresponding character of the key. If the key is shorter than the string, it wraps
-     * around to the beginning of the key.
+     * around to the beginning of the key. An empty key leaves the string unchanged.
      * 
      * @param str Input wide string.
      * @param key Key for the XOR cipher.
      * 
      * @return Obfuscated wide string.
      */
-    std::wstring wstr_obfuscate(const std::wstring& str, const std::wstring& key);
+    SWE_DECL std::wstring wstr_obfuscate(const std::wstring& str, wstring_view key);
+
+    /**
+     * @brief Obfuscates a wide string using a simple XOR cipher, reusing the storage of a temporary.
+     * @param str Input wide string, transformed in place and moved into the result.
+     * @param key Key for the XOR cipher.
+     * @return Obfuscated wide string.
+     */
+    SWE_DECL std::wstring wstr_obfuscate(std::wstring&& str, wstring_view key);
+
+    /**
+     * @brief Obfuscates a wide string in place using a simple XOR cipher.
+     * @param str Wide string to transform.
+     * @param key Key for the XOR cipher.
+     */
+    SWE_DECL void wstr_obfuscate_inplace(std::wstring& str, wstring_view key);
 
     /**
      * @brief De-obfuscates a wide string using a simple XOR cipher with a key.
      * 
      * This function reverses the obfuscation process by performing a simple XOR operation
      * on each character of the input wide string with the corresponding character of the key.
-     * If the key is shorter than the string, it wraps around to the beginning of the key.
+     * If the key is shorter than the string, it wraps around to the beginning of the key. An empty key leaves the string unchanged.
      * 
      * @param str Input wide string.
      * @param key Key for the XOR cipher.
      * 
      * @return De-obfuscated wide string.
      */
-    std::wstring wstr_deobfuscate(const std::wstring& str, const std::wstring& key);
+    SWE_DECL std::wstring wstr_deobfuscate(const std::wstring& str, wstring_view key);
+
+    /**
+     * @brief De-obfuscates a wide string using a simple XOR cipher, reusing the storage of a temporary.
+     * @param str Input wide string, transformed in place and moved into the result.
+     * @param key Key for the XOR cipher.
+     * @return De-obfuscated wide string.
+     */
+    SWE_DECL std::wstring wstr_deobfuscate(std::wstring&& str, wstring_view key);
+
+    /**
+     * @brief De-obfuscates a wide string in place using a simple XOR cipher.
+     * @param str Wide string to transform.
+     * @param key Key for the XOR cipher.
+     */
+    SWE_DECL void wstr_deobfuscate_inplace(std::wstring& str, wstring_view key);
+
+} // namespace swe
 
-} // namespace swe
\ No newline at end of file
+#if defined(SWE_HEADER_ONLY)
+#include "detail/string.ipp"
+#endif
\ No newline at end of file
@@ -0,0 +1,88 @@
+/**
+ * @file string_options.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Comparison, slug and split option enumerations shared by the SWE string utilities.
+ *
+ * These enumerations are used by string.hpp, split_view.hpp and ci_map.hpp. They live in their own
+ * header so that the split views can be used by the string utilities without a circular include.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "detail/config.hpp"
+
+namespace swe
+{
+    /**
+     * @brief String comparison type for swe string utilities.
+     */
+    enum class string_compare_type
+    {
+        ordinal,                   ///< Case-sensitive comparison.
+        ordinal_ignore_case,       ///< Case-insensitive comparison; UTF-8, UTF-16 and UTF-32 strings compare with Unicode simple case folding.
+        ordinal_ignore_case_ascii, ///< Case-insensitive for ASCII letters only; locale-free and compared eight bytes at a time.
+    };
+
+    /**
+     * @brief Transliteration applied by the slug utilities before classifying characters.
+     */
+    enum class string_slug_transliteration
+    {
+        none,  ///< No transliteration.
+        latin, ///< Accented Latin letters (U+00C0 to U+017F) become their ASCII spelling, e.g. U+00E4 "a" and U+00DF "ss".
+    };
+
+    /**
+     * @brief String split options for swe string utilities.
+     */
+    enum class string_split_options
+    {
+        none = 0,                     ///< No options.
+        remove_empty_entries = 1,     ///< Remove empty entries from the result.
+        trim_left = 2,                ///< Trim whitespace from the left of each entry.
+        trim_right = 4,               ///< Trim whitespace from the right of each entry.
+        trim = trim_left | trim_right ///< Trim whitespace from both ends of each entry.
+    };
+
+    /**
+     * @brief Bitwise OR operator for string_split_options.
+     */
+    SWE_DECL string_split_options operator|(string_split_options lhs, string_split_options rhs);
+
+    /**
+     * @brief Bitwise AND operator for string_split_options.
+     */
+    SWE_DECL string_split_options operator&(string_split_options lhs, string_split_options rhs);
+
+    /**
+     * @brief Bitwise XOR operator for string_split_options.
+     */
+    SWE_DECL string_split_options operator^(string_split_options lhs, string_split_options rhs);
+
+    /**
+     * @brief Bitwise NOT operator for string_split_options.
+     */
+    SWE_DECL string_split_options operator~(string_split_options lhs);
+
+    /**
+     * @brief Bitwise OR assignment operator for string_split_options.
+     */
+    SWE_DECL string_split_options& operator|=(string_split_options& lhs, string_split_options rhs);
+
+    /**
+     * @brief Bitwise AND assignment operator for string_split_options.
+     */
+    SWE_DECL string_split_options& operator&=(string_split_options& lhs, string_split_options rhs);
+
+    /**
+     * @brief Bitwise XOR assignment operator for string_split_options.
+     */
+    SWE_DECL string_split_options& operator^=(string_split_options& lhs, string_split_options rhs);
+} // namespace swe
+
+#if defined(SWE_HEADER_ONLY)
+#include "detail/string_options.ipp"
+#endif
\ No newline at end of file
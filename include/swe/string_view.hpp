@@ -0,0 +1,629 @@
+/**
+ * @file string_view.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Non-owning string view type for the SWE library.
+ *
+ * This header provides swe::basic_string_view, a lightweight reference to a contiguous
+ * sequence of characters. When compiled as C++17 or later it is an alias of
+ * std::basic_string_view; for C++11/14 a compatible implementation is provided so that
+ * the view based string utilities can be used on every supported standard.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "detail/config.hpp"
+
+#include <string>
+
+#if SWE_HAS_STD_STRING_VIEW
+#include <string_view>
+#endif
+
+#if !SWE_USE_STD_STRING_VIEW
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#endif
+
+namespace swe
+{
+    namespace detail
+    {
+        /**
+         * @brief Blocks template argument deduction, so that a parameter converts to the type deduced from the others.
+         */
+        template <typename T>
+        struct type_identity
+        {
+            using type = T;
+        };
+
+        template <typename T>
+        using type_identity_t = typename type_identity<T>::type;
+    } // namespace detail
+
+#if SWE_USE_STD_STRING_VIEW
+
+    /**
+     * @brief Non-owning view of a character sequence (alias of std::basic_string_view).
+     * @tparam CharT Character type.
+     * @tparam Traits Character traits type.
+     */
+    template <typename CharT, typename Traits = std::char_traits<CharT>>
+    using basic_string_view = std::basic_string_view<CharT, Traits>;
+
+#else
+
+    /**
+     * @brief Non-owning view of a character sequence, compatible with std::basic_string_view.
+     *
+     * A view never allocates; it stores a pointer and a length into storage owned by someone else,
+     * so it must not outlive the string or buffer it refers to.
+     *
+     * @tparam CharT Character type.
+     * @tparam Traits Character traits type.
+     */
+    template <typename CharT, typename Traits = std::char_traits<CharT>>
+    class basic_string_view
+    {
+      public:
+        using traits_type = Traits;
+        using value_type = CharT;
+        using pointer = CharT*;
+        using const_pointer = const CharT*;
+        using reference = CharT&;
+        using const_reference = const CharT&;
+        using const_iterator = const CharT*;
+        using iterator = const_iterator;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+        using reverse_iterator = const_reverse_iterator;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        /**
+         * @brief Special value meaning "not found" or "until the end".
+         */
+        static constexpr size_type npos = size_type(-1);
+
+        /**
+         * @brief Constructs an empty view.
+         */
+        constexpr basic_string_view() noexcept : _data(nullptr), _size(0)
+        {
+        }
+
+        /**
+         * @brief Constructs a view of the first count characters of str.
+         */
+        constexpr basic_string_view(const CharT* str, size_type count) noexcept : _data(str), _size(count)
+        {
+        }
+
+        /**
+         * @brief Constructs a view of a null-terminated character string.
+         */
+        basic_string_view(const CharT* str) noexcept : _data(str), _size(Traits::length(str))
+        {
+        }
+
+        /**
+         * @brief Constructs a view of the contents of a std::basic_string.
+         */
+        template <typename Alloc>
+        basic_string_view(const std::basic_string<CharT, Traits, Alloc>& str) noexcept : _data(str.data()), _size(str.size())
+        {
+        }
+
+        constexpr basic_string_view(const basic_string_view&) noexcept = default;
+        basic_string_view& operator=(const basic_string_view&) noexcept = default;
+
+        /**
+         * @brief Explicitly copies the viewed characters into a std::basic_string.
+         */
+        template <typename Alloc>
+        explicit operator std::basic_string<CharT, Traits, Alloc>() const
+        {
+            return std::basic_string<CharT, Traits, Alloc>(_data, _size);
+        }
+
+#if SWE_HAS_STD_STRING_VIEW
+        /**
+         * @brief Constructs a view of the same characters as a std::basic_string_view.
+         */
+        constexpr basic_string_view(std::basic_string_view<CharT, Traits> str) noexcept : _data(str.data()), _size(str.size())
+        {
+        }
+
+        /**
+         * @brief Converts to a std::basic_string_view of the same characters.
+         */
+        constexpr operator std::basic_string_view<CharT, Traits>() const noexcept
+        {
+            return std::basic_string_view<CharT, Traits>(_data, _size);
+        }
+#endif
+
+        // Iterators
+
+        constexpr const_iterator begin() const noexcept
+        {
+            return _data;
+        }
+
+        constexpr const_iterator end() const noexcept
+        {
+            return _data + _size;
+        }
+
+        constexpr const_iterator cbegin() const noexcept
+        {
+            return begin();
+        }
+
+        constexpr const_iterator cend() const noexcept
+        {
+            return end();
+        }
+
+        const_reverse_iterator rbegin() const noexcept
+        {
+            return const_reverse_iterator(end());
+        }
+
+        const_reverse_iterator rend() const noexcept
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        const_reverse_iterator crbegin() const noexcept
+        {
+            return rbegin();
+        }
+
+        const_reverse_iterator crend() const noexcept
+        {
+            return rend();
+        }
+
+        // Capacity
+
+        constexpr size_type size() const noexcept
+        {
+            return _size;
+        }
+
+        constexpr size_type length() const noexcept
+        {
+            return _size;
+        }
+
+        constexpr size_type max_size() const noexcept
+        {
+            return npos / sizeof(CharT);
+        }
+
+        constexpr bool empty() const noexcept
+        {
+            return _size == 0;
+        }
+
+        // Element access
+
+        constexpr const_reference operator[](size_type pos) const noexcept
+        {
+            return _data[pos];
+        }
+
+        const_reference at(size_type pos) const
+        {
+            if (pos >= _size)
+                throw std::out_of_range("swe::basic_string_view::at");
+            return _data[pos];
+        }
+
+        constexpr const_reference front() const noexcept
+        {
+            return _data[0];
+        }
+
+        constexpr const_reference back() const noexcept
+        {
+            return _data[_size - 1];
+        }
+
+        constexpr const_pointer data() const noexcept
+        {
+            return _data;
+        }
+
+        // Modifiers
+
+        void remove_prefix(size_type n) noexcept
+        {
+            _data += n;
+            _size -= n;
+        }
+
+        void remove_suffix(size_type n) noexcept
+        {
+            _size -= n;
+        }
+
+        void swap(basic_string_view& other) noexcept
+        {
+            std::swap(_data, other._data);
+            std::swap(_size, other._size);
+        }
+
+        // Operations
+
+        size_type copy(CharT* dest, size_type count, size_type pos = 0) const
+        {
+            if (pos > _size)
+                throw std::out_of_range("swe::basic_string_view::copy");
+            const size_type rlen = (std::min)(count, _size - pos);
+            Traits::copy(dest, _data + pos, rlen);
+            return rlen;
+        }
+
+        basic_string_view substr(size_type pos = 0, size_type count = npos) const
+        {
+            if (pos > _size)
+                throw std::out_of_range("swe::basic_string_view::substr");
+            return basic_string_view(_data + pos, (std::min)(count, _size - pos));
+        }
+
+        int compare(basic_string_view other) const noexcept
+        {
+            const size_type rlen = (std::min)(_size, other._size);
+            const int result = Traits::compare(_data, other._data, rlen);
+            if (result != 0)
+                return result;
+            return _size < other._size ? -1 : (_size > other._size ? 1 : 0);
+        }
+
+        int compare(size_type pos1, size_type count1, basic_string_view other) const
+        {
+            return substr(pos1, count1).compare(other);
+        }
+
+        int compare(size_type pos1, size_type count1, basic_string_view other, size_type pos2, size_type count2) const
+        {
+            return substr(pos1, count1).compare(other.substr(pos2, count2));
+        }
+
+        int compare(const CharT* str) const
+        {
+            return compare(basic_string_view(str));
+        }
+
+        int compare(size_type pos1, size_type count1, const CharT* str) const
+        {
+            return substr(pos1, count1).compare(basic_string_view(str));
+        }
+
+        int compare(size_type pos1, size_type count1, const CharT* str, size_type count2) const
+        {
+            return substr(pos1, count1).compare(basic_string_view(str, count2));
+        }
+
+        // Searching
+
+        size_type find(basic_string_view str, size_type pos = 0) const noexcept
+        {
+            if (str._size > _size || pos > _size - str._size)
+                return npos;
+            if (str._size == 0)
+                return pos;
+            const CharT* last = _data + (_size - str._size) + 1;
+            for (const CharT* it = _data + pos; it != last; ++it)
+            {
+                it = Traits::find(it, static_cast<size_type>(last - it), str._data[0]);
+                if (!it)
+                    return npos;
+                if (Traits::compare(it, str._data, str._size) == 0)
+                    return static_cast<size_type>(it - _data);
+            }
+            return npos;
+        }
+
+        size_type find(CharT ch, size_type pos = 0) const noexcept
+        {
+            if (pos >= _size)
+                return npos;
+            const CharT* it = Traits::find(_data + pos, _size - pos, ch);
+            return it ? static_cast<size_type>(it - _data) : npos;
+        }
+
+        size_type find(const CharT* str, size_type pos, size_type count) const noexcept
+        {
+            return find(basic_string_view(str, count), pos);
+        }
+
+        size_type find(const CharT* str, size_type pos = 0) const noexcept
+        {
+            return find(basic_string_view(str), pos);
+        }
+
+        size_type rfind(basic_string_view str, size_type pos = npos) const noexcept
+        {
+            if (str._size > _size)
+                return npos;
+            size_type i = (std::min)(pos, _size - str._size);
+            for (;;)
+            {
+                if (Traits::compare(_data + i, str._data, str._size) == 0)
+                    return i;
+                if (i == 0)
+                    return npos;
+                --i;
+            }
+        }
+
+        size_type rfind(CharT ch, size_type pos = npos) const noexcept
+        {
+            return rfind(basic_string_view(&ch, 1), pos);
+        }
+
+        size_type rfind(const CharT* str, size_type pos, size_type count) const noexcept
+        {
+            return rfind(basic_string_view(str, count), pos);
+        }
+
+        size_type rfind(const CharT* str, size_type pos = npos) const noexcept
+        {
+            return rfind(basic_string_view(str), pos);
+        }
+
+        size_type find_first_of(basic_string_view set, size_type pos = 0) const noexcept
+        {
+            for (size_type i = pos; i < _size; ++i)
+                if (Traits::find(set._data, set._size, _data[i]))
+                    return i;
+            return npos;
+        }
+
+        size_type find_first_of(CharT ch, size_type pos = 0) const noexcept
+        {
+            return find(ch, pos);
+        }
+
+        size_type find_first_of(const CharT* set, size_type pos, size_type count) const noexcept
+        {
+            return find_first_of(basic_string_view(set, count), pos);
+        }
+
+        size_type find_first_of(const CharT* set, size_type pos = 0) const noexcept
+        {
+            return find_first_of(basic_string_view(set), pos);
+        }
+
+        size_type find_last_of(basic_string_view set, size_type pos = npos) const noexcept
+        {
+            if (_size == 0)
+                return npos;
+            for (size_type i = (std::min)(pos, _size - 1) + 1; i-- > 0;)
+                if (Traits::find(set._data, set._size, _data[i]))
+                    return i;
+            return npos;
+        }
+
+        size_type find_last_of(CharT ch, size_type pos = npos) const noexcept
+        {
+            return rfind(ch, pos);
+        }
+
+        size_type find_last_of(const CharT* set, size_type pos, size_type count) const noexcept
+        {
+            return find_last_of(basic_string_view(set, count), pos);
+        }
+
+        size_type find_last_of(const CharT* set, size_type pos = npos) const noexcept
+        {
+            return find_last_of(basic_string_view(set), pos);
+        }
+
+        size_type find_first_not_of(basic_string_view set, size_type pos = 0) const noexcept
+        {
+            for (size_type i = pos; i < _size; ++i)
+                if (!Traits::find(set._data, set._size, _data[i]))
+                    return i;
+            return npos;
+        }
+
+        size_type find_first_not_of(CharT ch, size_type pos = 0) const noexcept
+        {
+            return find_first_not_of(basic_string_view(&ch, 1), pos);
+        }
+
+        size_type find_first_not_of(const CharT* set, size_type pos, size_type count) const noexcept
+        {
+            return find_first_not_of(basic_string_view(set, count), pos);
+        }
+
+        size_type find_first_not_of(const CharT* set, size_type pos = 0) const noexcept
+        {
+            return find_first_not_of(basic_string_view(set), pos);
+        }
+
+        size_type find_last_not_of(basic_string_view set, size_type pos = npos) const noexcept
+        {
+            if (_size == 0)
+                return npos;
+            for (size_type i = (std::min)(pos, _size - 1) + 1; i-- > 0;)
+                if (!Traits::find(set._data, set._size, _data[i]))
+                    return i;
+            return npos;
+        }
+
+        size_type find_last_not_of(CharT ch, size_type pos = npos) const noexcept
+        {
+            return find_last_not_of(basic_string_view(&ch, 1), pos);
+        }
+
+        size_type find_last_not_of(const CharT* set, size_type pos, size_type count) const noexcept
+        {
+            return find_last_not_of(basic_string_view(set, count), pos);
+        }
+
+        size_type find_last_not_of(const CharT* set, size_type pos = npos) const noexcept
+        {
+            return find_last_not_of(basic_string_view(set), pos);
+        }
+
+      private:
+        const CharT* _data;
+        size_type _size;
+    };
+
+    template <typename CharT, typename Traits>
+    constexpr typename basic_string_view<CharT, Traits>::size_type basic_string_view<CharT, Traits>::npos;
+
+    // Comparison operators. The type_identity overloads allow comparing against anything
+    // implicitly convertible to a view (std::basic_string, null-terminated strings).
+
+    template <typename CharT, typename Traits>
+    bool operator==(basic_string_view<CharT, Traits> lhs, basic_string_view<CharT, Traits> rhs) noexcept
+    {
+        return lhs.size() == rhs.size() && lhs.compare(rhs) == 0;
+    }
+
+    template <typename CharT, typename Traits>
+    bool operator==(basic_string_view<CharT, Traits> lhs, detail::type_identity_t<basic_string_view<CharT, Traits>> rhs) noexcept
+    {
+        return lhs.size() == rhs.size() && lhs.compare(rhs) == 0;
+    }
+
+    template <typename CharT, typename Traits>
+    bool operator==(detail::type_identity_t<basic_string_view<CharT, Traits>> lhs, basic_string_view<CharT, Traits> rhs) noexcept
+    {
+        return lhs.size() == rhs.size() && lhs.compare(rhs) == 0;
+    }
+
+    template <typename CharT, typename Traits>
+    bool operator!=(basic_string_view<CharT, Traits> lhs, basic_string_view<CharT, Traits> rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename CharT, typename Traits>
+    bool operator!=(basic_string_view<CharT, Traits> lhs, detail::type_identity_t<basic_string_view<CharT, Traits>> rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename CharT, typename Traits>
+    bool operator!=(detail::type_identity_t<basic_string_view<CharT, Traits>> lhs, basic_string_view<CharT, Traits> rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename CharT, typename Traits>
+    bool operator<(basic_string_view<CharT, Traits> lhs, basic_string_view<CharT, Traits> rhs) noexcept
+    {
+        return lhs.compare(rhs) < 0;
+    }
+
+    template <typename CharT, typename Traits>
+    bool operator<(basic_string_view<CharT, Traits> lhs, detail::type_identity_t<basic_string_view<CharT, Traits>> rhs) noexcept
+    {
+        return lhs.compare(rhs) < 0;
+    }
+
+    template <typename CharT, typename Traits>
+    bool operator<(detail::type_identity_t<basic_string_view<CharT, Traits>> lhs, basic_string_view<CharT, Traits> rhs) noexcept
+    {
+        return lhs.compare(rhs) < 0;
+    }
+
+    template <typename CharT, typename Traits>
+    bool operator>(basic_string_view<CharT, Traits> lhs, basic_string_view<CharT, Traits> rhs) noexcept
+    {
+        return lhs.compare(rhs) > 0;
+    }
+
+    template <typename CharT, typename Traits>
+    bool operator>(basic_string_view<CharT, Traits> lhs, detail::type_identity_t<basic_string_view<CharT, Traits>> rhs) noexcept
+    {
+        return lhs.compare(rhs) > 0;
+    }
+
+    template <typename CharT, typename Traits>
+    bool operator>(detail::type_identity_t<basic_string_view<CharT, Traits>> lhs, basic_string_view<CharT, Traits> rhs) noexcept
+    {
+        return lhs.compare(rhs) > 0;
+    }
+
+    template <typename CharT, typename Traits>
+    bool operator<=(basic_string_view<CharT, Traits> lhs, basic_string_view<CharT, Traits> rhs) noexcept
+    {
+        return lhs.compare(rhs) <= 0;
+    }
+
+    template <typename CharT, typename Traits>
+    bool operator<=(basic_string_view<CharT, Traits> lhs, detail::type_identity_t<basic_string_view<CharT, Traits>> rhs) noexcept
+    {
+        return lhs.compare(rhs) <= 0;
+    }
+
+    template <typename CharT, typename Traits>
+    bool operator<=(detail::type_identity_t<basic_string_view<CharT, Traits>> lhs, basic_string_view<CharT, Traits> rhs) noexcept
+    {
+        return lhs.compare(rhs) <= 0;
+    }
+
+    template <typename CharT, typename Traits>
+    bool operator>=(basic_string_view<CharT, Traits> lhs, basic_string_view<CharT, Traits> rhs) noexcept
+    {
+        return lhs.compare(rhs) >= 0;
+    }
+
+    template <typename CharT, typename Traits>
+    bool operator>=(basic_string_view<CharT, Traits> lhs, detail::type_identity_t<basic_string_view<CharT, Traits>> rhs) noexcept
+    {
+        return lhs.compare(rhs) >= 0;
+    }
+
+    template <typename CharT, typename Traits>
+    bool operator>=(detail::type_identity_t<basic_string_view<CharT, Traits>> lhs, basic_string_view<CharT, Traits> rhs) noexcept
+    {
+        return lhs.compare(rhs) >= 0;
+    }
+
+    /**
+     * @brief Writes the viewed characters to an output stream.
+     */
+    template <typename CharT, typename Traits>
+    std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, basic_string_view<CharT, Traits> view)
+    {
+        return os.write(view.data(), static_cast<std::streamsize>(view.size()));
+    }
+
+#endif
+
+    /**
+     * @brief View of a narrow (char) character sequence.
+     */
+    using string_view = basic_string_view<char>;
+
+    /**
+     * @brief View of a wide (wchar_t) character sequence.
+     */
+    using wstring_view = basic_string_view<wchar_t>;
+
+    /**
+     * @brief View of a UTF-16 (char16_t) character sequence.
+     */
+    using u16string_view = basic_string_view<char16_t>;
+
+    /**
+     * @brief View of a UTF-32 (char32_t) character sequence.
+     */
+    using u32string_view = basic_string_view<char32_t>;
+
+} // namespace swe
\ No newline at end of file
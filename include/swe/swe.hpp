@@ -14,6 +14,8 @@
  */
 #pragma once
 
+#include "detail/config.hpp"
+
 #include <string>
 
 /**
@@ -56,14 +58,14 @@ namespace swe
      * 
      * @return A string representing the version of the library.
      */
-    std::string get_version();
+    SWE_DECL std::string get_version();
 
     /**
      * @brief Version string of the library.
      * 
      * @return A wide string representing the version of the library.
      */
-    std::wstring get_wversion();
+    SWE_DECL std::wstring get_wversion();
 
     /**
      * @brief Get the version of the library as major, minor, and patch numbers.
@@ -72,14 +74,14 @@ namespace swe
      * @param minor Pointer to store the minor version number.
      * @param patch Pointer to store the patch version number.
      */
-    void get_version(int* major, int* minor, int* patch);
+    SWE_DECL void get_version(int* major, int* minor, int* patch);
 
     /**
      * @brief Get the version number of the library as an integer.
      * 
      * @return The version number in the format (major * 1,000,000) + (minor * 1,000) + patch.
      */
-    int get_version_number();
+    SWE_DECL int get_version_number();
 
     /**
      * @brief Check if the current version exactly matches the specified major, minor, and patch numbers.
@@ -95,5 +97,9 @@ namespace swe
      * 
      * @return true if the version matches; false otherwise.
      */
-    bool check_version(int major, int minor, int patch);
-} // namespace swe
\ No newline at end of file
+    SWE_DECL bool check_version(int major, int minor, int patch);
+} // namespace swe
+
+#if defined(SWE_HEADER_ONLY)
+#include "detail/swe.ipp"
+#endif
\ No newline at end of file
@@ -0,0 +1,248 @@
+/**
+ * @file utf.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Validation and transcoding between UTF-8 and UTF-16, UTF-32 and wchar_t strings.
+ *
+ * These functions convert between the narrow strings used by the str_* functions and the wide
+ * strings used by the wstr_* functions. wchar_t strings are treated as UTF-16 where wchar_t is two
+ * bytes (Windows) and as UTF-32 where it is four bytes. UTF-8 is validated with SIMD, and runs of
+ * ASCII are widened and narrowed with SIMD while transcoding, so mostly-ASCII text converts at
+ * close to memory speed.
+ *
+ * Malformed input is never an error: every invalid UTF-8 byte, unpaired surrogate and out of range
+ * UTF-32 value is replaced with U+FFFD. Use the *_is_valid functions first when malformed input has
+ * to be rejected instead.
+ *
+ * Each conversion comes in two forms. The string form allocates its result. The buffer form writes
+ * to caller-provided storage, which must have room for the number of code units reported by the
+ * matching *_length_from_* function, and returns the number of code units written.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "string_view.hpp"
+#include "detail/transcode.hpp"
+
+#include <cstddef>
+#include <string>
+
+namespace swe
+{
+    /**
+     * @brief Checks whether a string is well-formed UTF-8.
+     *
+     * Overlong forms, surrogates, code points above U+10FFFF and truncated sequences are rejected.
+     */
+    inline bool utf8_is_valid(string_view str) noexcept
+    {
+        return detail::utf8_validate(str.data(), str.size());
+    }
+
+    /**
+     * @brief Checks whether a string is well-formed UTF-16, i.e. every surrogate is correctly paired.
+     */
+    inline bool utf16_is_valid(u16string_view str) noexcept
+    {
+        return detail::units_validate(str.data(), str.size());
+    }
+
+    /**
+     * @brief Checks whether a string is well-formed UTF-32, i.e. holds no surrogates or values above U+10FFFF.
+     */
+    inline bool utf32_is_valid(u32string_view str) noexcept
+    {
+        return detail::units_validate(str.data(), str.size());
+    }
+
+    /**
+     * @brief Number of char16_t code units utf8_to_utf16 produces for a UTF-8 string.
+     */
+    inline size_t utf16_length_from_utf8(string_view str) noexcept
+    {
+        return detail::utf8_units_length<char16_t>(str.data(), str.size());
+    }
+
+    /**
+     * @brief Number of char32_t code units (code points) utf8_to_utf32 produces for a UTF-8 string.
+     */
+    inline size_t utf32_length_from_utf8(string_view str) noexcept
+    {
+        return detail::utf8_units_length<char32_t>(str.data(), str.size());
+    }
+
+    /**
+     * @brief Number of wchar_t code units utf8_to_wide produces for a UTF-8 string.
+     */
+    inline size_t wide_length_from_utf8(string_view str) noexcept
+    {
+        return detail::utf8_units_length<wchar_t>(str.data(), str.size());
+    }
+
+    /**
+     * @brief Number of bytes utf16_to_utf8 produces for a UTF-16 string.
+     */
+    inline size_t utf8_length_from_utf16(u16string_view str) noexcept
+    {
+        return detail::units_utf8_length(str.data(), str.size());
+    }
+
+    /**
+     * @brief Number of bytes utf32_to_utf8 produces for a UTF-32 string.
+     */
+    inline size_t utf8_length_from_utf32(u32string_view str) noexcept
+    {
+        return detail::units_utf8_length(str.data(), str.size());
+    }
+
+    /**
+     * @brief Number of bytes wide_to_utf8 produces for a wide string.
+     */
+    inline size_t utf8_length_from_wide(wstring_view str) noexcept
+    {
+        return detail::units_utf8_length(str.data(), str.size());
+    }
+
+    /**
+     * @brief Transcodes UTF-8 to UTF-16 into caller-provided storage.
+     * @param str UTF-8 string to convert.
+     * @param out Storage for at least utf16_length_from_utf8(str) code units.
+     * @return The number of code units written.
+     */
+    inline size_t utf8_to_utf16(string_view str, char16_t* out) noexcept
+    {
+        return detail::utf8_to_units(str.data(), str.size(), out);
+    }
+
+    /**
+     * @brief Transcodes UTF-8 to UTF-32 into caller-provided storage.
+     * @param str UTF-8 string to convert.
+     * @param out Storage for at least utf32_length_from_utf8(str) code units.
+     * @return The number of code units written.
+     */
+    inline size_t utf8_to_utf32(string_view str, char32_t* out) noexcept
+    {
+        return detail::utf8_to_units(str.data(), str.size(), out);
+    }
+
+    /**
+     * @brief Transcodes UTF-8 to a wide string into caller-provided storage.
+     * @param str UTF-8 string to convert.
+     * @param out Storage for at least wide_length_from_utf8(str) code units.
+     * @return The number of code units written.
+     */
+    inline size_t utf8_to_wide(string_view str, wchar_t* out) noexcept
+    {
+        return detail::utf8_to_units(str.data(), str.size(), out);
+    }
+
+    /**
+     * @brief Transcodes UTF-16 to UTF-8 into caller-provided storage.
+     * @param str UTF-16 string to convert.
+     * @param out Storage for at least utf8_length_from_utf16(str) bytes.
+     * @return The number of bytes written.
+     */
+    inline size_t utf16_to_utf8(u16string_view str, char* out) noexcept
+    {
+        return detail::units_to_utf8(str.data(), str.size(), out);
+    }
+
+    /**
+     * @brief Transcodes UTF-32 to UTF-8 into caller-provided storage.
+     * @param str UTF-32 string to convert.
+     * @param out Storage for at least utf8_length_from_utf32(str) bytes.
+     * @return The number of bytes written.
+     */
+    inline size_t utf32_to_utf8(u32string_view str, char* out) noexcept
+    {
+        return detail::units_to_utf8(str.data(), str.size(), out);
+    }
+
+    /**
+     * @brief Transcodes a wide string to UTF-8 into caller-provided storage.
+     * @param str Wide string to convert.
+     * @param out Storage for at least utf8_length_from_wide(str) bytes.
+     * @return The number of bytes written.
+     */
+    inline size_t wide_to_utf8(wstring_view str, char* out) noexcept
+    {
+        return detail::units_to_utf8(str.data(), str.size(), out);
+    }
+
+    namespace detail
+    {
+        /**
+         * @brief Transcodes UTF-8 into a new string. Every UTF-8 byte yields at most one UTF-16 or UTF-32
+         * code unit, so the result is sized from the input and trimmed instead of measured first.
+         */
+        template <typename CharT>
+        std::basic_string<CharT> utf8_to_units_string(string_view str)
+        {
+            std::basic_string<CharT> result(str.size(), CharT());
+            result.resize(utf8_to_units(str.data(), str.size(), &result[0]));
+            return result;
+        }
+
+        /**
+         * @brief Transcodes UTF-16 or UTF-32 into a new UTF-8 string, measured first so that it is allocated exactly once.
+         */
+        template <typename CharT>
+        std::string units_to_utf8_string(basic_string_view<CharT> str)
+        {
+            std::string result(units_utf8_length(str.data(), str.size()), '\0');
+            units_to_utf8(str.data(), str.size(), &result[0]);
+            return result;
+        }
+    } // namespace detail
+
+    /**
+     * @brief Converts a UTF-8 string to UTF-16.
+     */
+    inline std::u16string utf8_to_utf16(string_view str)
+    {
+        return detail::utf8_to_units_string<char16_t>(str);
+    }
+
+    /**
+     * @brief Converts a UTF-8 string to UTF-32.
+     */
+    inline std::u32string utf8_to_utf32(string_view str)
+    {
+        return detail::utf8_to_units_string<char32_t>(str);
+    }
+
+    /**
+     * @brief Converts a UTF-8 string to a wide string.
+     */
+    inline std::wstring utf8_to_wide(string_view str)
+    {
+        return detail::utf8_to_units_string<wchar_t>(str);
+    }
+
+    /**
+     * @brief Converts a UTF-16 string to UTF-8.
+     */
+    inline std::string utf16_to_utf8(u16string_view str)
+    {
+        return detail::units_to_utf8_string(str);
+    }
+
+    /**
+     * @brief Converts a UTF-32 string to UTF-8.
+     */
+    inline std::string utf32_to_utf8(u32string_view str)
+    {
+        return detail::units_to_utf8_string(str);
+    }
+
+    /**
+     * @brief Converts a wide string to UTF-8.
+     */
+    inline std::string wide_to_utf8(wstring_view str)
+    {
+        return detail::units_to_utf8_string(str);
+    }
+
+} // namespace swe
\ No newline at end of file
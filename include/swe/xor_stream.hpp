@@ -0,0 +1,180 @@
+/**
+ * @file xor_stream.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Streaming repeating-key XOR obfuscation for large buffers and files.
+ *
+ * This header provides swe::xor_stream, which applies the same XOR cipher as str_obfuscate to
+ * arbitrarily large data in any number of chunks. The key is expanded once into a keystream, so every
+ * call XORs 16 to 64 bytes per step with the widest SIMD instruction set supported by the CPU, and the
+ * key phase carries over from one call to the next. xor_file applies the cipher to whole files, memory
+ * mapping them where the platform allows.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include "string_view.hpp"
+#include "detail/config.hpp"
+#include "detail/xor_kernels.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace swe
+{
+    /**
+     * @brief Repeating-key XOR cipher that keeps its key phase across calls.
+     *
+     * Applying a stream to a buffer in one call or in consecutive chunks of any size gives the same result,
+     * and the result matches str_obfuscate with the same key. The cipher is its own inverse, so the same
+     * calls de-obfuscate the data again. A stream with an empty key leaves data unchanged.
+     *
+     * A stream is not safe to use from several threads at once; give each thread its own stream and seek
+     * it to the offset of the data it processes.
+     */
+    class xor_stream
+    {
+      public:
+        /**
+         * @brief Creates a stream with an empty key.
+         */
+        xor_stream() noexcept : _key_size(0), _cycle(0), _phase(0)
+        {
+        }
+
+        /**
+         * @brief Creates a stream for a key.
+         * @param key Key for the XOR cipher. The stream keeps its own copy.
+         */
+        explicit xor_stream(string_view key) : xor_stream(key.data(), key.size())
+        {
+        }
+
+        /**
+         * @brief Creates a stream for a binary key.
+         * @param key Pointer to the key bytes. The stream keeps its own copy.
+         * @param size Number of key bytes.
+         */
+        xor_stream(const void* key, std::size_t size) : _key_size(size), _cycle(0), _phase(0)
+        {
+            if (size == 0)
+                return;
+            _cycle = detail::xor_keystream_cycle(size);
+            detail::xor_expand_keystream(static_cast<const unsigned char*>(key), size, _keystream);
+        }
+
+        /**
+         * @brief Whether the key is empty, in which case the stream leaves data unchanged.
+         */
+        bool empty() const noexcept
+        {
+            return _key_size == 0;
+        }
+
+        /**
+         * @brief Length of the key in bytes.
+         */
+        std::size_t key_size() const noexcept
+        {
+            return _key_size;
+        }
+
+        /**
+         * @brief Sets the key phase to the one used for the byte at the given offset of the whole data.
+         *
+         * Lets a stream start in the middle of a blob, for example to process it in parallel or to resume
+         * an interrupted pass.
+         *
+         * @param offset Offset of the next byte in the whole data.
+         */
+        void seek(std::uint64_t offset) noexcept
+        {
+            _phase = _key_size == 0 ? 0 : static_cast<std::size_t>(offset % _key_size);
+        }
+
+        /**
+         * @brief Restarts the key at its first byte.
+         */
+        void reset() noexcept
+        {
+            _phase = 0;
+        }
+
+        /**
+         * @brief XORs a buffer in place and advances the key phase past it.
+         * @param data Buffer to transform.
+         * @param size Number of bytes in the buffer.
+         */
+        void apply(void* data, std::size_t size) noexcept
+        {
+            apply(data, data, size);
+        }
+
+        /**
+         * @brief XORs a buffer into another one and advances the key phase past it.
+         * @param src Source buffer.
+         * @param dst Destination buffer of at least size bytes. May be equal to src, but must not otherwise overlap it.
+         * @param size Number of bytes to transform.
+         */
+        void apply(const void* src, void* dst, std::size_t size) noexcept
+        {
+            if (_key_size == 0)
+            {
+                if (src != dst && size != 0)
+                    std::memmove(dst, src, size);
+                return;
+            }
+            _phase = detail::xor_dispatch()(static_cast<const unsigned char*>(src), static_cast<unsigned char*>(dst), size, _keystream.data(), _cycle, _phase);
+        }
+
+        /**
+         * @brief XORs a string in place and advances the key phase past it.
+         * @param str String to transform.
+         */
+        void apply(std::string& str) noexcept
+        {
+            if (!str.empty())
+                apply(&str[0], str.size());
+        }
+
+      private:
+        std::vector<unsigned char> _keystream;
+        std::size_t _key_size;
+        std::size_t _cycle;
+        std::size_t _phase;
+    };
+
+    /**
+     * @brief XORs a file in place with a repeating key.
+     *
+     * The file is memory mapped in large windows on Windows and POSIX systems and read and written in
+     * chunks elsewhere, so files larger than the address space can be processed. Applying the same key
+     * again restores the original content.
+     *
+     * @param path Path of the file to transform.
+     * @param key Key for the XOR cipher.
+     * @return true on success; false if the file could not be opened, mapped, read or written.
+     */
+    SWE_DECL bool xor_file(const std::string& path, string_view key);
+
+    /**
+     * @brief XORs a file with a repeating key into another file, which is created or truncated.
+     *
+     * The source is read in chunks, so files of any size can be processed.
+     *
+     * @param source_path Path of the file to read.
+     * @param destination_path Path of the file to write. Must not be the source file.
+     * @param key Key for the XOR cipher.
+     * @return true on success; false if either file could not be opened, read or written.
+     */
+    SWE_DECL bool xor_file(const std::string& source_path, const std::string& destination_path, string_view key);
+} // namespace swe
+
+#if defined(SWE_HEADER_ONLY)
+#include "detail/xor_stream.ipp"
+#endif
\ No newline at end of file
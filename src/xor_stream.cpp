@@ -0,0 +1 @@
+#include "../include/swe/detail/xor_stream.ipp"
\ No newline at end of file
@@ -0,0 +1,83 @@
+#include "../include/swe/ascii.hpp"
+#include "../include/swe/string.hpp"
+#include <cctype>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+
+static_assert(swe::ascii_to_lower('Q') == 'q', "tables are usable in constant expressions");
+static_assert(swe::ascii_to_upper('q') == 'Q', "tables are usable in constant expressions");
+static_assert(swe::ascii_is_space('\t') && !swe::ascii_is_space('x'), "tables are usable in constant expressions");
+
+TEST(AsciiTest, MatchesCctypeInTheCLocale)
+{
+    // The program runs in the "C" locale, where <cctype> is plain ASCII
+    for (int i = 0; i < 256; ++i)
+    {
+        const char c = static_cast<char>(i);
+        EXPECT_EQ(swe::ascii_to_lower(c), static_cast<char>(std::tolower(i))) << i;
+        EXPECT_EQ(swe::ascii_to_upper(c), static_cast<char>(std::toupper(i))) << i;
+        EXPECT_EQ(swe::ascii_is_alpha(c), std::isalpha(i) != 0) << i;
+        EXPECT_EQ(swe::ascii_is_digit(c), std::isdigit(i) != 0) << i;
+        EXPECT_EQ(swe::ascii_is_alnum(c), std::isalnum(i) != 0) << i;
+        EXPECT_EQ(swe::ascii_is_space(c), std::isspace(i) != 0) << i;
+        EXPECT_EQ(swe::ascii_is_upper(c), std::isupper(i) != 0) << i;
+        EXPECT_EQ(swe::ascii_is_lower(c), std::islower(i) != 0) << i;
+        EXPECT_EQ(swe::ascii_is(c, swe::ascii_punct), std::ispunct(i) != 0) << i;
+        EXPECT_EQ(swe::ascii_is(c, swe::ascii_xdigit), std::isxdigit(i) != 0) << i;
+        EXPECT_EQ(swe::ascii_is(c, swe::ascii_cntrl), std::iscntrl(i) != 0) << i;
+    }
+}
+
+TEST(AsciiTest, FoldWordMatchesTable)
+{
+    std::mt19937_64 rng(3);
+    for (int round = 0; round < 10000; ++round)
+    {
+        // Bias towards the bytes around the letter ranges, where the carry tricks could go wrong
+        unsigned char bytes[8];
+        for (unsigned char& b : bytes)
+        {
+            const unsigned int r = static_cast<unsigned int>(rng());
+            b = static_cast<unsigned char>(r % 2 ? r >> 8 : 0x3E + (r >> 8) % 0x40);
+        }
+        std::uint64_t word;
+        std::memcpy(&word, bytes, 8);
+        const std::uint64_t folded = swe::detail::ascii_fold_word(word);
+        unsigned char result[8];
+        std::memcpy(result, &folded, 8);
+        for (int i = 0; i < 8; ++i)
+            EXPECT_EQ(static_cast<char>(result[i]), swe::ascii_to_lower(static_cast<char>(bytes[i]))) << static_cast<int>(bytes[i]);
+    }
+}
+
+TEST(AsciiTest, EqualsIgnoreCase)
+{
+    EXPECT_TRUE(swe::ascii_equals_ignore_case("Content-Length", "content-length"));
+    EXPECT_TRUE(swe::ascii_equals_ignore_case("", ""));
+    EXPECT_FALSE(swe::ascii_equals_ignore_case("Content-Length", "content-lengtx"));
+    EXPECT_FALSE(swe::ascii_equals_ignore_case("abc", "abcd"));
+    // '@' / '`' and '[' / '{' differ by 0x20 like letters do, but are not letters
+    EXPECT_FALSE(swe::ascii_equals_ignore_case("@[@[@[@[@[", "`{`{`{`{`{"));
+    // Non-ASCII bytes are compared exactly
+    EXPECT_FALSE(swe::ascii_equals_ignore_case("\xC3\x84pfel and more", "\xC3\xA4pfel and more"));
+    EXPECT_TRUE(swe::ascii_equals_ignore_case("\xC3\x84PFEL AND MORE", "\xC3\x84pfel and more"));
+}
+
+TEST(AsciiTest, CompareTypeAscii)
+{
+    const swe::string_compare_type ascii = swe::string_compare_type::ordinal_ignore_case_ascii;
+    EXPECT_TRUE(swe::str_equals("Transfer-Encoding", "TRANSFER-ENCODING", ascii));
+    EXPECT_TRUE(swe::str_starts_with("Transfer-Encoding: chunked", "transfer-encoding", ascii));
+    EXPECT_TRUE(swe::str_ends_with("archive.TAR.GZ", ".tar.gz", ascii));
+    EXPECT_FALSE(swe::str_ends_with("archive.tar.gz", ".tar.bz", ascii));
+    EXPECT_TRUE(swe::wstr_equals(L"Hello", L"hELLO", ascii));
+    // Only ASCII letters fold for the wide ASCII policy
+    EXPECT_FALSE(swe::wstr_equals(L"Ä", L"ä", ascii));
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
\ No newline at end of file
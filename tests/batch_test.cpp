@@ -0,0 +1,147 @@
+#include "../include/swe/batch.hpp"
+#include "../include/swe/string.hpp"
+#include <gtest/gtest.h>
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Enough strings to be cut into several chunks
+    std::vector<std::string> make_catalog(size_t count)
+    {
+        std::vector<std::string> catalog;
+        catalog.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+            catalog.push_back("  Item #" + std::to_string(i) + (i % 3 ? " Größe XL  " : " RED\t"));
+        return catalog;
+    }
+} // namespace
+
+TEST(BatchTest, InPlaceTransformsMatchSingleCalls)
+{
+    for (swe::batch_execution execution : {swe::batch_execution::sequential, swe::batch_execution::parallel})
+    {
+        const std::vector<std::string> input = make_catalog(5000);
+
+        std::vector<std::string> lower = input;
+        swe::str_to_lower_batch(lower, execution);
+        std::vector<std::string> upper = input;
+        swe::str_to_upper_batch(upper, execution);
+        std::vector<std::string> title = input;
+        swe::str_to_title_batch(title, execution);
+        std::vector<std::string> trimmed = input;
+        swe::str_trim_batch(trimmed, execution);
+        std::vector<std::string> slug = input;
+        swe::str_to_slug_batch(slug, '-', execution);
+
+        for (size_t i = 0; i < input.size(); ++i)
+        {
+            ASSERT_EQ(lower[i], swe::str_to_lower(input[i])) << i;
+            ASSERT_EQ(upper[i], swe::str_to_upper(input[i])) << i;
+            ASSERT_EQ(title[i], swe::str_to_title(input[i])) << i;
+            ASSERT_EQ(trimmed[i], swe::str_trim(input[i])) << i;
+            ASSERT_EQ(slug[i], swe::str_to_slug(input[i], '-')) << i;
+        }
+    }
+}
+
+TEST(BatchTest, PackedTransformsKeepOrderAndInput)
+{
+    const std::vector<std::string> input = make_catalog(5000);
+    for (swe::batch_execution execution : {swe::batch_execution::sequential, swe::batch_execution::parallel})
+    {
+        const swe::packed_strings lower = swe::str_to_lower_packed(input, execution);
+        const swe::packed_strings trimmed = swe::str_trim_packed(input, execution);
+        const swe::packed_strings slug = swe::str_to_slug_packed(input, execution);
+        ASSERT_EQ(lower.size(), input.size());
+        ASSERT_EQ(trimmed.size(), input.size());
+        ASSERT_EQ(slug.size(), input.size());
+        ASSERT_EQ(lower.offsets().back(), lower.buffer().size());
+        for (size_t i = 0; i < input.size(); ++i)
+        {
+            ASSERT_EQ(std::string(lower[i].data(), lower[i].size()), swe::str_to_lower(input[i])) << i;
+            ASSERT_EQ(std::string(trimmed[i].data(), trimmed[i].size()), swe::str_trim(input[i])) << i;
+            ASSERT_EQ(std::string(slug[i].data(), slug[i].size()), swe::str_to_slug(input[i])) << i;
+        }
+    }
+    EXPECT_EQ(input, make_catalog(5000));
+}
+
+TEST(BatchTest, PackedAcceptsViews)
+{
+    const std::vector<swe::string_view> input = {"Alpha", "", "BETA"};
+    const swe::packed_strings upper = swe::str_to_upper_packed(input);
+    ASSERT_EQ(upper.size(), 3u);
+    EXPECT_EQ(std::string(upper[0].data(), upper[0].size()), "ALPHA");
+    EXPECT_TRUE(upper[1].empty());
+    EXPECT_EQ(std::string(upper[2].data(), upper[2].size()), "BETA");
+    EXPECT_EQ(std::string(upper.buffer().data(), upper.buffer().size()), "ALPHABETA");
+}
+
+TEST(BatchTest, WideAndNonRandomAccessContainers)
+{
+    std::vector<std::wstring> wide = {L"  One ", L"TWO"};
+    swe::str_trim_batch(wide, swe::batch_execution::parallel);
+    swe::str_to_lower_batch(wide, swe::batch_execution::parallel);
+    EXPECT_EQ(wide, (std::vector<std::wstring>{L"one", L"two"}));
+
+    const swe::wpacked_strings title = swe::str_to_title_packed(wide);
+    EXPECT_EQ(std::wstring(title[1].data(), title[1].size()), L"Two");
+
+    // Lists are processed sequentially even when parallel execution is requested
+    std::list<std::string> list = {"x y", "Z"};
+    swe::str_to_upper_batch(list, swe::batch_execution::parallel);
+    EXPECT_EQ(list, (std::list<std::string>{"X Y", "Z"}));
+}
+
+TEST(BatchTest, CustomTransformAndExceptions)
+{
+    std::vector<std::string> input = make_catalog(4000);
+    swe::str_transform_batch(input.begin(), input.end(), [](std::string& s) { s.resize(1); }, swe::batch_execution::parallel);
+    for (const std::string& s : input)
+        ASSERT_EQ(s, " ");
+
+    EXPECT_THROW(swe::str_transform_batch(
+                     input.begin(), input.end(), [](std::string&) { throw std::runtime_error("failed"); }, swe::batch_execution::parallel),
+                 std::runtime_error);
+}
+
+TEST(BatchTest, ParallelForChunksVisitsEveryIndexOnce)
+{
+    // Forces several threads even on a single-core machine
+    const size_t count = 10007;
+    const size_t chunk = swe::detail::parallel_chunk_size<sizeof(std::string)>(count, 8);
+    EXPECT_EQ(chunk % (swe::detail::cache_line_size / sizeof(std::string)), 0u);
+    std::vector<int> visits(count, 0);
+    std::vector<size_t> chunk_begins((count + chunk - 1) / chunk, count);
+    swe::detail::parallel_for_chunks(count, chunk, 8, [&](size_t index, size_t begin, size_t end) {
+        chunk_begins[index] = begin;
+        for (size_t i = begin; i < end; ++i)
+            ++visits[i];
+    });
+    EXPECT_EQ(visits, std::vector<int>(count, 1));
+    for (size_t i = 0; i < chunk_begins.size(); ++i)
+        EXPECT_EQ(chunk_begins[i], i * chunk);
+
+    EXPECT_THROW(swe::detail::parallel_for_chunks(count, 16, 8,
+                                                  [](size_t index, size_t, size_t) {
+                                                      if (index == 3)
+                                                          throw std::runtime_error("failed");
+                                                  }),
+                 std::runtime_error);
+}
+
+TEST(BatchTest, EmptyInput)
+{
+    std::vector<std::string> empty;
+    swe::str_to_lower_batch(empty, swe::batch_execution::parallel);
+    EXPECT_TRUE(swe::str_to_lower_packed(empty, swe::batch_execution::parallel).empty());
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
\ No newline at end of file
@@ -1,5 +1,11 @@
 #include "../include/swe/ci_map.hpp"
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
 
 TEST(CIHashTest, HashesCaseInsensitive)
 {
@@ -17,6 +23,215 @@ TEST(CIWHashTest, WHashesCaseInsensitive)
     EXPECT_EQ(hash_fn(a), hash_fn(b));
 }
 
+TEST(CIWHashTest, LongKeysCrossFoldBlocks)
+{
+    swe::wci_hash hash_fn;
+    std::wstring a;
+    std::wstring b;
+    for (int i = 0; i < 200; ++i)
+    {
+        a.push_back(i % 7 == 0 ? L'\u4E2D' : static_cast<wchar_t>(L'A' + i % 26));
+        b.push_back(i % 7 == 0 ? L'\u4E2D' : static_cast<wchar_t>(L'a' + i % 26));
+    }
+    EXPECT_EQ(hash_fn(a), hash_fn(b));
+    b.back() = L'!';
+    EXPECT_NE(hash_fn(a), hash_fn(b));
+}
+
+TEST(CIHashTest, AsciiAndUnicodePathsAgree)
+{
+    swe::ci_hash hash_fn;
+    // Lengths around the 16-byte blocks and the 256-byte stream buffer
+    for (std::size_t length : {1u, 15u, 16u, 17u, 255u, 256u, 257u, 600u})
+    {
+        std::string ascii;
+        for (std::size_t i = 0; i < length; ++i)
+            ascii.push_back(static_cast<char>('A' + i % 26));
+        // KELVIN SIGN folds to 'k', so replacing every 'K' keeps the key equal but leaves the ASCII path
+        std::string kelvin;
+        for (char c : ascii)
+        {
+            if (c == 'K')
+                kelvin += "\xE2\x84\xAA";
+            else
+                kelvin.push_back(static_cast<char>(c | 0x20));
+        }
+        ASSERT_TRUE(swe::ci_equal()(ascii, kelvin));
+        EXPECT_EQ(hash_fn(ascii), hash_fn(kelvin)) << length;
+    }
+    EXPECT_EQ(hash_fn("\xC3\x84pfel-\xC3\x96l"), hash_fn("\xC3\xA4PFEL-\xC3\xB6L"));
+    EXPECT_NE(hash_fn(""), hash_fn(std::string(1, '\0')));
+}
+
+TEST(CIHashTest, SimilarKeysSpreadAcrossBuckets)
+{
+    // Keys that differ in one character must not pile up in a power-of-two table
+    std::set<std::size_t> hashes;
+    std::set<std::size_t> buckets;
+    for (int i = 0; i < 1000; ++i)
+    {
+        const std::string key = "x-header-" + std::to_string(i);
+        hashes.insert(swe::ci_hash()(key));
+        buckets.insert(swe::ci_ascii_hash()(key) & 1023);
+    }
+    EXPECT_EQ(hashes.size(), 1000u);
+    EXPECT_GT(buckets.size(), 550u);
+}
+
+TEST(CIMapTest, Utf8KeysFoldConsistently)
+{
+    swe::unordered_ci_map<int> map;
+    map["\xC3\x84pfel"] = 1;
+    map["\xC3\xA4PFEL"] += 1;
+    map["\xE2\x84\xAA" "elvin"] = 5;
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_EQ(map.at("\xC3\xA4pfel"), 2);
+    EXPECT_EQ(map.at("KELVIN"), 5);
+}
+
+TEST(CIAsciiMapTest, LooksUpIgnoringAsciiCase)
+{
+    swe::unordered_ci_ascii_map<int> headers;
+    headers["Content-Length"] = 42;
+    headers["CONTENT-LENGTH"] += 1;
+    EXPECT_EQ(headers.size(), 1u);
+    EXPECT_EQ(headers.at("content-length"), 43);
+    EXPECT_EQ(swe::ci_ascii_hash()("Accept"), swe::ci_ascii_hash()("ACCEPT"));
+    EXPECT_FALSE(swe::ci_ascii_equal()("Accept", "Accept-Encoding"));
+}
+
+TEST(CIMapTest, FindsViewsWithoutBuildingKeys)
+{
+    swe::unordered_ci_map<int> headers;
+    headers["Content-Type"] = 1;
+    headers["X-Forwarded-For-Original-Client"] = 2;
+    const char* request = "x-forwarded-for-original-client: 10.0.0.1\r\ncontent-type: text/plain";
+    auto it = swe::find_as(headers, swe::string_view(request, 31));
+    ASSERT_NE(it, headers.end());
+    EXPECT_EQ(it->second, 2);
+    it->second = 3;
+    const swe::unordered_ci_map<int>& const_headers = headers;
+    EXPECT_EQ(swe::find_as(const_headers, "CONTENT-TYPE")->second, 1);
+    EXPECT_EQ(swe::find_as(const_headers, swe::string_view(request + 43, 12))->second, 1);
+    EXPECT_EQ(swe::find_as(const_headers, "x-forwarded-for-original-client")->second, 3);
+    EXPECT_EQ(swe::find_as(headers, "Content"), headers.end());
+    EXPECT_EQ(swe::find_as(headers, ""), headers.end());
+
+    swe::unordered_ci_ascii_map<int> ascii;
+    ascii["Accept"] = 4;
+    EXPECT_EQ(swe::find_as(ascii, "ACCEPT")->second, 4);
+
+    swe::unordered_wci_map<int> wide;
+    wide[L"Content-Type"] = 5;
+    EXPECT_EQ(swe::find_as(wide, L"content-TYPE")->second, 5);
+
+    // The functors hash and compare views, C strings and strings alike
+    EXPECT_EQ(swe::ci_hash()(swe::string_view("HOST")), swe::ci_hash()(std::string("host")));
+    EXPECT_TRUE(swe::ci_equal()("Host", std::string("hOST")));
+    EXPECT_TRUE(swe::wci_equal()(L"Host", swe::wstring_view(L"hOST")));
+}
+
+TEST(CILessTest, IsAStrictWeakOrderingConsistentWithEquality)
+{
+    // Short alphabet with letters that only differ in case, a two-byte letter, the Kelvin sign and a stray byte
+    const char* pieces[] = {"a", "A", "b", "B", "k", "K", "\xE2\x84\xAA", "\xC3\x84", "\xC3\xA4", "-", "\xFF"};
+    std::mt19937 rng(7);
+    std::vector<std::string> keys;
+    for (int i = 0; i < 400; ++i)
+    {
+        std::string key;
+        const int length = static_cast<int>(rng() % 24);
+        for (int j = 0; j < length; ++j)
+            key += pieces[rng() % (sizeof(pieces) / sizeof(pieces[0]))];
+        keys.push_back(key);
+    }
+    swe::ci_less less;
+    swe::ci_equal equal;
+    for (std::size_t i = 0; i < keys.size(); ++i)
+    {
+        EXPECT_FALSE(less(keys[i], keys[i]));
+        for (std::size_t j = 0; j < keys.size(); j += 7)
+        {
+            const bool lt = less(keys[i], keys[j]);
+            const bool gt = less(keys[j], keys[i]);
+            EXPECT_FALSE(lt && gt);
+            EXPECT_EQ(!lt && !gt, equal(keys[i], keys[j])) << keys[i] << " / " << keys[j];
+        }
+    }
+    std::sort(keys.begin(), keys.end(), less);
+    EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end(), less));
+}
+
+TEST(CILessTest, OrdersByFoldedCharacters)
+{
+    swe::ci_less less;
+    EXPECT_TRUE(less("apple", "Banana"));
+    EXPECT_TRUE(less("APPLE", "banana"));
+    EXPECT_TRUE(less("app", "APPLE"));
+    EXPECT_FALSE(less("APPLE", "app"));
+    // Differences past the first eight bytes are found by the word compare
+    EXPECT_TRUE(less("Content-Length", "content-type"));
+    EXPECT_TRUE(less("x-request-id-0001-A", "X-REQUEST-ID-0001-b"));
+    EXPECT_FALSE(less("\xE2\x84\xAA" "elvin", "kELVIN"));
+    EXPECT_FALSE(less("kELVIN", "\xE2\x84\xAA" "elvin"));
+
+    swe::wci_less wless;
+    EXPECT_TRUE(wless(L"apple", L"Banana"));
+    EXPECT_TRUE(wless(L"app", L"APPLE"));
+    EXPECT_FALSE(wless(L"Straße-Long-Name", L"STRAßE-long-name"));
+}
+
+TEST(CIMapTest, OrderedMapsIgnoreCase)
+{
+    swe::ci_map<int> settings;
+    settings["Volume"] = 1;
+    settings["volume"] += 1;
+    settings["Brightness"] = 5;
+    settings["audio.Device"] = 7;
+    EXPECT_EQ(settings.size(), 3u);
+    EXPECT_EQ(settings.at("VOLUME"), 2);
+    std::vector<std::string> order;
+    for (const auto& entry : settings)
+        order.push_back(entry.first);
+    EXPECT_EQ(order, (std::vector<std::string>{"audio.Device", "Brightness", "Volume"}));
+
+    swe::wci_map<int> wide;
+    wide[L"Volume"] = 1;
+    wide[L"VOLUME"] += 1;
+    EXPECT_EQ(wide.size(), 1u);
+    EXPECT_EQ(wide.at(L"volume"), 2);
+}
+
+TEST(CIMapTest, EqualPrefixRange)
+{
+    swe::ci_map<int> headers;
+    const char* names[] = {"Accept", "Content-Encoding", "content-length", "CONTENT-TYPE", "Content", "ContentX", "Date", "content_a"};
+    for (int i = 0; i < 8; ++i)
+        headers[names[i]] = i;
+
+    auto range = swe::equal_prefix_range(headers, "content-");
+    std::vector<std::string> found;
+    for (auto it = range.first; it != range.second; ++it)
+        found.push_back(it->first);
+    EXPECT_EQ(found, (std::vector<std::string>{"Content-Encoding", "content-length", "CONTENT-TYPE"}));
+
+    const swe::ci_map<int>& const_headers = headers;
+    auto content = swe::equal_prefix_range(const_headers, swe::string_view("CONTENTS", 7));
+    EXPECT_EQ(std::distance(content.first, content.second), 6);
+    auto none = swe::equal_prefix_range(headers, "Cookie");
+    EXPECT_EQ(none.first, none.second);
+    auto all = swe::equal_prefix_range(headers, "");
+    EXPECT_EQ(all.first, headers.begin());
+    EXPECT_EQ(all.second, headers.end());
+
+    swe::wci_map<int> wide;
+    wide[L"Content-Type"] = 1;
+    wide[L"CONTENT-LENGTH"] = 2;
+    wide[L"Date"] = 3;
+    auto wide_range = swe::equal_prefix_range(wide, L"content-");
+    EXPECT_EQ(std::distance(wide_range.first, wide_range.second), 2);
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,22 @@
+// Built as C++17 and linked against the swe library, which is built as C++11. The view based functions
+// must resolve to the symbols the library exports, and std::string_view must convert to swe's view.
+#include "../include/swe/string.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+
+TEST(Cxx17ConsumerTest, CallsCompiledViewFunctions)
+{
+    EXPECT_EQ(swe::str_trim(std::string("  hi ")), "hi");
+    EXPECT_EQ(swe::str_replace(std::string("a-b-c"), "-", "+"), "a+b+c");
+    EXPECT_EQ(swe::wstr_trim(std::wstring(L" wide\t")), L"wide");
+    EXPECT_TRUE(swe::str_equals("Hello", "HELLO", swe::string_compare_type::ordinal_ignore_case));
+}
+
+TEST(Cxx17ConsumerTest, ConvertsStdStringView)
+{
+    const std::string_view text = "  padded  ";
+    const std::string_view trimmed = swe::str_trim_view(text);
+    EXPECT_EQ(trimmed, "padded");
+    EXPECT_EQ(swe::str_replace(std::string("x.y"), std::string_view("."), std::string_view("::")), "x::y");
+}
@@ -0,0 +1,172 @@
+#include "../include/swe/flat_ci_map.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+TEST(FlatGroupTest, MatchesAgreeWithPortable)
+{
+    const swe::detail::flat_ctrl values[] = {swe::detail::flat_empty, swe::detail::flat_deleted, 0, 1, 5, 0x7F};
+    std::mt19937 rng(3);
+    for (int round = 0; round < 2000; ++round)
+    {
+        swe::detail::flat_ctrl group[swe::detail::flat_group_width];
+        for (std::size_t i = 0; i < swe::detail::flat_group_width; ++i)
+            group[i] = values[rng() % (sizeof(values) / sizeof(values[0]))];
+        const swe::detail::flat_ctrl h2 = static_cast<swe::detail::flat_ctrl>(rng() % 0x80);
+        EXPECT_EQ(swe::detail::flat_match(group, h2), swe::detail::flat_match_portable(group, h2));
+        EXPECT_EQ(swe::detail::flat_match(group, 5), swe::detail::flat_match_portable(group, 5));
+        EXPECT_EQ(swe::detail::flat_match_empty(group), swe::detail::flat_match_empty_portable(group));
+        EXPECT_EQ(swe::detail::flat_match_free(group), swe::detail::flat_match_free_portable(group));
+    }
+}
+
+TEST(FlatCIMapTest, LooksUpIgnoringCase)
+{
+    swe::flat_ci_map<int> map;
+    map["Content-Type"] = 1;
+    map["CONTENT-TYPE"] += 1;
+    map["\xC3\x84pfel"] = 3;
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_EQ(map.at("content-type"), 2);
+    EXPECT_EQ(map.at("\xC3\xA4PFEL"), 3);
+    EXPECT_THROW(map.at("Accept"), std::out_of_range);
+    EXPECT_TRUE(map.insert({"content-TYPE", 9}).second == false);
+    EXPECT_TRUE(map.emplace("Accept", 4).second);
+    EXPECT_EQ(map.count("ACCEPT"), 1u);
+    EXPECT_EQ(map.erase("accept"), 1u);
+    EXPECT_EQ(map.erase("accept"), 0u);
+    EXPECT_EQ(map.find("Accept"), map.end());
+
+    // Views and slices of a larger buffer are looked up without building a key
+    const char* line = "content-type: text/plain";
+    EXPECT_EQ(map.find(swe::string_view(line, 12))->second, 2);
+    EXPECT_EQ(swe::find_as(map, swe::string_view(line, 12))->second, 2);
+    EXPECT_TRUE(map.contains(swe::string_view(line, 12)));
+    EXPECT_FALSE(map.contains(swe::string_view(line, 11)));
+
+    swe::flat_wci_map<int> wide = {{L"Host", 1}, {L"Date", 2}};
+    EXPECT_EQ(wide.at(L"HOST"), 1);
+    EXPECT_EQ(wide.find(swe::wstring_view(L"date"))->second, 2);
+
+    swe::flat_ci_ascii_map<int> ascii;
+    ascii["Accept"] = 5;
+    EXPECT_EQ(ascii.at("ACCEPT"), 5);
+}
+
+TEST(FlatCIMapTest, MatchesUnorderedMapUnderRandomOperations)
+{
+    std::mt19937 rng(11);
+    swe::flat_ci_map<int> flat;
+    swe::unordered_ci_map<int> reference;
+    for (int i = 0; i < 50000; ++i)
+    {
+        // Few distinct keys in mixed case, so inserts, hits, erases and tombstones all happen often
+        std::string key = "key-" + std::to_string(rng() % 3000);
+        for (char& c : key)
+        {
+            if (rng() % 2)
+                c = swe::ascii_to_upper(c);
+        }
+        switch (rng() % 4)
+        {
+        case 0:
+        case 1:
+        {
+            const int value = static_cast<int>(rng());
+            const bool inserted = flat.try_emplace(key, value).second;
+            EXPECT_EQ(inserted, reference.emplace(key, value).second);
+            break;
+        }
+        case 2:
+            EXPECT_EQ(flat.erase(key), reference.erase(key));
+            break;
+        default:
+        {
+            auto it = flat.find(key);
+            auto expected = reference.find(key);
+            ASSERT_EQ(it == flat.end(), expected == reference.end());
+            if (it != flat.end())
+            {
+                EXPECT_EQ(it->second, expected->second);
+            }
+        }
+        }
+        ASSERT_EQ(flat.size(), reference.size());
+    }
+    std::size_t visited = 0;
+    for (const auto& entry : flat)
+    {
+        ASSERT_EQ(reference.at(entry.first), entry.second);
+        ++visited;
+    }
+    EXPECT_EQ(visited, reference.size());
+    EXPECT_LE(flat.load_factor(), flat.max_load_factor());
+}
+
+TEST(FlatCIMapTest, GrowsWithMoveOnlyValuesAndKeepsElements)
+{
+    swe::flat_ci_map<std::unique_ptr<int>> map;
+    for (int i = 0; i < 1000; ++i)
+        map.try_emplace("A-Rather-Long-Key-Beyond-The-Small-String-Buffer-" + std::to_string(i), new int(i));
+    EXPECT_EQ(map.size(), 1000u);
+    EXPECT_GE(map.bucket_count() / 8 * 7, map.size());
+    for (int i = 0; i < 1000; ++i)
+        ASSERT_EQ(*map.at("a-rather-long-key-beyond-the-small-string-buffer-" + std::to_string(i)), i);
+
+    // Erasing through iterators visits every element once
+    std::size_t erased = 0;
+    for (auto it = map.begin(); it != map.end();)
+    {
+        it = map.erase(it);
+        ++erased;
+    }
+    EXPECT_EQ(erased, 1000u);
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST(FlatCIMapTest, CopiesMovesAndRehashes)
+{
+    swe::flat_ci_map<std::string> map;
+    map.reserve(100);
+    const std::size_t buckets = map.bucket_count();
+    for (int i = 0; i < 100; ++i)
+        map.emplace("Key" + std::to_string(i), std::string(i, 'x'));
+    EXPECT_EQ(map.bucket_count(), buckets);
+
+    swe::flat_ci_map<std::string> copy(map);
+    EXPECT_TRUE(copy == map);
+    copy["KEY5"] = "changed";
+    EXPECT_TRUE(copy != map);
+
+    swe::flat_ci_map<std::string> moved(std::move(copy));
+    EXPECT_EQ(moved.at("key5"), "changed");
+    EXPECT_EQ(moved.size(), 100u);
+
+    for (int i = 0; i < 90; ++i)
+        moved.erase("key" + std::to_string(i));
+    moved.rehash(0);
+    EXPECT_EQ(moved.size(), 10u);
+    EXPECT_EQ(moved.bucket_count(), 16u);
+    EXPECT_EQ(moved.at("KEY95"), std::string(95, 'x'));
+
+    moved.insert_or_assign("key95", "y");
+    EXPECT_EQ(moved.at("Key95"), "y");
+    moved.clear();
+    EXPECT_TRUE(moved.empty());
+    EXPECT_EQ(moved.find("key95"), moved.end());
+
+    swe::flat_ci_map<std::string> empty;
+    EXPECT_EQ(empty.begin(), empty.end());
+    EXPECT_EQ(empty.find("x"), empty.end());
+    empty.rehash(0);
+    EXPECT_EQ(empty.bucket_count(), 0u);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
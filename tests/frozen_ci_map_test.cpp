@@ -0,0 +1,121 @@
+#include "../include/swe/frozen_ci_map.hpp"
+#include "frozen_http_headers.hpp"
+#include <gtest/gtest.h>
+#include <cstring>
+#include <random>
+#include <string>
+
+namespace
+{
+    const char* const header_names[] = {"Accept", "Accept-Charset", "Accept-Encoding", "Accept-Language", "Accept-Ranges", "Age", "Allow",
+                                        "Authorization", "Cache-Control", "Connection", "Content-Disposition", "Content-Encoding",
+                                        "Content-Language", "Content-Length", "Content-Location", "Content-Range", "Content-Security-Policy",
+                                        "Content-Type", "Cookie", "Date", "ETag", "Expect", "Expires", "Forwarded", "From", "Host", "If-Match",
+                                        "If-Modified-Since", "If-None-Match", "If-Range", "If-Unmodified-Since", "Last-Modified", "Link",
+                                        "Location", "Max-Forwards", "Origin", "Pragma", "Proxy-Authenticate", "Proxy-Authorization", "Range",
+                                        "Referer", "Retry-After", "Server", "Set-Cookie", "Strict-Transport-Security", "TE", "Trailer",
+                                        "Transfer-Encoding", "Upgrade", "User-Agent", "Vary", "Via", "WWW-Authenticate", "X-Forwarded-For"};
+} // namespace
+
+TEST(FrozenCIMapTest, HashFormsAgree)
+{
+    std::mt19937 rng(5);
+    for (int round = 0; round < 2000; ++round)
+    {
+        std::string key;
+        const std::size_t length = rng() % 40;
+        for (std::size_t i = 0; i < length; ++i)
+            key.push_back(static_cast<char>(rng() % 0x80));
+        std::uint64_t ascii = 0;
+        std::uint64_t utf8 = 0;
+        ASSERT_TRUE(swe::detail::frozen_hash_ascii(key.data(), key.size(), ascii));
+        ASSERT_TRUE(swe::detail::frozen_hash_utf8(key.data(), key.size(), utf8));
+        const std::uint64_t expected = swe::detail::frozen_hash(key.data(), key.size());
+        EXPECT_EQ(ascii, expected);
+        EXPECT_EQ(utf8, expected);
+    }
+    std::uint64_t hash = 0;
+    EXPECT_FALSE(swe::detail::frozen_hash_ascii("\xC3\xA4", 2, hash));
+    EXPECT_FALSE(swe::detail::frozen_hash_utf8("\xC3\xA4", 2, hash));
+}
+
+TEST(FrozenCIMapTest, FindsKeysIgnoringCase)
+{
+    static const swe::frozen_ci_entry<int> entries[] = {{"GET", 1}, {"POST", 2}, {"PUT", 3}, {"DELETE", 4}, {"k", 5}, {"", 6}};
+    const swe::frozen_ci_map<int, 6> methods = swe::make_frozen_ci_map(entries);
+    EXPECT_EQ(methods.size(), 6u);
+    EXPECT_EQ(*methods.find("get"), 1);
+    EXPECT_EQ(methods.at("Post"), 2);
+    EXPECT_EQ(methods.at(std::string("delete")), 4);
+    EXPECT_EQ(methods.at(""), 6);
+    EXPECT_EQ(methods.find("PATCH"), nullptr);
+    EXPECT_EQ(methods.find("GE"), nullptr);
+    EXPECT_EQ(methods.find("GETS"), nullptr);
+    EXPECT_THROW(methods.at("HEAD"), std::out_of_range);
+    // Text beyond ASCII only matches through characters that fold to ASCII
+    EXPECT_EQ(methods.at("\xE2\x84\xAA"), 5);
+    EXPECT_FALSE(methods.contains("\xC3\xA4"));
+    EXPECT_FALSE(methods.contains("G\xC3\xA4T"));
+    EXPECT_FALSE(methods.contains("\xFF"));
+    EXPECT_EQ(methods.count("put"), 1u);
+}
+
+TEST(FrozenCIMapTest, RejectsInvalidKeySets)
+{
+    static const swe::frozen_ci_entry<int> duplicates[] = {{"Accept", 1}, {"ACCEPT", 2}};
+    EXPECT_THROW(swe::make_frozen_ci_map(duplicates), std::invalid_argument);
+    static const swe::frozen_ci_entry<int> wide[] = {{"\xC3\x84pfel", 1}};
+    EXPECT_THROW(swe::make_frozen_ci_map(wide), std::invalid_argument);
+}
+
+TEST(FrozenCIMapTest, GeneratedTablesMatchBuiltTables)
+{
+    swe::frozen_ci_entry<int> entries[] = {
+#define HEADER(i) swe::frozen_ci_entry<int>(header_names[i], std::strlen(header_names[i]), i)
+        HEADER(0),  HEADER(1),  HEADER(2),  HEADER(3),  HEADER(4),  HEADER(5),  HEADER(6),  HEADER(7),  HEADER(8),
+        HEADER(9),  HEADER(10), HEADER(11), HEADER(12), HEADER(13), HEADER(14), HEADER(15), HEADER(16), HEADER(17),
+        HEADER(18), HEADER(19), HEADER(20), HEADER(21), HEADER(22), HEADER(23), HEADER(24), HEADER(25), HEADER(26),
+        HEADER(27), HEADER(28), HEADER(29), HEADER(30), HEADER(31), HEADER(32), HEADER(33), HEADER(34), HEADER(35),
+        HEADER(36), HEADER(37), HEADER(38), HEADER(39), HEADER(40), HEADER(41), HEADER(42), HEADER(43), HEADER(44),
+        HEADER(45), HEADER(46), HEADER(47), HEADER(48), HEADER(49), HEADER(50), HEADER(51), HEADER(52), HEADER(53),
+#undef HEADER
+    };
+    const swe::frozen_ci_map<int, 54> built = swe::make_frozen_ci_map(entries);
+    for (std::size_t i = 0; i < built.table_size; ++i)
+    {
+        EXPECT_EQ(built._displacement[i], frozen_http_headers._displacement[i]) << i;
+        EXPECT_EQ(built._slots[i].size, frozen_http_headers._slots[i].size) << i;
+        EXPECT_EQ(built._slots[i].value, frozen_http_headers._slots[i].value) << i;
+    }
+    for (int i = 0; i < 54; ++i)
+    {
+        std::string lower = header_names[i];
+        for (char& c : lower)
+            c = swe::ascii_to_lower(c);
+        EXPECT_EQ(frozen_http_headers.at(lower), i) << lower;
+        EXPECT_EQ(built.at(header_names[i]), i);
+        lower += "-";
+        EXPECT_FALSE(frozen_http_headers.contains(lower));
+    }
+}
+
+#if SWE_CPLUSPLUS >= 201402L
+TEST(FrozenCIMapTest, BuildsAtCompileTime)
+{
+    static constexpr swe::frozen_ci_entry<int> entries[] = {{"Connection", 1}, {"Keep-Alive", 2}, {"Upgrade", 3}};
+    static constexpr auto hop_by_hop = swe::make_frozen_ci_map(entries);
+    static_assert(hop_by_hop.size() == 3, "three keys");
+    static_assert(hop_by_hop._slots[swe::detail::frozen_slot(swe::detail::frozen_hash("upgrade", 7),
+                                                             hop_by_hop._displacement[swe::detail::frozen_hash("upgrade", 7) & (hop_by_hop.table_size - 1)],
+                                                             hop_by_hop.table_size - 1)]
+                          .value == 3,
+                  "placed at compile time");
+    EXPECT_EQ(hop_by_hop.at("KEEP-ALIVE"), 2);
+}
+#endif
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,79 @@
+/**
+ * @file frozen_http_headers.hpp
+ * @brief Generated swe::frozen_ci_map with 54 keys.
+ *
+ * Do not edit: generated by tools/generate_frozen_ci_map.py from frozen_http_headers.txt.
+ */
+#pragma once
+
+#include "../include/swe/frozen_ci_map.hpp"
+
+constexpr swe::frozen_ci_map<int, 54> frozen_http_headers = {
+    {
+        {"Set-Cookie", 10, 43},
+        {"Accept-Ranges", 13, 4},
+        {"Content-Length", 14, 13},
+        {"Allow", 5, 6},
+        {"Cache-Control", 13, 8},
+        {"Content-Encoding", 16, 11},
+        {"Content-Location", 16, 14},
+        {"Retry-After", 11, 41},
+        {"Cookie", 6, 18},
+        {"Date", 4, 19},
+        {"X-Forwarded-For", 15, 53},
+        {"ETag", 4, 20},
+        {"If-None-Match", 13, 28},
+        {"Expires", 7, 22},
+        {"Forwarded", 9, 23},
+        {"Host", 4, 25},
+        {"Max-Forwards", 12, 34},
+        {"If-Match", 8, 26},
+        {"Accept-Encoding", 15, 2},
+        {"Expect", 6, 21},
+        {"If-Unmodified-Since", 19, 30},
+        {"Accept", 6, 0},
+        {"Origin", 6, 35},
+        {"Range", 5, 39},
+        {"TE", 2, 45},
+        {"Pragma", 6, 36},
+        {"Content-Language", 16, 12},
+        {"Proxy-Authenticate", 18, 37},
+        {"Connection", 10, 9},
+        {"Referer", 7, 40},
+        {"Server", 6, 42},
+        {"Trailer", 7, 46},
+        {"If-Modified-Since", 17, 27},
+        {"Proxy-Authorization", 19, 38},
+        {"Upgrade", 7, 48},
+        {"User-Agent", 10, 49},
+        {"Via", 3, 51},
+        {"Transfer-Encoding", 17, 47},
+        {"WWW-Authenticate", 16, 52},
+        {"Content-Range", 13, 15},
+        {"Authorization", 13, 7},
+        {nullptr, swe::detail::frozen_no_key, {}},
+        {"Accept-Language", 15, 3},
+        {nullptr, swe::detail::frozen_no_key, {}},
+        {"Content-Security-Policy", 23, 16},
+        {"Vary", 4, 50},
+        {"Last-Modified", 13, 31},
+        {"Age", 3, 5},
+        {nullptr, swe::detail::frozen_no_key, {}},
+        {"If-Range", 8, 29},
+        {"Accept-Charset", 14, 1},
+        {"Location", 8, 33},
+        {nullptr, swe::detail::frozen_no_key, {}},
+        {"Content-Type", 12, 17},
+        {nullptr, swe::detail::frozen_no_key, {}},
+        {"Link", 4, 32},
+        {nullptr, swe::detail::frozen_no_key, {}},
+        {nullptr, swe::detail::frozen_no_key, {}},
+        {nullptr, swe::detail::frozen_no_key, {}},
+        {"From", 4, 24},
+        {nullptr, swe::detail::frozen_no_key, {}},
+        {"Strict-Transport-Security", 25, 44},
+        {nullptr, swe::detail::frozen_no_key, {}},
+        {"Content-Disposition", 19, 10},
+    },
+    {0, 0, -5, 0, 0, 0, 1, -30, 0, 0, 0, 0, -6, 0, 0, 0, 0, -14, 0, -17, -39, -7, 0, 0, 0, 0, -10, 0, 0, -26, -37, 2, 0, 1, 1, 0, 0, 0, 0, 0, -23, 0, 0, 0, 0, -15, 0, 0, -32, -35, -9, 0, 4, 0, -36, -31, 0, 0, 0, -2, 0, 0, 2, -16},
+};
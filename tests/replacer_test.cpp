@@ -0,0 +1,275 @@
+#include "../include/swe/replacer.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    // Straightforward leftmost-longest replacement used as a reference
+    std::string naive_replace(const std::string& str, const std::vector<std::pair<std::string, std::string>>& pairs)
+    {
+        std::string result;
+        size_t i = 0;
+        while (i < str.size())
+        {
+            const std::pair<std::string, std::string>* best = nullptr;
+            for (const auto& pair : pairs)
+            {
+                if (!pair.first.empty() && str.compare(i, pair.first.size(), pair.first) == 0 && (!best || pair.first.size() > best->first.size()))
+                    best = &pair;
+            }
+            if (best)
+            {
+                result += best->second;
+                i += best->first.size();
+            }
+            else
+            {
+                result += str[i++];
+            }
+        }
+        return result;
+    }
+
+    // Leftmost-longest replacement matching by folded code point, as str_equals does with ordinal_ignore_case
+    std::string naive_replace_folded(const std::string& str, const std::vector<std::pair<std::string, std::string>>& pairs)
+    {
+        std::string result;
+        size_t i = 0;
+        while (i < str.size())
+        {
+            const std::pair<std::string, std::string>* best = nullptr;
+            size_t best_length = 0;
+            for (const auto& pair : pairs)
+            {
+                const size_t length = swe::detail::utf8_match_folded(str.data() + i, str.size() - i, pair.first.data(), pair.first.size());
+                if (length != swe::detail::utf8_no_match && length > best_length)
+                {
+                    best = &pair;
+                    best_length = length;
+                }
+            }
+            if (best)
+            {
+                result += best->second;
+                i += best_length;
+            }
+            else
+            {
+                const size_t length = swe::detail::utf8_decode(str.data() + i, str.size() - i).length;
+                result.append(str, i, length);
+                i += length;
+            }
+        }
+        return result;
+    }
+
+    // Character traits that count comparisons, as a measure of the work a scan does
+    struct counting_traits : std::char_traits<char>
+    {
+        static size_t comparisons;
+
+        static bool eq(char a, char b) noexcept
+        {
+            ++comparisons;
+            return a == b;
+        }
+    };
+
+    size_t counting_traits::comparisons = 0;
+} // namespace
+
+TEST(ReplacerTest, ReplacesAllPatternsInOnePass)
+{
+    swe::replacer r = {{"<", "&lt;"}, {">", "&gt;"}, {"&", "&amp;"}, {"\"", "&quot;"}};
+    EXPECT_EQ(r.size(), 4u);
+    EXPECT_EQ(r.replace("<a href=\"x&y\">"), "&lt;a href=&quot;x&amp;y&quot;&gt;");
+    EXPECT_EQ(r.count("<a href=\"x&y\">"), 5u);
+    EXPECT_EQ(r.replace("plain text"), "plain text");
+    EXPECT_EQ(r.replace(""), "");
+}
+
+TEST(ReplacerTest, LeftmostLongest)
+{
+    swe::replacer r = {{"abcd", "X"}, {"bc", "Y"}, {"ab", "1"}, {"cd", "2"}};
+    EXPECT_EQ(r.replace("abcd"), "X");
+    EXPECT_EQ(r.replace("abce"), "1ce");
+    EXPECT_EQ(r.replace("xbcd"), "xYd");
+    EXPECT_EQ(r.replace("abcabcd"), "1cX");
+}
+
+TEST(ReplacerTest, DoesNotRescanReplacements)
+{
+    swe::replacer r = {{"a", "b"}, {"b", "c"}};
+    EXPECT_EQ(r.replace("ab"), "bc");
+}
+
+TEST(ReplacerTest, DuplicateAndEmptyPatterns)
+{
+    swe::replacer r = {{"", "never"}, {"x", "1"}, {"x", "2"}};
+    EXPECT_EQ(r.size(), 1u);
+    EXPECT_EQ(r.replace("axa"), "a1a");
+}
+
+TEST(ReplacerTest, CaseInsensitive)
+{
+    swe::replacer r({{"password", "********"}, {"secret", "******"}}, swe::string_compare_type::ordinal_ignore_case);
+    EXPECT_EQ(r.replace("PassWord=1 SECRET=2 password"), "********=1 ******=2 ********");
+    swe::replacer sensitive = {{"password", "********"}};
+    EXPECT_EQ(sensitive.replace("Password"), "Password");
+    swe::replacer ascii({{"key", "***"}}, swe::string_compare_type::ordinal_ignore_case_ascii);
+    EXPECT_EQ(ascii.replace("KEY=1 Key=2"), "***=1 ***=2");
+}
+
+TEST(ReplacerTest, CaseInsensitiveUtf8)
+{
+    // Narrow text folds by code point, as in str_equals and str_find
+    swe::replacer accents({{"\xC3\xA9", "e"}, {"stra\xC3\x9F" "e", "street"}}, swe::string_compare_type::ordinal_ignore_case);
+    EXPECT_EQ(accents.replace("caf\xC3\x89 caf\xC3\xA9"), "cafe cafe");
+    EXPECT_EQ(accents.replace("STRA\xE1\xBA\x9E" "E"), "street");
+    EXPECT_TRUE(swe::str_equals("\xC3\x89", "\xC3\xA9", swe::string_compare_type::ordinal_ignore_case));
+
+    // A match can be longer or shorter in bytes than its pattern: U+212A KELVIN SIGN folds to 'k'
+    swe::replacer kelvin({{"k", "x"}, {"\xE2\x84\xAA" "elvin", "K"}}, swe::string_compare_type::ordinal_ignore_case);
+    EXPECT_EQ(kelvin.replace("\xE2\x84\xAA 5 kelvin"), "x 5 K");
+    std::string text = "\xE2\x84\xAA\xE2\x84\xAA!";
+    kelvin.replace_inplace(text);
+    EXPECT_EQ(text, "xx!");
+    swe::replacer grow({{"\xE2\x84\xAA", "kk"}}, swe::string_compare_type::ordinal_ignore_case);
+    EXPECT_EQ(grow.replace("KkK"), "kkkkkk");
+    EXPECT_EQ(grow.count("KkK"), 3u);
+
+    // Invalid bytes only match themselves, never part of a sequence
+    swe::replacer invalid({{"\xA9", "?"}, {"\xFF", "!"}}, swe::string_compare_type::ordinal_ignore_case);
+    EXPECT_EQ(invalid.replace("\xC3\xA9\xA9\xFF"), "\xC3\xA9?!");
+
+    // The ASCII-only policy leaves non-ASCII letters alone
+    swe::replacer ascii({{"\xC3\xA9", "e"}}, swe::string_compare_type::ordinal_ignore_case_ascii);
+    EXPECT_EQ(ascii.replace("caf\xC3\x89"), "caf\xC3\x89");
+}
+
+TEST(ReplacerTest, CaseInsensitiveUtf8MatchesNaiveReference)
+{
+    const char* const symbols[] = {"a", "A", "k", "K", "\xE2\x84\xAA", "s", "\xC5\xBF", "\xC3\xA9", "\xC3\x89", "\xC3", "\xA9", "-"};
+    std::mt19937 rng(54321);
+    auto random_string = [&](size_t max_symbols) {
+        std::string s;
+        for (size_t i = rng() % (max_symbols + 1); i > 0; --i)
+            s += symbols[rng() % (sizeof(symbols) / sizeof(symbols[0]))];
+        return s;
+    };
+
+    for (int round = 0; round < 500; ++round)
+    {
+        std::vector<std::pair<std::string, std::string>> pairs;
+        for (size_t i = 1 + rng() % 5; i > 0; --i)
+        {
+            std::string pattern = random_string(3);
+            bool duplicate = pattern.empty();
+            for (const auto& pair : pairs)
+                duplicate = duplicate || swe::str_equals(pair.first, pattern, swe::string_compare_type::ordinal_ignore_case);
+            if (!duplicate)
+                pairs.emplace_back(pattern, std::to_string(i) + random_string(2));
+        }
+        swe::replacer r(pairs.begin(), pairs.end(), swe::string_compare_type::ordinal_ignore_case);
+        const std::string input = random_string(round < 450 ? 30 : 1500);
+        ASSERT_EQ(r.replace(input), naive_replace_folded(input, pairs)) << "input: " << input;
+        std::string inplace = input;
+        r.replace_inplace(inplace);
+        ASSERT_EQ(inplace, naive_replace_folded(input, pairs));
+    }
+}
+
+TEST(ReplacerTest, ReplaceInPlace)
+{
+    swe::replacer shrink = {{"\r\n", "\n"}, {"\t", " "}};
+    std::string text = "line one\r\nline\ttwo\r\nthe final line of the text\r\n";
+    const char* storage = text.data();
+    shrink.replace_inplace(text);
+    EXPECT_EQ(text, "line one\nline two\nthe final line of the text\n");
+    EXPECT_EQ(text.data(), storage);
+
+    swe::replacer grow = {{"\n", "\r\n"}};
+    grow.replace_inplace(text);
+    EXPECT_EQ(text, "line one\r\nline two\r\nthe final line of the text\r\n");
+}
+
+TEST(ReplacerTest, FromContainer)
+{
+    std::vector<std::pair<std::string, std::string>> pairs = {{"cat", "dog"}, {"dog", "cat"}};
+    swe::replacer r(pairs.begin(), pairs.end());
+    EXPECT_EQ(r.replace("cat chases dog"), "dog chases cat");
+}
+
+TEST(ReplacerTest, MatchesNaiveReference)
+{
+    std::mt19937 rng(12345);
+    auto random_string = [&rng](size_t max_length) {
+        std::string s(rng() % (max_length + 1), 'a');
+        for (char& c : s)
+            c = static_cast<char>('a' + rng() % 3);
+        return s;
+    };
+
+    for (int round = 0; round < 500; ++round)
+    {
+        std::vector<std::pair<std::string, std::string>> pairs;
+        const size_t count = 1 + rng() % 6;
+        for (size_t i = 0; i < count; ++i)
+        {
+            std::string pattern = random_string(4);
+            bool duplicate = pattern.empty();
+            for (const auto& pair : pairs)
+                duplicate = duplicate || pair.first == pattern;
+            if (!duplicate)
+                pairs.emplace_back(pattern, std::to_string(i) + random_string(3));
+        }
+        swe::replacer r(pairs.begin(), pairs.end());
+        const std::string input = random_string(40);
+        ASSERT_EQ(r.replace(input), naive_replace(input, pairs)) << "input: " << input;
+    }
+
+    // Inputs longer than a scan block, with patterns crossing the block ends
+    for (int round = 0; round < 20; ++round)
+    {
+        std::vector<std::pair<std::string, std::string>> pairs = {{random_string(2) + "a", "1"}, {std::string(1 + rng() % 600, 'a'), "2"}, {"b", "3"}};
+        if (pairs[0].first == pairs[1].first)
+            pairs.pop_back();
+        swe::replacer r(pairs.begin(), pairs.end());
+        std::string input = random_string(5000);
+        for (size_t i = 0; i < input.size(); i += 1 + rng() % 1500)
+            input.replace(i, 0, std::string(rng() % 1200, 'a'));
+        ASSERT_EQ(r.replace(input), naive_replace(input, pairs));
+    }
+}
+
+TEST(ReplacerTest, ScanIsLinearInTheInput)
+{
+    // Each "a" is only known to be a match once the long pattern fails 1000 characters later; restarting the
+    // scan after every match would cost O(n * L) comparisons here
+    const std::basic_string<char, counting_traits> long_pattern = std::basic_string<char, counting_traits>(1000, 'a') + "b";
+    const std::basic_string<char, counting_traits> input(100000, 'a');
+    swe::basic_replacer<char, counting_traits> r({{"a", "x"}, {long_pattern, "y"}});
+    counting_traits::comparisons = 0;
+    EXPECT_EQ(r.count(input), input.size());
+    EXPECT_LE(counting_traits::comparisons, 4 * input.size());
+
+    const std::basic_string<char, counting_traits> ab_input = input + "b";
+    counting_traits::comparisons = 0;
+    EXPECT_EQ(r.count(ab_input), 99001u);
+    EXPECT_LE(counting_traits::comparisons, 4 * ab_input.size());
+}
+
+TEST(ReplacerTest, Wide)
+{
+    swe::wreplacer r({{L"Hello", L"Goodbye"}, {L"WORLD", L"SWE"}}, swe::string_compare_type::ordinal_ignore_case);
+    EXPECT_EQ(r.replace(L"hello world!"), L"Goodbye SWE!");
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
\ No newline at end of file
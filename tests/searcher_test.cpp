@@ -0,0 +1,287 @@
+#include "../include/swe/searcher.hpp"
+#include "../include/swe/string.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Kernels the running CPU supports, paired with a name for failure messages
+    std::vector<std::pair<const char*, swe::detail::find_kernel>> supported_find_kernels()
+    {
+        std::vector<std::pair<const char*, swe::detail::find_kernel>> kernels = {{"scalar", &swe::detail::find_scalar}};
+#if SWE_HAS_X86_SIMD
+        const swe::detail::cpu_features& features = swe::detail::get_cpu_features();
+        if (features.sse2)
+            kernels.emplace_back("sse2", &swe::detail::find_sse2);
+        if (features.avx2)
+            kernels.emplace_back("avx2", &swe::detail::find_avx2);
+        if (features.avx512bw)
+            kernels.emplace_back("avx512bw", &swe::detail::find_avx512bw);
+#endif
+        return kernels;
+    }
+
+    std::vector<std::pair<const char*, swe::detail::find_kernel>> supported_find_ascii_ci_kernels()
+    {
+        std::vector<std::pair<const char*, swe::detail::find_kernel>> kernels = {{"scalar", &swe::detail::find_ascii_ci_scalar}};
+#if SWE_HAS_X86_SIMD
+        const swe::detail::cpu_features& features = swe::detail::get_cpu_features();
+        if (features.sse2)
+            kernels.emplace_back("sse2", &swe::detail::find_ascii_ci_sse2);
+        if (features.avx2)
+            kernels.emplace_back("avx2", &swe::detail::find_ascii_ci_avx2);
+        if (features.avx512bw)
+            kernels.emplace_back("avx512bw", &swe::detail::find_ascii_ci_avx512bw);
+#endif
+        return kernels;
+    }
+
+    std::vector<std::pair<const char*, swe::detail::find_candidate_kernel>> supported_find_candidate_kernels()
+    {
+        std::vector<std::pair<const char*, swe::detail::find_candidate_kernel>> kernels = {{"scalar", &swe::detail::find_candidate_scalar}};
+#if SWE_HAS_X86_SIMD
+        const swe::detail::cpu_features& features = swe::detail::get_cpu_features();
+        if (features.sse2)
+            kernels.emplace_back("sse2", &swe::detail::find_candidate_sse2);
+        if (features.avx2)
+            kernels.emplace_back("avx2", &swe::detail::find_candidate_avx2);
+        if (features.avx512bw)
+            kernels.emplace_back("avx512bw", &swe::detail::find_candidate_avx512bw);
+#endif
+        return kernels;
+    }
+
+    std::string ascii_lower(std::string str)
+    {
+        for (char& c : str)
+            c = swe::ascii_to_lower(c);
+        return str;
+    }
+
+    size_t reference_find(const std::string& haystack, const std::string& needle)
+    {
+        const size_t pos = haystack.find(needle);
+        return pos == std::string::npos ? swe::detail::find_npos : pos;
+    }
+} // namespace
+
+TEST(SearcherTest, KernelsMatchStdFind)
+{
+    std::mt19937 rng(1234);
+    // A small alphabet makes partial matches, and therefore verification, frequent
+    std::uniform_int_distribution<int> letter('a', 'c');
+    for (const auto& kernel : supported_find_kernels())
+    {
+        for (size_t length = 0; length < 200; ++length)
+        {
+            std::string haystack(length, ' ');
+            for (char& c : haystack)
+                c = static_cast<char>(letter(rng));
+            for (size_t needle_length = 0; needle_length <= 6; ++needle_length)
+            {
+                std::string needle(needle_length, ' ');
+                for (char& c : needle)
+                    c = static_cast<char>(letter(rng));
+                EXPECT_EQ(kernel.second(haystack.data(), haystack.size(), needle.data(), needle.size()), reference_find(haystack, needle))
+                    << kernel.first << " haystack=" << haystack << " needle=" << needle;
+            }
+        }
+    }
+}
+
+TEST(SearcherTest, KernelsFindMatchAtEveryOffset)
+{
+    const std::string needle = "needle";
+    for (const auto& kernel : supported_find_kernels())
+    {
+        for (size_t offset = 0; offset + needle.size() <= 150; ++offset)
+        {
+            std::string haystack(150, 'x');
+            haystack.replace(offset, needle.size(), needle);
+            EXPECT_EQ(kernel.second(haystack.data(), haystack.size(), needle.data(), needle.size()), offset) << kernel.first;
+        }
+    }
+}
+
+TEST(SearcherTest, FindCountContains)
+{
+    const swe::searcher s("ab");
+    EXPECT_EQ(s.needle(), "ab");
+    EXPECT_EQ(s.find("xxabyyab"), 2u);
+    EXPECT_EQ(s.find("xxabyyab", 3), 6u);
+    EXPECT_EQ(s.find("xxabyyab", 9), swe::searcher::npos);
+    EXPECT_EQ(s.find("xxa"), swe::searcher::npos);
+    EXPECT_TRUE(s.contains("cab"));
+    EXPECT_FALSE(s.contains("ba"));
+    EXPECT_EQ(s.count("ababab"), 3u);
+    EXPECT_EQ(s.find_all("abxab"), (std::vector<size_t>{0, 3}));
+}
+
+TEST(SearcherTest, CountIsNonOverlapping)
+{
+    const swe::searcher s("aa");
+    EXPECT_EQ(s.count("aaaaa"), 2u);
+    EXPECT_EQ(s.find_all("aaaaa"), (std::vector<size_t>{0, 2}));
+}
+
+TEST(SearcherTest, EmptyNeedle)
+{
+    const swe::searcher s("");
+    EXPECT_EQ(s.find("abc"), 0u);
+    EXPECT_EQ(s.find("abc", 3), 3u);
+    EXPECT_EQ(s.count("abc"), 0u);
+    EXPECT_TRUE(s.find_all("abc").empty());
+}
+
+TEST(SearcherTest, OwnsItsNeedle)
+{
+    std::string needle = "temp";
+    const swe::searcher s(needle);
+    needle = "gone";
+    EXPECT_EQ(s.find("a temp value"), 2u);
+}
+
+TEST(SearcherTest, WideHorspool)
+{
+    // U+0001, U+0101 and U+0201 share a skip table slot, which must not cause a match to be skipped
+    const swe::wsearcher s(L"\u0101b\u0201");
+    EXPECT_EQ(s.find(L"\u0001b\u0201\u0101b\u0201"), 3u);
+    EXPECT_EQ(s.count(L"\u0101b\u0201\u0101b\u0201x\u0101b"), 2u);
+    EXPECT_FALSE(s.contains(L"\u0101b\u0101"));
+
+    std::mt19937 rng(99);
+    std::uniform_int_distribution<int> letter(0, 2);
+    const wchar_t alphabet[] = {L'a', L'\u0161', L'\u0261'};
+    for (int round = 0; round < 500; ++round)
+    {
+        std::wstring haystack(rng() % 40, L' '), needle(1 + rng() % 4, L' ');
+        for (wchar_t& c : haystack)
+            c = alphabet[letter(rng)];
+        for (wchar_t& c : needle)
+            c = alphabet[letter(rng)];
+        EXPECT_EQ(swe::wsearcher(needle).find(haystack), haystack.find(needle));
+    }
+}
+
+TEST(SearcherTest, FreeFunctions)
+{
+    EXPECT_EQ(swe::str_find("hello world", "o"), 4u);
+    EXPECT_EQ(swe::str_find("hello world", "o", 5), 7u);
+    EXPECT_EQ(swe::str_find("hello world", "xyz"), swe::string_view::npos);
+    EXPECT_EQ(swe::str_find("hello", "", 2), 2u);
+    EXPECT_EQ(swe::str_find("hello", "o", 6), swe::string_view::npos);
+    EXPECT_TRUE(swe::str_contains("hello world", "lo w"));
+    EXPECT_FALSE(swe::str_contains("hello world", "low"));
+    EXPECT_EQ(swe::str_count("one, two, three", ", "), 2u);
+    EXPECT_EQ(swe::str_count("abc", ""), 0u);
+
+    EXPECT_EQ(swe::wstr_find(L"hello world", L"world"), 6u);
+    EXPECT_TRUE(swe::wstr_contains(L"hello world", L"o w"));
+    EXPECT_EQ(swe::wstr_count(L"aXbXc", L"X"), 2u);
+}
+
+TEST(SearcherTest, AsciiIgnoreCaseKernelsMatchFoldedFind)
+{
+    std::mt19937 rng(4321);
+    // Letters of both cases plus '@' and '`', which sit next to 'A' and 'a' and must not fold
+    const char alphabet[] = "aAbB@`";
+    std::uniform_int_distribution<int> letter(0, 5);
+    for (const auto& kernel : supported_find_ascii_ci_kernels())
+    {
+        for (size_t length = 0; length < 200; ++length)
+        {
+            std::string haystack(length, ' ');
+            for (char& c : haystack)
+                c = alphabet[letter(rng)];
+            for (size_t needle_length = 0; needle_length <= 6; ++needle_length)
+            {
+                std::string needle(needle_length, ' ');
+                for (char& c : needle)
+                    c = alphabet[letter(rng)];
+                EXPECT_EQ(kernel.second(haystack.data(), haystack.size(), needle.data(), needle.size()), reference_find(ascii_lower(haystack), ascii_lower(needle)))
+                    << kernel.first << " haystack=" << haystack << " needle=" << needle;
+            }
+        }
+    }
+}
+
+TEST(SearcherTest, CandidateKernelsMatchScalar)
+{
+    const swe::detail::ci_filter filters[] = {swe::detail::ascii_ci_filter('k'), swe::detail::ascii_ci_filter('1'), swe::detail::utf8_lead_filter,
+                                              swe::detail::no_byte_filter};
+    for (const auto& kernel : supported_find_candidate_kernels())
+    {
+        for (size_t offset = 0; offset < 150; ++offset)
+        {
+            for (const char hit : {'K', 'k', '1', '\xC5', '\xFF'})
+            {
+                std::string haystack(150, 'x');
+                haystack[offset] = hit;
+                for (const auto& first : filters)
+                    for (const auto& second : filters)
+                        EXPECT_EQ(kernel.second(haystack.data(), haystack.size(), first, second),
+                                  swe::detail::find_candidate_scalar(haystack.data(), haystack.size(), first, second))
+                            << kernel.first << " offset=" << offset;
+            }
+        }
+    }
+}
+
+TEST(SearcherTest, FindIgnoreCase)
+{
+    const swe::string_compare_type ignore_case = swe::string_compare_type::ordinal_ignore_case;
+    const swe::string_compare_type ignore_case_ascii = swe::string_compare_type::ordinal_ignore_case_ascii;
+
+    EXPECT_EQ(swe::str_find("[INFO] Connection Timed Out", "timed out", ignore_case), 18u);
+    EXPECT_EQ(swe::str_find("error: x, ERROR: y", "Error", ignore_case, 1), 10u);
+    EXPECT_EQ(swe::str_find("abc", "ABC", swe::string_compare_type::ordinal), swe::string_view::npos);
+    EXPECT_EQ(swe::str_find("abc", "", ignore_case, 3), 3u);
+    EXPECT_TRUE(swe::str_contains("Hello World", "WORLD", ignore_case_ascii));
+    EXPECT_FALSE(swe::str_contains("Hello World", "WORLD"));
+
+    // Non-ASCII needles fold with Unicode simple case folding and may match a different number of bytes
+    EXPECT_EQ(swe::str_find("Gr\xC3\x9C\xC3\x9F aus \xC3\x84rger", "\xC3\xA4RGER", ignore_case), 11u);
+    EXPECT_EQ(swe::str_find("20 \xE2\x84\xAA", "20 k", ignore_case), 0u);
+    EXPECT_EQ(swe::str_find("temp: 20K", "20 \xE2\x84\xAA", ignore_case), swe::string_view::npos);
+    EXPECT_EQ(swe::str_find("temp: 20 K", "20 \xE2\x84\xAA", ignore_case), 6u);
+    EXPECT_EQ(swe::str_find("mi\xC5\xBFt", "ST", ignore_case), 2u);
+    EXPECT_FALSE(swe::str_contains("\xC3\x84rger", "\xC3\xA4rger", ignore_case_ascii));
+
+    // Invalid bytes only match themselves
+    EXPECT_EQ(swe::str_find("a\xC3\x84\x80" "b", "\x80" "B", ignore_case), 3u);
+
+    EXPECT_EQ(swe::wstr_find(L"Hello World", L"WORLD", ignore_case), 6u);
+    EXPECT_TRUE(swe::wstr_contains(L"Hello World", L"o w", ignore_case_ascii));
+    EXPECT_EQ(swe::basic_str_find<char16_t>(u"x\u03A3\u03B1", u"\u03C3\u0391", ignore_case), 1u);
+    EXPECT_EQ(swe::basic_str_find<char32_t>(U"xyz", U"Z", ignore_case_ascii), 2u);
+}
+
+TEST(SearcherTest, FindIgnoreCaseMatchesEqualsAtEveryPosition)
+{
+    std::mt19937 rng(7);
+    // Mixes ASCII, two-byte letters, the Kelvin sign and long s, whose folds are ASCII
+    const std::string alphabet[] = {"a", "A", "k", "K", "s", "S", "\xC3\xA4", "\xC3\x84", "\xE2\x84\xAA", "\xC5\xBF"};
+    std::uniform_int_distribution<int> letter(0, 9);
+    for (int round = 0; round < 2000; ++round)
+    {
+        std::string haystack, needle;
+        for (int i = rng() % 12; i > 0; --i)
+            haystack += alphabet[letter(rng)];
+        for (int i = 1 + rng() % 3; i > 0; --i)
+            needle += alphabet[letter(rng)];
+
+        size_t expected = swe::string_view::npos;
+        for (size_t pos = 0; pos < haystack.size() && expected == swe::string_view::npos; ++pos)
+            if (swe::str_starts_with(swe::string_view(haystack).substr(pos), needle, swe::string_compare_type::ordinal_ignore_case))
+                expected = pos;
+        EXPECT_EQ(swe::str_find(haystack, needle, swe::string_compare_type::ordinal_ignore_case), expected) << haystack << " / " << needle;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
\ No newline at end of file
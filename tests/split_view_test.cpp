@@ -0,0 +1,362 @@
+#include "../include/swe/split_view.hpp"
+#include "../include/swe/string.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    template <typename Range>
+    std::vector<std::string> collect(const Range& range)
+    {
+        std::vector<std::string> result;
+        for (swe::string_view token : range)
+            result.emplace_back(token.data(), token.size());
+        return result;
+    }
+
+    using strings = std::vector<std::string>;
+} // namespace
+
+TEST(SplitViewTest, SplitsLazily)
+{
+    std::string line = "GET /index.html HTTP/1.1";
+    auto range = swe::str_split_view(line, ' ');
+    auto it = range.begin();
+    ASSERT_NE(it, range.end());
+    EXPECT_EQ(*it, "GET");
+    ++it;
+    EXPECT_EQ(*it, "/index.html");
+    // Tokens point into the source string
+    EXPECT_EQ(it->data(), line.data() + 4);
+}
+
+TEST(SplitViewTest, MatchesStrSplitForAllOptions)
+{
+    const char* inputs[] = {"", ",", "a,b", ",a,", "a,,b", " a , b ,", "  ,  ", "no delimiter"};
+    const swe::string_split_options options[] = {swe::string_split_options::none, swe::string_split_options::remove_empty_entries,
+                                                 swe::string_split_options::trim_left, swe::string_split_options::trim_right,
+                                                 swe::string_split_options::trim,
+                                                 swe::string_split_options::trim | swe::string_split_options::remove_empty_entries};
+    for (const char* input : inputs)
+    {
+        for (swe::string_split_options option : options)
+        {
+            EXPECT_EQ(collect(swe::str_split_view(input, ',', option)), swe::str_split(input, ',', option)) << "input: '" << input << "'";
+        }
+    }
+}
+
+TEST(SplitViewTest, RemoveEmptyEntriesIsCheckedBeforeTrim)
+{
+    EXPECT_EQ(collect(swe::str_split_view("a, ,b", ',', swe::string_split_options::trim | swe::string_split_options::remove_empty_entries)),
+              (strings{"a", "", "b"}));
+}
+
+TEST(SplitViewTest, MaxCount)
+{
+    EXPECT_EQ(collect(swe::str_split_view("a,b,c,d", ',', swe::string_split_options::none, 2)), (strings{"a", "b,c,d"}));
+    EXPECT_EQ(collect(swe::str_split_view("a,b", ',', swe::string_split_options::none, 5)), (strings{"a", "b"}));
+    EXPECT_EQ(collect(swe::str_split_view("a,b", ',', swe::string_split_options::none, 1)), (strings{"a,b"}));
+    EXPECT_TRUE(swe::str_split_view("a,b", ',', swe::string_split_options::none, 0).empty());
+    EXPECT_EQ(collect(swe::str_split_view("a,,,b,c", ',', swe::string_split_options::remove_empty_entries, 2)), (strings{"a", "b,c"}));
+    EXPECT_EQ(collect(swe::str_split_view("a,  b , c ", ',', swe::string_split_options::trim, 2)), (strings{"a", "b , c"}));
+}
+
+TEST(SplitViewTest, Reverse)
+{
+    EXPECT_EQ(collect(swe::str_rsplit_view("a,b,c", ',')), (strings{"c", "b", "a"}));
+    EXPECT_EQ(collect(swe::str_rsplit_view(",a,", ',', swe::string_split_options::none)), (strings{"", "a", ""}));
+    EXPECT_EQ(collect(swe::str_rsplit_view("a,,b", ',', swe::string_split_options::remove_empty_entries)), (strings{"b", "a"}));
+}
+
+TEST(SplitViewTest, ReverseMaxCount)
+{
+    EXPECT_EQ(collect(swe::str_rsplit_view("/usr/local/lib/libswe.a", '/', swe::string_split_options::none, 2)), (strings{"libswe.a", "/usr/local/lib"}));
+    EXPECT_EQ(collect(swe::str_rsplit_view("a,b,,,", ',', swe::string_split_options::remove_empty_entries, 2)), (strings{"b", "a"}));
+}
+
+TEST(SplitViewTest, IteratorsAreIndependent)
+{
+    auto range = swe::str_split_view("x,y,z", ',');
+    auto first = range.begin();
+    auto second = first;
+    ++second;
+    EXPECT_EQ(*first, "x");
+    EXPECT_EQ(*second, "y");
+    EXPECT_NE(first, second);
+    EXPECT_EQ(std::distance(range.begin(), range.end()), 3);
+}
+
+TEST(SplitViewTest, Wide)
+{
+    std::vector<std::wstring> result;
+    for (swe::wstring_view token : swe::wstr_split_view(L" key = value ", L'=', swe::string_split_options::trim))
+        result.emplace_back(token.data(), token.size());
+    EXPECT_EQ(result, (std::vector<std::wstring>{L"key", L"value"}));
+    EXPECT_EQ(*swe::wstr_rsplit_view(L"a.b.c", L'.').begin(), L"c");
+}
+
+TEST(SplitIntoTest, MatchesStrSplitForAllOptions)
+{
+    const char* inputs[] = {"", ",", "a,b", ",a,", "a,,b", " a , b ,", "  ,  ", "no delimiter"};
+    const swe::string_split_options options[] = {swe::string_split_options::none, swe::string_split_options::remove_empty_entries,
+                                                 swe::string_split_options::trim,
+                                                 swe::string_split_options::trim | swe::string_split_options::remove_empty_entries};
+    std::vector<swe::string_view> views;
+    std::vector<swe::split_slice> slices;
+    for (const char* input : inputs)
+    {
+        for (swe::string_split_options option : options)
+        {
+            const strings expected = swe::str_split(input, ',', option);
+            const std::string str = input;
+            ASSERT_EQ(swe::str_split_into(str, ',', views, option), expected.size());
+            ASSERT_EQ(swe::str_split_into(str, ',', slices, option), expected.size());
+            for (size_t i = 0; i < expected.size(); ++i)
+            {
+                EXPECT_EQ(views[i], expected[i]) << "input: '" << input << "'";
+                EXPECT_EQ(str.substr(slices[i].offset, slices[i].length), expected[i]) << "input: '" << input << "'";
+            }
+        }
+    }
+}
+
+TEST(SplitIntoTest, FixedCapacity)
+{
+    swe::string_view fields[3];
+    EXPECT_EQ(swe::str_split_into("id;name;price", ';', fields), 3u);
+    EXPECT_EQ(fields[0], "id");
+    EXPECT_EQ(fields[2], "price");
+
+    // More tokens than room: the first ones are written and the total is reported
+    swe::split_slice slices[2];
+    EXPECT_EQ(swe::str_split_into("a;bb;ccc;dddd", ';', slices), 4u);
+    EXPECT_EQ(slices[1].offset, 2u);
+    EXPECT_EQ(slices[1].length, 2u);
+
+    EXPECT_EQ(swe::str_split_into("a;b", ';', static_cast<swe::string_view*>(nullptr), 0), 2u);
+}
+
+TEST(SplitIntoTest, ReusedVectorKeepsItsStorage)
+{
+    std::vector<swe::string_view> tokens;
+    swe::str_split_into("1,2,3,4,5,6,7,8", ',', tokens);
+    const swe::string_view* storage = tokens.data();
+    const size_t capacity = tokens.capacity();
+    EXPECT_EQ(swe::str_split_into("9,10", ',', tokens), 2u);
+    EXPECT_EQ(tokens.size(), 2u);
+    EXPECT_EQ(tokens.data(), storage);
+    EXPECT_EQ(tokens.capacity(), capacity);
+    EXPECT_EQ(tokens[1], "10");
+}
+
+TEST(SplitIntoTest, Wide)
+{
+    swe::wstring_view fields[2];
+    EXPECT_EQ(swe::wstr_split_into(L" key = value ", L'=', fields, swe::string_split_options::trim), 2u);
+    EXPECT_EQ(fields[0], L"key");
+    EXPECT_EQ(fields[1], L"value");
+
+    std::vector<swe::split_slice> slices;
+    EXPECT_EQ(swe::wstr_split_into(L"ab|c", L'|', slices), 2u);
+    EXPECT_EQ(slices[1].offset, 3u);
+    EXPECT_EQ(slices[1].length, 1u);
+}
+
+TEST(ByteSetTest, KernelsMatchScalar)
+{
+    std::vector<std::pair<const char*, swe::detail::byte_set_kernel>> kernels;
+#if SWE_HAS_X86_SIMD
+    const swe::detail::cpu_features& features = swe::detail::get_cpu_features();
+    if (features.ssse3)
+        kernels.emplace_back("ssse3", &swe::detail::byte_set_ssse3);
+    if (features.avx2)
+        kernels.emplace_back("avx2", &swe::detail::byte_set_avx2);
+    if (features.avx512bw)
+        kernels.emplace_back("avx512bw", &swe::detail::byte_set_avx512bw);
+#endif
+    std::mt19937 rng(7);
+    for (int round = 0; round < 200; ++round)
+    {
+        // Sets and data span all 256 byte values, including those with the high bit set
+        std::string members(1 + rng() % 8, ' ');
+        for (char& c : members)
+            c = static_cast<char>(rng());
+        const swe::detail::byte_set set = swe::detail::make_byte_set(members.data(), members.size());
+        std::string data(rng() % 150, ' ');
+        for (char& c : data)
+            c = rng() % 4 == 0 ? members[rng() % members.size()] : static_cast<char>(rng());
+        for (bool member : {true, false})
+        {
+            const size_t expected = swe::detail::byte_set_scalar(data.data(), data.size(), set, member);
+            for (const auto& kernel : kernels)
+                EXPECT_EQ(kernel.second(data.data(), data.size(), set, member), expected) << kernel.first;
+        }
+    }
+}
+
+TEST(ByteSetTest, ReverseKernelsMatchScalar)
+{
+    std::vector<std::pair<const char*, swe::detail::byte_set_reverse_kernel>> kernels;
+#if SWE_HAS_X86_SIMD
+    const swe::detail::cpu_features& features = swe::detail::get_cpu_features();
+    if (features.ssse3)
+        kernels.emplace_back("ssse3", &swe::detail::byte_set_reverse_ssse3);
+    if (features.avx2)
+        kernels.emplace_back("avx2", &swe::detail::byte_set_reverse_avx2);
+    if (features.avx512bw)
+        kernels.emplace_back("avx512bw", &swe::detail::byte_set_reverse_avx512bw);
+#endif
+    std::mt19937 rng(11);
+    for (int round = 0; round < 200; ++round)
+    {
+        std::string members(1 + rng() % 8, ' ');
+        for (char& c : members)
+            c = static_cast<char>(rng());
+        const swe::detail::byte_set set = swe::detail::make_byte_set(members.data(), members.size());
+        std::string data(rng() % 150, ' ');
+        for (char& c : data)
+            c = rng() % 4 == 0 ? members[rng() % members.size()] : static_cast<char>(rng());
+        for (bool member : {true, false})
+        {
+            const size_t expected = swe::detail::byte_set_reverse_scalar(data.data(), data.size(), set, member);
+            for (const auto& kernel : kernels)
+                EXPECT_EQ(kernel.second(data.data(), data.size(), set, member), expected) << kernel.first;
+        }
+    }
+}
+
+TEST(CharSetTest, FindMatchesStdString)
+{
+    std::mt19937 rng(13);
+    const std::string alphabet = "ab \t\n;,\x80\xff";
+    for (int round = 0; round < 200; ++round)
+    {
+        std::string members(1 + rng() % 4, ' ');
+        for (char& c : members)
+            c = alphabet[rng() % alphabet.size()];
+        const swe::char_set set(members);
+        std::string data(rng() % 100, ' ');
+        for (char& c : data)
+            c = alphabet[rng() % alphabet.size()];
+        for (size_t pos : {size_t(0), size_t(1), data.size() / 2, data.size(), std::string::npos})
+        {
+            EXPECT_EQ(set.find_first_of(data, pos), data.find_first_of(members, pos));
+            EXPECT_EQ(set.find_first_not_of(data, pos), data.find_first_not_of(members, pos));
+            EXPECT_EQ(set.find_last_of(data, pos), data.find_last_of(members, pos));
+            EXPECT_EQ(set.find_last_not_of(data, pos), data.find_last_not_of(members, pos));
+        }
+    }
+}
+
+TEST(CharSetTest, Trim)
+{
+    const swe::char_set& whitespace = swe::char_set::whitespace();
+    EXPECT_TRUE(whitespace.contains('\v'));
+    EXPECT_FALSE(whitespace.contains('x'));
+    EXPECT_EQ(whitespace.trim("  a b \t\n"), "a b");
+    EXPECT_EQ(whitespace.trim_left("  a b "), "a b ");
+    EXPECT_EQ(whitespace.trim_right("  a b "), "  a b");
+    EXPECT_EQ(whitespace.trim(" \t "), "");
+    EXPECT_EQ(whitespace.trim(""), "");
+
+    // Long runs cross the vector blocks of the kernels at both ends
+    const std::string padded = std::string(100, ' ') + "x" + std::string(70, '\t');
+    EXPECT_EQ(whitespace.trim(padded), "x");
+
+    const swe::char_set quotes("\"'");
+    EXPECT_EQ(swe::str_trim_view("\"'quoted'\"", quotes), "quoted");
+    std::string text = "'value'";
+    swe::str_trim_left_inplace(text, quotes);
+    EXPECT_EQ(text, "value'");
+    swe::str_trim_right_inplace(text, quotes);
+    EXPECT_EQ(text, "value");
+}
+
+TEST(CharSetTest, WideCharactersAboveByteRange)
+{
+    // U+3000 (ideographic space) has no byte-sized form and is matched from the wide list
+    const swe::wchar_set set(L" \u3000");
+    EXPECT_TRUE(set.contains(L'\u3000'));
+    EXPECT_FALSE(set.contains(L'\u3100'));
+    EXPECT_EQ(set.trim(L"\u3000 a\u3100 \u3000"), L"a\u3100");
+    EXPECT_EQ(set.find_first_of(L"ab\u3000"), 2u);
+    EXPECT_EQ(set.find_last_not_of(L"a\u3000 "), 0u);
+    EXPECT_EQ(swe::wstr_trim_view(L"\u3000x\u3000", set), L"x");
+}
+
+TEST(CharSetTest, SplitAnyView)
+{
+    const swe::char_set delimiters(",;");
+    EXPECT_EQ(collect(swe::str_split_any_view("a,b;;c", delimiters)), (strings{"a", "b", "c"}));
+    EXPECT_EQ(collect(swe::str_split_any_view("a,b;;c", delimiters, swe::string_split_options::none)), (strings{"a", "b", "", "c"}));
+}
+
+TEST(SplitAnyViewTest, MatchesSingleDelimiterSplit)
+{
+    const char* inputs[] = {"", ",", "a,b", ";a\t", "a,;b", " a , b ;", "  ;\t  ", "no delimiter"};
+    const swe::string_split_options options[] = {swe::string_split_options::none, swe::string_split_options::remove_empty_entries,
+                                                 swe::string_split_options::trim,
+                                                 swe::string_split_options::trim | swe::string_split_options::remove_empty_entries};
+    for (const char* input : inputs)
+    {
+        // Normalizing every delimiter to ',' must give the same tokens as splitting on the set
+        std::string normalized = input;
+        for (char& c : normalized)
+            c = (c == ';' || c == '\t') ? ',' : c;
+        for (swe::string_split_options option : options)
+        {
+            EXPECT_EQ(swe::str_split_any(input, ",;\t", option), swe::str_split(normalized, ',', option)) << "input: '" << input << "'";
+        }
+    }
+}
+
+TEST(SplitAnyViewTest, LongInputCrossesVectorBlocks)
+{
+    std::string line;
+    strings expected;
+    for (int i = 0; i < 40; ++i)
+    {
+        expected.push_back("field" + std::to_string(i));
+        line += expected.back() + (i % 3 == 0 ? ";" : i % 3 == 1 ? "," : "\t");
+    }
+    EXPECT_EQ(collect(swe::str_split_any_view(line, ",;\t")), expected);
+}
+
+TEST(SplitAnyViewTest, MaxCount)
+{
+    EXPECT_EQ(collect(swe::str_split_any_view("a;b,c;d", ",;", swe::string_split_options::none, 2)), (strings{"a", "b,c;d"}));
+    EXPECT_EQ(collect(swe::str_split_any_view(";;a;,b,c", ",;", swe::string_split_options::remove_empty_entries, 2)), (strings{"a", "b,c"}));
+}
+
+TEST(SplitAnyViewTest, Whitespace)
+{
+    EXPECT_EQ(swe::str_split_whitespace("  the quick\tbrown \r\n fox  "), (strings{"the", "quick", "brown", "fox"}));
+    EXPECT_TRUE(swe::str_split_whitespace(" \t\n ").empty());
+    EXPECT_TRUE(swe::str_split_whitespace("").empty());
+    EXPECT_EQ(swe::str_split_whitespace("word"), (strings{"word"}));
+}
+
+TEST(SplitAnyViewTest, IteratorOutlivesView)
+{
+    std::string text = "x y";
+    auto it = swe::str_split_whitespace_view(text).begin();
+    ++it;
+    EXPECT_EQ(*it, "y");
+}
+
+TEST(SplitAnyViewTest, Wide)
+{
+    EXPECT_EQ(swe::wstr_split_any(L"a,b;c", L",;"), (std::vector<std::wstring>{L"a", L"b", L"c"}));
+    // Delimiters outside the byte range are looked up in the delimiter string
+    EXPECT_EQ(swe::wstr_split_any(L"a\u2014b\u0114c", L"\u2014"), (std::vector<std::wstring>{L"a", L"b\u0114c"}));
+    EXPECT_EQ(swe::wstr_split_whitespace(L" one  two "), (std::vector<std::wstring>{L"one", L"two"}));
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
\ No newline at end of file
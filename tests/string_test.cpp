@@ -1,5 +1,12 @@
 #include "../include/swe/string.hpp"
+#include "../include/swe/detail/ascii_case.hpp"
+#include "../include/swe/detail/char_class_kernels.hpp"
+#include "../include/swe/detail/utf8.hpp"
+#include "../include/swe/detail/wide_kernels.hpp"
+#include <cwctype>
 #include <gtest/gtest.h>
+#include <list>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -13,6 +20,7 @@ struct StringAPI<std::string>
     using CharType = char;
     using StringType = std::string;
     using VectorType = std::vector<std::string>;
+    using ViewType = swe::string_view;
 
     static StringType to_lower(const StringType& s)
     {
@@ -42,19 +50,31 @@ struct StringAPI<std::string>
     {
         return swe::str_trim_right(s);
     }
+    static ViewType trim_view(ViewType s)
+    {
+        return swe::str_trim_view(s);
+    }
+    static ViewType trim_left_view(ViewType s)
+    {
+        return swe::str_trim_left_view(s);
+    }
+    static ViewType trim_right_view(ViewType s)
+    {
+        return swe::str_trim_right_view(s);
+    }
     static StringType replace(const StringType& s, const StringType& old_val, const StringType& new_val)
     {
         return swe::str_replace(s, old_val, new_val);
     }
-    static bool starts_with(const StringType& s, const StringType& prefix)
+    static bool starts_with(ViewType s, ViewType prefix, swe::string_compare_type type = swe::string_compare_type::ordinal)
     {
-        return swe::str_starts_with(s, prefix);
+        return swe::str_starts_with(s, prefix, type);
     }
-    static bool ends_with(const StringType& s, const StringType& suffix)
+    static bool ends_with(ViewType s, ViewType suffix, swe::string_compare_type type = swe::string_compare_type::ordinal)
     {
-        return swe::str_ends_with(s, suffix);
+        return swe::str_ends_with(s, suffix, type);
     }
-    static bool equals(const StringType& s1, const StringType& s2, swe::string_compare_type type)
+    static bool equals(ViewType s1, ViewType s2, swe::string_compare_type type)
     {
         return swe::str_equals(s1, s2, type);
     }
@@ -70,6 +90,50 @@ struct StringAPI<std::string>
     {
         return swe::str_obfuscate(s, key);
     }
+    static StringType to_lower_moved(StringType&& s)
+    {
+        return swe::str_to_lower(std::move(s));
+    }
+    static StringType replace_moved(StringType&& s, ViewType old_val, ViewType new_val)
+    {
+        return swe::str_replace(std::move(s), old_val, new_val);
+    }
+    static void to_lower_inplace(StringType& s)
+    {
+        swe::str_to_lower_inplace(s);
+    }
+    static void to_upper_inplace(StringType& s)
+    {
+        swe::str_to_upper_inplace(s);
+    }
+    static void to_title_inplace(StringType& s)
+    {
+        swe::str_to_title_inplace(s);
+    }
+    static void to_slug_inplace(StringType& s)
+    {
+        swe::str_to_slug_inplace(s);
+    }
+    static void trim_inplace(StringType& s)
+    {
+        swe::str_trim_inplace(s);
+    }
+    static void trim_left_inplace(StringType& s)
+    {
+        swe::str_trim_left_inplace(s);
+    }
+    static void trim_right_inplace(StringType& s)
+    {
+        swe::str_trim_right_inplace(s);
+    }
+    static void replace_inplace(StringType& s, ViewType old_val, ViewType new_val)
+    {
+        swe::str_replace_inplace(s, old_val, new_val);
+    }
+    static void obfuscate_inplace(StringType& s, ViewType key)
+    {
+        swe::str_obfuscate_inplace(s, key);
+    }
 };
 
 template <>
@@ -78,6 +142,7 @@ struct StringAPI<std::wstring>
     using CharType = wchar_t;
     using StringType = std::wstring;
     using VectorType = std::vector<std::wstring>;
+    using ViewType = swe::wstring_view;
 
     static StringType to_lower(const StringType& s)
     {
@@ -107,19 +172,31 @@ struct StringAPI<std::wstring>
     {
         return swe::wstr_trim_right(s);
     }
+    static ViewType trim_view(ViewType s)
+    {
+        return swe::wstr_trim_view(s);
+    }
+    static ViewType trim_left_view(ViewType s)
+    {
+        return swe::wstr_trim_left_view(s);
+    }
+    static ViewType trim_right_view(ViewType s)
+    {
+        return swe::wstr_trim_right_view(s);
+    }
     static StringType replace(const StringType& s, const StringType& old_val, const StringType& new_val)
     {
         return swe::wstr_replace(s, old_val, new_val);
     }
-    static bool starts_with(const StringType& s, const StringType& prefix)
+    static bool starts_with(ViewType s, ViewType prefix, swe::string_compare_type type = swe::string_compare_type::ordinal)
     {
-        return swe::wstr_starts_with(s, prefix);
+        return swe::wstr_starts_with(s, prefix, type);
     }
-    static bool ends_with(const StringType& s, const StringType& suffix)
+    static bool ends_with(ViewType s, ViewType suffix, swe::string_compare_type type = swe::string_compare_type::ordinal)
     {
-        return swe::wstr_ends_with(s, suffix);
+        return swe::wstr_ends_with(s, suffix, type);
     }
-    static bool equals(const StringType& s1, const StringType& s2, swe::string_compare_type type)
+    static bool equals(ViewType s1, ViewType s2, swe::string_compare_type type)
     {
         return swe::wstr_equals(s1, s2, type);
     }
@@ -135,6 +212,183 @@ struct StringAPI<std::wstring>
     {
         return swe::wstr_obfuscate(s, key);
     }
+    static StringType to_lower_moved(StringType&& s)
+    {
+        return swe::wstr_to_lower(std::move(s));
+    }
+    static StringType replace_moved(StringType&& s, ViewType old_val, ViewType new_val)
+    {
+        return swe::wstr_replace(std::move(s), old_val, new_val);
+    }
+    static void to_lower_inplace(StringType& s)
+    {
+        swe::wstr_to_lower_inplace(s);
+    }
+    static void to_upper_inplace(StringType& s)
+    {
+        swe::wstr_to_upper_inplace(s);
+    }
+    static void to_title_inplace(StringType& s)
+    {
+        swe::wstr_to_title_inplace(s);
+    }
+    static void to_slug_inplace(StringType& s)
+    {
+        swe::wstr_to_slug_inplace(s);
+    }
+    static void trim_inplace(StringType& s)
+    {
+        swe::wstr_trim_inplace(s);
+    }
+    static void trim_left_inplace(StringType& s)
+    {
+        swe::wstr_trim_left_inplace(s);
+    }
+    static void trim_right_inplace(StringType& s)
+    {
+        swe::wstr_trim_right_inplace(s);
+    }
+    static void replace_inplace(StringType& s, ViewType old_val, ViewType new_val)
+    {
+        swe::wstr_replace_inplace(s, old_val, new_val);
+    }
+    static void obfuscate_inplace(StringType& s, ViewType key)
+    {
+        swe::wstr_obfuscate_inplace(s, key);
+    }
+};
+
+// UTF-16 and UTF-32 strings go through the basic_str_* templates directly
+template <typename String>
+struct BasicStringAPI
+{
+    using CharType = typename String::value_type;
+    using StringType = String;
+    using VectorType = std::vector<String>;
+    using ViewType = swe::basic_string_view<CharType>;
+
+    static StringType to_lower(const StringType& s)
+    {
+        return swe::basic_str_to_lower(s);
+    }
+    static StringType to_upper(const StringType& s)
+    {
+        return swe::basic_str_to_upper(s);
+    }
+    static StringType to_title(const StringType& s)
+    {
+        return swe::basic_str_to_title(s);
+    }
+    static StringType to_slug(const StringType& s)
+    {
+        return swe::basic_str_to_slug(s);
+    }
+    static StringType trim(const StringType& s)
+    {
+        return swe::basic_str_trim(s);
+    }
+    static StringType trim_left(const StringType& s)
+    {
+        return swe::basic_str_trim_left(s);
+    }
+    static StringType trim_right(const StringType& s)
+    {
+        return swe::basic_str_trim_right(s);
+    }
+    static ViewType trim_view(ViewType s)
+    {
+        return swe::basic_str_trim_view<CharType>(s);
+    }
+    static ViewType trim_left_view(ViewType s)
+    {
+        return swe::basic_str_trim_left_view<CharType>(s);
+    }
+    static ViewType trim_right_view(ViewType s)
+    {
+        return swe::basic_str_trim_right_view<CharType>(s);
+    }
+    static StringType replace(const StringType& s, const StringType& old_val, const StringType& new_val)
+    {
+        return swe::basic_str_replace(s, old_val, new_val);
+    }
+    static bool starts_with(ViewType s, ViewType prefix, swe::string_compare_type type = swe::string_compare_type::ordinal)
+    {
+        return swe::basic_str_starts_with<CharType>(s, prefix, type);
+    }
+    static bool ends_with(ViewType s, ViewType suffix, swe::string_compare_type type = swe::string_compare_type::ordinal)
+    {
+        return swe::basic_str_ends_with<CharType>(s, suffix, type);
+    }
+    static bool equals(ViewType s1, ViewType s2, swe::string_compare_type type)
+    {
+        return swe::basic_str_equals<CharType>(s1, s2, type);
+    }
+    static VectorType split(const StringType& s, CharType delimiter, swe::string_split_options options)
+    {
+        return swe::basic_str_split(s, delimiter, options);
+    }
+    static StringType join(const VectorType& parts, const StringType& delimiter)
+    {
+        return swe::basic_str_join(parts, delimiter);
+    }
+    static StringType obfuscate(const StringType& s, const StringType& key)
+    {
+        return swe::basic_str_obfuscate(s, key);
+    }
+    static StringType to_lower_moved(StringType&& s)
+    {
+        return swe::basic_str_to_lower(std::move(s));
+    }
+    static StringType replace_moved(StringType&& s, ViewType old_val, ViewType new_val)
+    {
+        return swe::basic_str_replace(std::move(s), old_val, new_val);
+    }
+    static void to_lower_inplace(StringType& s)
+    {
+        swe::basic_str_to_lower_inplace(s);
+    }
+    static void to_upper_inplace(StringType& s)
+    {
+        swe::basic_str_to_upper_inplace(s);
+    }
+    static void to_title_inplace(StringType& s)
+    {
+        swe::basic_str_to_title_inplace(s);
+    }
+    static void to_slug_inplace(StringType& s)
+    {
+        swe::basic_str_to_slug_inplace(s);
+    }
+    static void trim_inplace(StringType& s)
+    {
+        swe::basic_str_trim_inplace(s);
+    }
+    static void trim_left_inplace(StringType& s)
+    {
+        swe::basic_str_trim_left_inplace(s);
+    }
+    static void trim_right_inplace(StringType& s)
+    {
+        swe::basic_str_trim_right_inplace(s);
+    }
+    static void replace_inplace(StringType& s, ViewType old_val, ViewType new_val)
+    {
+        swe::basic_str_replace_inplace(s, old_val, new_val);
+    }
+    static void obfuscate_inplace(StringType& s, ViewType key)
+    {
+        swe::basic_str_obfuscate_inplace(s, key);
+    }
+};
+
+template <>
+struct StringAPI<std::u16string> : BasicStringAPI<std::u16string>
+{
+};
+
+template <>
+struct StringAPI<std::u32string> : BasicStringAPI<std::u32string>
+{
 };
 
 // Define the test fixture template
@@ -145,28 +399,17 @@ class StringTest : public ::testing::Test
     using StringType = typename StringAPI<T>::StringType;
     using VectorType = typename StringAPI<T>::VectorType;
     using CharType = typename StringAPI<T>::CharType;
+    using ViewType = typename StringAPI<T>::ViewType;
 
     // Helper to create string literals for wide/narrow strings
     static StringType lit(const char* narrow)
     {
-        if constexpr (std::is_same_v<T, std::wstring>)
-        {
-            // Convert narrow string literal to wide string literal
-            std::wstring ws;
-            while (*narrow)
-            {
-                ws.push_back(static_cast<wchar_t>(*narrow++));
-            }
-            return ws;
-        }
-        else
-        {
-            return std::string(narrow);
-        }
+        // Widens each narrow character for the wide string types, copies as-is for std::string
+        return StringType(narrow, narrow + std::char_traits<char>::length(narrow));
     }
 };
 
-using MyStringTypes = ::testing::Types<std::string, std::wstring>;
+using MyStringTypes = ::testing::Types<std::string, std::wstring, std::u16string, std::u32string>;
 TYPED_TEST_SUITE(StringTest, MyStringTypes);
 
 TYPED_TEST(StringTest, ToLower)
@@ -475,6 +718,722 @@ TYPED_TEST(StringTest, ObfuscateTest)
     EXPECT_EQ(deobfuscated, input);
 }
 
+TYPED_TEST(StringTest, TrimView)
+{
+    auto input = TestFixture::lit("   Hello World!   ");
+    auto result = StringAPI<TypeParam>::trim_view(input);
+    EXPECT_EQ(result, TestFixture::lit("Hello World!"));
+    // The trimmed view refers to the input storage, no copy is made
+    EXPECT_EQ(result.data(), input.data() + 3);
+}
+
+TYPED_TEST(StringTest, TrimLeftView)
+{
+    auto input = TestFixture::lit("   Hello World!   ");
+    auto result = StringAPI<TypeParam>::trim_left_view(input);
+    EXPECT_EQ(result, TestFixture::lit("Hello World!   "));
+}
+
+TYPED_TEST(StringTest, TrimRightView)
+{
+    auto input = TestFixture::lit("   Hello World!   ");
+    auto result = StringAPI<TypeParam>::trim_right_view(input);
+    EXPECT_EQ(result, TestFixture::lit("   Hello World!"));
+}
+
+TYPED_TEST(StringTest, TrimView_AllWhitespace)
+{
+    auto input = TestFixture::lit(" \t\n ");
+    EXPECT_TRUE(StringAPI<TypeParam>::trim_view(input).empty());
+    EXPECT_TRUE(StringAPI<TypeParam>::trim_left_view(input).empty());
+    EXPECT_TRUE(StringAPI<TypeParam>::trim_right_view(input).empty());
+}
+
+TYPED_TEST(StringTest, StartsWith_Slice)
+{
+    auto buffer = TestFixture::lit("GET /index.html HTTP/1.1");
+    typename TestFixture::ViewType slice(buffer.data() + 4, 11);
+    EXPECT_TRUE(StringAPI<TypeParam>::starts_with(slice, TestFixture::lit("/INDEX"), swe::string_compare_type::ordinal_ignore_case));
+    EXPECT_TRUE(StringAPI<TypeParam>::ends_with(slice, TestFixture::lit(".html")));
+    EXPECT_FALSE(StringAPI<TypeParam>::ends_with(slice, TestFixture::lit("HTTP/1.1")));
+}
+
+TYPED_TEST(StringTest, InPlaceTransformsMatchCopies)
+{
+    using API = StringAPI<TypeParam>;
+    const auto input = TestFixture::lit("  hello WORLD, this is SWE!  ");
+
+    auto lower = input;
+    API::to_lower_inplace(lower);
+    EXPECT_EQ(lower, API::to_lower(input));
+
+    auto upper = input;
+    API::to_upper_inplace(upper);
+    EXPECT_EQ(upper, API::to_upper(input));
+
+    auto title = input;
+    API::to_title_inplace(title);
+    EXPECT_EQ(title, API::to_title(input));
+
+    auto slug = input;
+    API::to_slug_inplace(slug);
+    EXPECT_EQ(slug, API::to_slug(input));
+    EXPECT_EQ(slug, TestFixture::lit("hello_world_this_is_swe"));
+
+    auto trimmed = input;
+    API::trim_inplace(trimmed);
+    EXPECT_EQ(trimmed, API::trim(input));
+
+    auto left = input;
+    API::trim_left_inplace(left);
+    EXPECT_EQ(left, API::trim_left(input));
+
+    auto right = input;
+    API::trim_right_inplace(right);
+    EXPECT_EQ(right, API::trim_right(input));
+
+    auto blank = TestFixture::lit(" \t ");
+    API::trim_inplace(blank);
+    EXPECT_TRUE(blank.empty());
+}
+
+TYPED_TEST(StringTest, RvalueOverloadsReuseBuffer)
+{
+    using API = StringAPI<TypeParam>;
+    // Long enough to live on the heap rather than in the small string buffer
+    auto input = TestFixture::lit("The Quick Brown Fox Jumps Over The Lazy Dog, Again And Again");
+    const auto* storage = input.data();
+    auto lower = API::to_lower_moved(std::move(input));
+    EXPECT_EQ(lower, TestFixture::lit("the quick brown fox jumps over the lazy dog, again and again"));
+    EXPECT_EQ(lower.data(), storage);
+
+    auto replaced = API::replace_moved(std::move(lower), TestFixture::lit("again"), TestFixture::lit("AGAIN"));
+    EXPECT_EQ(replaced, TestFixture::lit("the quick brown fox jumps over the lazy dog, AGAIN and AGAIN"));
+    EXPECT_EQ(replaced.data(), storage);
+}
+
+TYPED_TEST(StringTest, ReplaceInPlace)
+{
+    using API = StringAPI<TypeParam>;
+    struct Case
+    {
+        const char* input;
+        const char* from;
+        const char* to;
+        const char* expected;
+    };
+    const Case cases[] = {
+        {"a-b-c", "-", "+", "a+b+c"},          // same length
+        {"a--b--c--", "--", "-", "a-b-c-"},    // shrinking
+        {"a-b-c", "-", "<->", "a<->b<->c"},    // growing
+        {"aaaa", "aa", "b", "bb"},             // non-overlapping, left to right
+        {"aaa", "aa", "xyz", "xyza"},          // growing, left to right
+        {"no match", "xyz", "abc", "no match"}, // no match
+        {"abc", "", "x", "abc"},               // empty pattern
+        {"abcabc", "abc", "", ""},             // remove everything
+    };
+    for (const Case& c : cases)
+    {
+        auto str = TestFixture::lit(c.input);
+        API::replace_inplace(str, TestFixture::lit(c.from), TestFixture::lit(c.to));
+        EXPECT_EQ(str, TestFixture::lit(c.expected)) << c.input << " / " << c.from << " / " << c.to;
+        EXPECT_EQ(API::replace(TestFixture::lit(c.input), TestFixture::lit(c.from), TestFixture::lit(c.to)), TestFixture::lit(c.expected));
+    }
+}
+
+TYPED_TEST(StringTest, ReplaceInPlaceWithViewsIntoTheString)
+{
+    using API = StringAPI<TypeParam>;
+    using ViewType = typename TestFixture::ViewType;
+    // Same length, shrinking and growing replacements whose views point into the string being edited
+    auto str = TestFixture::lit("xxabcXYxxabc");
+    API::replace_inplace(str, TestFixture::lit("abc"), ViewType(str.data() + 5, 1));
+    EXPECT_EQ(str, TestFixture::lit("xxXXYxxX"));
+
+    str = TestFixture::lit("abab");
+    API::replace_inplace(str, ViewType(str.data(), 1), ViewType(str.data() + 1, 1));
+    EXPECT_EQ(str, TestFixture::lit("bbbb"));
+
+    str = TestFixture::lit("a-b-c");
+    API::replace_inplace(str, TestFixture::lit("-"), ViewType(str.data(), 3));
+    EXPECT_EQ(str, TestFixture::lit("aa-bba-bc"));
+}
+
+TYPED_TEST(StringTest, ObfuscateInPlace)
+{
+    using API = StringAPI<TypeParam>;
+    auto input = TestFixture::lit("Hello World!");
+    auto str = input;
+    API::obfuscate_inplace(str, TestFixture::lit("key"));
+    EXPECT_EQ(str, API::obfuscate(input, TestFixture::lit("key")));
+    API::obfuscate_inplace(str, TestFixture::lit("key"));
+    EXPECT_EQ(str, input);
+}
+
+TYPED_TEST(StringTest, Obfuscate_EmptyKey)
+{
+    auto input = TestFixture::lit("Hello World!");
+    EXPECT_EQ(StringAPI<TypeParam>::obfuscate(input, TestFixture::lit("")), input);
+}
+
+TEST(StringViewTest, AcceptsCharPointers)
+{
+    const char* header = "Content-Type: text/plain";
+    EXPECT_TRUE(swe::str_starts_with(header, "content-type", swe::string_compare_type::ordinal_ignore_case));
+    EXPECT_TRUE(swe::str_ends_with(header, "plain"));
+    EXPECT_TRUE(swe::str_equals(swe::string_view(header, 12), "CONTENT-TYPE", swe::string_compare_type::ordinal_ignore_case));
+    EXPECT_EQ(swe::str_trim_view("  value  "), "value");
+    EXPECT_TRUE(swe::wstr_starts_with(L"Hello", L"he", swe::string_compare_type::ordinal_ignore_case));
+}
+
+TEST(StringViewTest, BasicOperations)
+{
+    swe::string_view view("hello world");
+    EXPECT_EQ(view.size(), 11u);
+    EXPECT_EQ(view.substr(6), "world");
+    EXPECT_EQ(view.find("o"), 4u);
+    EXPECT_EQ(view.rfind('o'), 7u);
+    EXPECT_EQ(view.find("xyz"), swe::string_view::npos);
+    EXPECT_EQ(view.find_first_of("ow"), 4u);
+    EXPECT_EQ(view.find_last_not_of("dl"), 8u);
+    EXPECT_TRUE(swe::string_view("abc") < swe::string_view("abd"));
+    EXPECT_EQ(std::string(view.substr(0, 5)), "hello");
+    EXPECT_THROW(view.substr(12), std::out_of_range);
+}
+
+TEST(Utf8CaseTest, AsciiScanKernelsMatchScalar)
+{
+    std::vector<swe::detail::ascii_scan_kernel> kernels;
+#if SWE_HAS_X86_SIMD
+    const swe::detail::cpu_features& features = swe::detail::get_cpu_features();
+    if (features.sse2)
+        kernels.push_back(&swe::detail::ascii_scan_sse2);
+    if (features.avx2)
+        kernels.push_back(&swe::detail::ascii_scan_avx2);
+    if (features.avx512bw)
+        kernels.push_back(&swe::detail::ascii_scan_avx512bw);
+#endif
+    for (size_t length = 0; length < 140; ++length)
+    {
+        for (size_t marker = 0; marker <= length; ++marker)
+        {
+            std::string data(length, 'a');
+            if (marker < length)
+                data[marker] = '\x80';
+            EXPECT_EQ(swe::detail::ascii_scan_scalar(data.data(), data.size()), marker);
+            for (swe::detail::ascii_scan_kernel kernel : kernels)
+                EXPECT_EQ(kernel(data.data(), data.size()), marker);
+        }
+    }
+}
+
+TEST(Utf8CaseTest, ConvertsUnicodeLetters)
+{
+    // "StraßE Äpfel 123": ß has no single-code-point upper case and is left unchanged
+    std::string input = "Stra\xC3\x9F" "E \xC3\x84pfel 123";
+    EXPECT_EQ(swe::str_to_lower(input), "stra\xC3\x9F" "e \xC3\xA4pfel 123");
+    EXPECT_EQ(swe::str_to_upper(input), "STRA\xC3\x9F" "E \xC3\x84PFEL 123");
+    // Greek and Cyrillic
+    EXPECT_EQ(swe::str_to_upper("\xCE\xB1\xCE\xB2\xCE\xB3 \xD0\xB4\xD0\xB0"), "\xCE\x91\xCE\x92\xCE\x93 \xD0\x94\xD0\x90");
+}
+
+TEST(Utf8CaseTest, EncodedLengthCanChange)
+{
+    // U+023A (2 bytes) lowers to U+2C65 (3 bytes); U+0131 dotless i (2 bytes) uppers to 'I'
+    EXPECT_EQ(swe::str_to_lower("x\xC8\xBAy"), "x\xE2\xB1\xA5y");
+    EXPECT_EQ(swe::str_to_upper("x\xC4\xB1y"), "XIY");
+    std::string text = "abc \xC8\xBA def";
+    swe::str_to_lower_inplace(text);
+    EXPECT_EQ(text, "abc \xE2\xB1\xA5 def");
+}
+
+TEST(Utf8CaseTest, InvalidBytesAreCopied)
+{
+    EXPECT_EQ(swe::str_to_lower("\xFF" "A\xC3"), "\xFF" "a\xC3");
+    EXPECT_EQ(swe::str_to_upper("\xC0\xAF" "b"), "\xC0\xAF" "B");
+    EXPECT_FALSE(swe::str_equals("\xC4", "\xC3\x84", swe::string_compare_type::ordinal_ignore_case));
+}
+
+TEST(Utf8CaseTest, TitleCase)
+{
+    // "élan vital ǆungla" -> "Élan Vital ǅungla" (U+01C6 title-cases to U+01C5, not U+01C4)
+    EXPECT_EQ(swe::str_to_title("\xC3\xA9LAN vital \xC7\x86ungla"), "\xC3\x89lan Vital \xC7\x85ungla");
+}
+
+TEST(Utf8CaseTest, InPlaceMatchesCopy)
+{
+    const char* pieces[] = {"a", "Z", " ", "\xC3\x84", "\xC3\xA4", "\xC8\xBA", "\xC4\xB1", "\xE2\x84\xAA", "\xF0\x90\x90\x80", "\xFF", "0123456789"};
+    std::mt19937 rng(11);
+    for (int round = 0; round < 300; ++round)
+    {
+        std::string input;
+        for (int i = rng() % 30; i > 0; --i)
+            input += pieces[rng() % (sizeof(pieces) / sizeof(pieces[0]))];
+        std::string lower = input, upper = input, title = input;
+        swe::str_to_lower_inplace(lower);
+        swe::str_to_upper_inplace(upper);
+        swe::str_to_title_inplace(title);
+        EXPECT_EQ(lower, swe::str_to_lower(input));
+        EXPECT_EQ(upper, swe::str_to_upper(input));
+        EXPECT_EQ(title, swe::str_to_title(input));
+    }
+}
+
+TEST(Utf8CaseTest, IgnoreCaseComparison)
+{
+    const swe::string_compare_type ignore_case = swe::string_compare_type::ordinal_ignore_case;
+    EXPECT_TRUE(swe::str_equals("\xC3\x84pfel und Birnen aus \xC3\x96sterreich", "\xC3\xA4PFEL UND BIRNEN AUS \xC3\xB6STERREICH", ignore_case));
+    // U+212A KELVIN SIGN (3 bytes) folds to 'k' (1 byte)
+    EXPECT_TRUE(swe::str_equals("\xE2\x84\xAA" "elvin", "kelvin", ignore_case));
+    EXPECT_TRUE(swe::str_starts_with("\xE2\x84\xAA" "ELVIN scale", "kelvin", ignore_case));
+    EXPECT_TRUE(swe::str_starts_with("kelvin scale", "\xE2\x84\xAA" "ELVIN", ignore_case));
+    EXPECT_TRUE(swe::str_ends_with("Farbe: GR\xC3\x9CN", "\xC3\xBCn", ignore_case));
+    EXPECT_TRUE(swe::str_ends_with("100 \xE2\x84\xAA", "k", ignore_case));
+    EXPECT_FALSE(swe::str_ends_with("gr\xC3\xBCn", "xgr\xC3\xBCn", ignore_case));
+    EXPECT_FALSE(swe::str_equals("\xC3\x84", "a", ignore_case));
+    // Final sigma folds like sigma
+    EXPECT_TRUE(swe::str_equals("\xCF\x82", "\xCE\xA3", ignore_case));
+    // The ASCII policy does not fold non-ASCII letters
+    EXPECT_FALSE(swe::str_equals("\xC3\x84", "\xC3\xA4", swe::string_compare_type::ordinal_ignore_case_ascii));
+}
+
+
+TEST(Utf8CaseTest, NonAsciiFoldPartners)
+{
+    // The case-insensitive find relies on these being the only non-ASCII code points with ASCII folds
+    for (std::uint32_t cp = 0x80; cp < 0x110000; ++cp)
+    {
+        const std::uint32_t folded = swe::detail::fold_code_point(cp);
+        if (folded < 0x80)
+        {
+            EXPECT_TRUE(swe::detail::has_non_ascii_fold_partner(static_cast<char>(folded))) << std::hex << cp;
+        }
+    }
+    for (char c = 'a'; c <= 'z'; ++c)
+        EXPECT_EQ(swe::detail::has_non_ascii_fold_partner(c), c == 's' || c == 'k') << c;
+}
+
+TEST(AsciiCaseTest, KernelsMatchScalar)
+{
+    std::vector<swe::detail::ascii_case_kernel> kernels;
+#if SWE_HAS_X86_SIMD
+    const swe::detail::cpu_features& features = swe::detail::get_cpu_features();
+    if (features.sse2)
+        kernels.push_back(&swe::detail::ascii_case_sse2);
+    if (features.avx2)
+        kernels.push_back(&swe::detail::ascii_case_avx2);
+    if (features.avx512bw)
+        kernels.push_back(&swe::detail::ascii_case_avx512bw);
+#endif
+    kernels.push_back(swe::detail::ascii_case_dispatch());
+
+    // Every byte value, at lengths that exercise full vectors and every tail size
+    std::string source;
+    for (int i = 0; i < 512; ++i)
+        source.push_back(static_cast<char>(i * 7 + 3));
+
+    for (char first : {'A', 'a'})
+    {
+        for (std::size_t length = 0; length <= 200; ++length)
+        {
+            std::string expected(length, '\0');
+            swe::detail::ascii_case_scalar(&expected[0], source.data() + 1, length, first);
+            for (swe::detail::ascii_case_kernel kernel : kernels)
+            {
+                std::string actual(source.data() + 1, length);
+                kernel(&actual[0], actual.data(), length, first);
+                ASSERT_EQ(actual, expected) << "length " << length;
+            }
+        }
+    }
+}
+
+namespace
+{
+    // Wide characters from ASCII, Latin-1, beyond 0xFF and (where wchar_t is signed 32-bit) negative values
+    std::wstring random_wide(std::mt19937& rng, std::size_t length, const std::wstring& extra = std::wstring())
+    {
+        std::wstring result(length, L' ');
+        for (wchar_t& c : result)
+        {
+            switch (rng() % 8)
+            {
+            case 0:
+                c = static_cast<wchar_t>(0x80 + rng() % 0x80);
+                break;
+            case 1:
+                c = static_cast<wchar_t>(rng() % 2 ? 0x100 + rng() % 0x1000 : static_cast<std::uint32_t>(rng()));
+                break;
+            case 2:
+                if (!extra.empty())
+                {
+                    c = extra[rng() % extra.size()];
+                    break;
+                }
+                // fall through
+            default:
+                c = static_cast<wchar_t>(rng() % 0x80);
+            }
+        }
+        return result;
+    }
+} // namespace
+
+TEST(WideKernelTest, CaseKernelsMatchScalar)
+{
+    std::vector<swe::detail::wide_case_kernel> kernels;
+#if SWE_HAS_X86_SIMD && SWE_WCHAR_IS_32BIT
+    const swe::detail::cpu_features& features = swe::detail::get_cpu_features();
+    if (features.sse2)
+        kernels.push_back(&swe::detail::wide_case_sse2);
+    if (features.avx2)
+        kernels.push_back(&swe::detail::wide_case_avx2);
+    if (features.avx512bw)
+        kernels.push_back(&swe::detail::wide_case_avx512bw);
+#endif
+    kernels.push_back(swe::detail::wide_case_dispatch());
+
+    std::mt19937 rng(17);
+    for (int round = 0; round < 400; ++round)
+    {
+        // Mostly ASCII, so that runs cross several vectors before a character beyond ASCII stops them
+        std::wstring source = random_wide(rng, rng() % 100);
+        for (wchar_t& c : source)
+            if (rng() % 8 != 0)
+                c = static_cast<wchar_t>(rng() % 0x80);
+        for (wchar_t first : {L'A', L'a'})
+        {
+            std::wstring expected = source;
+            const std::size_t expected_count = swe::detail::wide_case_scalar(&expected[0], source.data(), source.size(), first);
+            for (swe::detail::wide_case_kernel kernel : kernels)
+            {
+                std::wstring actual = source;
+                ASSERT_EQ(kernel(&actual[0], actual.data(), actual.size(), first), expected_count);
+                ASSERT_TRUE(actual == expected);
+            }
+        }
+    }
+}
+
+TEST(WideKernelTest, FoldKernelsMatchScalar)
+{
+    std::vector<swe::detail::wide_fold_kernel> kernels;
+#if SWE_HAS_X86_SIMD && SWE_WCHAR_IS_32BIT
+    const swe::detail::cpu_features& features = swe::detail::get_cpu_features();
+    if (features.sse2)
+        kernels.push_back(&swe::detail::wide_fold_sse2);
+    if (features.avx2)
+        kernels.push_back(&swe::detail::wide_fold_avx2);
+    if (features.avx512bw)
+        kernels.push_back(&swe::detail::wide_fold_avx512bw);
+#endif
+    kernels.push_back(swe::detail::wide_fold_dispatch());
+
+    std::mt19937 rng(19);
+    for (int round = 0; round < 400; ++round)
+    {
+        const std::wstring lhs = random_wide(rng, rng() % 100);
+        // rhs differs from lhs only in the case of ASCII letters, except for one character
+        std::wstring rhs = lhs;
+        for (wchar_t& c : rhs)
+            if (rng() % 2 && swe::detail::wide_unit(c) < 0x80)
+                c = static_cast<wchar_t>(swe::ascii_to_upper(static_cast<char>(c)));
+        if (!rhs.empty() && rng() % 2)
+            rhs[rng() % rhs.size()] = static_cast<wchar_t>(rng() % 0x200);
+        const std::size_t expected = swe::detail::wide_fold_scalar(lhs.data(), rhs.data(), lhs.size());
+        for (swe::detail::wide_fold_kernel kernel : kernels)
+            ASSERT_EQ(kernel(lhs.data(), rhs.data(), lhs.size()), expected);
+    }
+}
+
+TEST(WideKernelTest, SetKernelsMatchScalar)
+{
+    std::vector<std::pair<swe::detail::wide_set_kernel, swe::detail::wide_set_reverse_kernel>> kernels;
+#if SWE_HAS_X86_SIMD && SWE_WCHAR_IS_32BIT
+    const swe::detail::cpu_features& features = swe::detail::get_cpu_features();
+    if (features.ssse3)
+        kernels.emplace_back(&swe::detail::wide_set_ssse3, &swe::detail::wide_set_reverse_ssse3);
+    if (features.avx2)
+        kernels.emplace_back(&swe::detail::wide_set_avx2, &swe::detail::wide_set_reverse_avx2);
+    if (features.avx512bw)
+        kernels.emplace_back(&swe::detail::wide_set_avx512bw, &swe::detail::wide_set_reverse_avx512bw);
+#endif
+    kernels.emplace_back(swe::detail::wide_set_dispatch(), swe::detail::wide_set_reverse_dispatch());
+
+    std::mt19937 rng(23);
+    for (int round = 0; round < 400; ++round)
+    {
+        std::string members(1 + rng() % 6, ' ');
+        for (char& c : members)
+            c = static_cast<char>(rng());
+        const swe::detail::byte_set set = swe::detail::make_byte_set(members.data(), members.size());
+        std::wstring extra;
+        for (char c : members)
+            extra.push_back(static_cast<wchar_t>(static_cast<unsigned char>(c)));
+        std::wstring data = random_wide(rng, rng() % 200, extra);
+        // Long runs of members make the kernels cross blocks before they stop
+        if (rng() % 2)
+            data.insert(0, 70 + rng() % 70, extra[0]);
+        if (rng() % 2)
+            data.append(70 + rng() % 70, extra[0]);
+        for (bool member : {true, false})
+        {
+            const std::size_t expected = swe::detail::wide_set_scalar(data.data(), data.size(), set, member);
+            const std::size_t expected_reverse = swe::detail::wide_set_reverse_scalar(data.data(), data.size(), set, member);
+            for (const auto& kernel : kernels)
+            {
+                ASSERT_EQ(kernel.first(data.data(), data.size(), set, member), expected);
+                ASSERT_EQ(kernel.second(data.data(), data.size(), set, member), expected_reverse);
+            }
+        }
+    }
+}
+
+TEST(WideStringTest, BulkPathsMatchCharacterRules)
+{
+    std::mt19937 rng(29);
+    for (int round = 0; round < 200; ++round)
+    {
+        const std::wstring source = random_wide(rng, rng() % 150);
+        std::wstring lower = source;
+        std::wstring upper = source;
+        for (wchar_t& c : lower)
+            c = static_cast<wchar_t>(std::towlower(static_cast<std::wint_t>(c)));
+        for (wchar_t& c : upper)
+            c = static_cast<wchar_t>(std::towupper(static_cast<std::wint_t>(c)));
+        ASSERT_TRUE(swe::wstr_to_lower(source) == lower);
+        ASSERT_TRUE(swe::wstr_to_upper(source) == upper);
+        EXPECT_TRUE(swe::wstr_equals(lower, upper, swe::string_compare_type::ordinal_ignore_case));
+        EXPECT_TRUE(swe::wstr_equals(source, upper, swe::string_compare_type::ordinal_ignore_case));
+    }
+
+    const std::wstring padded = std::wstring(40, L' ') + L"été 中" + std::wstring(40, L'\t');
+    EXPECT_TRUE(swe::wstr_trim(padded) == L"été 中");
+    EXPECT_FALSE(swe::wstr_equals(std::wstring(50, L'a') + L"b", std::wstring(50, L'A') + L"c", swe::string_compare_type::ordinal_ignore_case));
+}
+
+TEST(CharClassTest, KernelsMatchScalar)
+{
+    std::vector<swe::detail::char_class_kernel> kernels;
+#if SWE_HAS_X86_SIMD
+    const swe::detail::cpu_features& features = swe::detail::get_cpu_features();
+    if (features.sse2)
+        kernels.push_back(&swe::detail::classify_block_sse2);
+    if (features.avx2)
+        kernels.push_back(&swe::detail::classify_block_avx2);
+#endif
+    kernels.push_back(swe::detail::char_class_dispatch());
+
+    for (int start = 0; start < 256; start += 32)
+    {
+        char block[32];
+        for (int i = 0; i < 32; ++i)
+            block[i] = static_cast<char>(start + i);
+        const swe::detail::char_class_masks expected = swe::detail::classify_block_scalar(block);
+        for (int i = 0; i < 32; ++i)
+        {
+            EXPECT_EQ((expected.alnum >> i) & 1, swe::ascii_is_alnum(block[i]) ? 1u : 0u) << start + i;
+            EXPECT_EQ((expected.space >> i) & 1, swe::ascii_is_space(block[i]) ? 1u : 0u) << start + i;
+        }
+        for (swe::detail::char_class_kernel kernel : kernels)
+        {
+            const swe::detail::char_class_masks actual = kernel(block);
+            EXPECT_EQ(actual.alnum, expected.alnum) << start;
+            EXPECT_EQ(actual.space, expected.space) << start;
+        }
+    }
+}
+
+TEST(CharClassTest, SlugAndTitleMatchPerCharacterRules)
+{
+    // Per-character definitions of the two conversions on ASCII text
+    const auto slug = [](const std::string& str) {
+        std::string result;
+        bool last_was_sep = true;
+        for (const char c : str)
+        {
+            if (swe::ascii_is_alnum(c))
+            {
+                result += swe::ascii_to_lower(c);
+                last_was_sep = false;
+            }
+            else if (!last_was_sep)
+            {
+                result += '_';
+                last_was_sep = true;
+            }
+        }
+        if (!result.empty() && result.back() == '_')
+            result.pop_back();
+        return result;
+    };
+    const auto title = [](const std::string& str) {
+        std::string result;
+        bool new_word = true;
+        for (const char c : str)
+        {
+            result += new_word ? swe::ascii_to_upper(c) : swe::ascii_to_lower(c);
+            new_word = swe::ascii_is_space(c);
+        }
+        return result;
+    };
+
+    std::mt19937 rng(18);
+    const char alphabet[] = "aZ9 \t-_.!";
+    std::uniform_int_distribution<int> letter(0, 8);
+    for (std::size_t length = 0; length < 150; ++length)
+    {
+        std::string text(length, ' ');
+        for (char& c : text)
+            c = alphabet[letter(rng)];
+        EXPECT_EQ(swe::str_to_slug(text), slug(text)) << text;
+        EXPECT_EQ(swe::str_to_title(text), title(text)) << text;
+        std::string inplace = text;
+        swe::str_to_slug_inplace(inplace);
+        EXPECT_EQ(inplace, slug(text)) << text;
+    }
+}
+
+TEST(CharClassTest, SlugTransliteration)
+{
+    const swe::string_slug_transliteration latin = swe::string_slug_transliteration::latin;
+    const std::string dessert = "Cr\xC3\xA8me Br\xC3\xBBl\xC3\xA9" "e \xE2\x80\x93 Stra\xC3\x9F" "e";
+    EXPECT_EQ(swe::str_to_slug(dessert), "cr_me_br_l_e_stra_e");
+    EXPECT_EQ(swe::str_to_slug(dessert, '-', latin), "creme-brulee-strasse");
+    EXPECT_EQ(swe::str_to_slug("\xC3\x86on \xC3\x97 \xC5\x81\xC3\xB3" "d\xC5\xBA", '_', latin), "aeon_lodz");
+
+    // Transliterated letters at every position around the block boundaries
+    for (std::size_t offset = 0; offset < 70; ++offset)
+    {
+        std::string text(offset, 'x');
+        text += "\xC3\x9F\xC3\x84-y";
+        std::string inplace = text;
+        swe::str_to_slug_inplace(inplace, '_', latin);
+        EXPECT_EQ(inplace, std::string(offset, 'x') + "ssa_y") << offset;
+    }
+
+    std::wstring wide = L"Grüße";
+    swe::wstr_to_slug_inplace(wide, L'_', latin);
+    EXPECT_EQ(wide, L"grusse");
+    EXPECT_EQ(swe::basic_str_to_slug(std::u16string(u"Ångström æther"), u'-', latin), u"angstrom-aether");
+    EXPECT_EQ(swe::basic_str_to_slug(std::u32string(U"Å b"), U'-'), U"b");
+}
+
+TEST(JoinTest, AcceptsStringLikeRanges)
+{
+    const char* literals[] = {"a", "bc", "", "d"};
+    EXPECT_EQ(swe::str_join(literals, ", "), "a, bc, , d");
+
+    const std::vector<swe::string_view> views = {"x", "y", "z"};
+    EXPECT_EQ(swe::str_join(views, ""), "xyz");
+
+    const std::list<std::string> list = {"one", "two"};
+    EXPECT_EQ(swe::str_join(list.begin(), list.end(), "->"), "one->two");
+    EXPECT_EQ(swe::str_join(list.begin(), list.begin(), "->"), "");
+
+    const std::vector<std::wstring> wide = {L"a", L"b"};
+    EXPECT_EQ(swe::wstr_join(wide.begin(), wide.end(), L"|"), L"a|b");
+    const wchar_t* wide_literals[] = {L"c", L"d"};
+    EXPECT_EQ(swe::wstr_join(wide_literals, L"|"), L"c|d");
+}
+
+TEST(JoinTest, AppendsToExistingOutput)
+{
+    std::string line = "row: ";
+    const std::vector<std::string> fields = {"1", "2", "3"};
+    EXPECT_EQ(&swe::str_join_append(line, fields, ","), &line);
+    EXPECT_EQ(line, "row: 1,2,3");
+    swe::str_join_append(line, std::vector<std::string>(), ",");
+    EXPECT_EQ(line, "row: 1,2,3");
+
+    std::wstring wide = L"[";
+    swe::wstr_join_append(wide, std::vector<std::wstring>{L"a", L"b"}, L", ");
+    EXPECT_EQ(wide, L"[a, b");
+}
+
+TEST(BasicStringTest, Utf16CaseMappingHandlesSurrogatePairs)
+{
+    // U+0130 maps to a plain 'i', U+10400 (DESERET CAPITAL LONG I) is a surrogate pair in UTF-16
+    EXPECT_EQ(swe::basic_str_to_lower(std::u16string(u"\u00C4RGER \u0130 \U00010400")), u"\u00E4rger i \U00010428");
+    EXPECT_EQ(swe::basic_str_to_upper(std::u16string(u"\u00E4rger \u03C9 \U00010428")), u"\u00C4RGER \u03A9 \U00010400");
+    EXPECT_EQ(swe::basic_str_to_title(std::u16string(u"\u01C6ungla \u00DFtra\u00DFe")), u"\u01C5ungla \u00DFtra\u00DFe");
+
+    // Unpaired surrogates are left alone
+    const std::u16string broken = {u'A', char16_t(0xD801), u'B', char16_t(0xDC00)};
+    const std::u16string expected = {u'a', char16_t(0xD801), u'b', char16_t(0xDC00)};
+    EXPECT_EQ(swe::basic_str_to_lower(broken), expected);
+}
+
+TEST(BasicStringTest, Utf32CaseMapping)
+{
+    std::u32string text = U"\u0394\u03B5\u03BB\u03C4\u03B1 \U00010400";
+    swe::basic_str_to_upper_inplace(text);
+    EXPECT_EQ(text, U"\u0394\u0395\u039B\u03A4\u0391 \U00010400");
+    EXPECT_EQ(swe::basic_str_to_lower(std::move(text)), U"\u03B4\u03B5\u03BB\u03C4\u03B1 \U00010428");
+}
+
+TEST(BasicStringTest, IgnoreCaseComparisonFoldsCodePoints)
+{
+    using swe::string_compare_type;
+    EXPECT_TRUE(swe::basic_str_equals<char16_t>(u"Stra\u00DFe \U00010400", u"STRA\u00DFE \U00010428", string_compare_type::ordinal_ignore_case));
+    EXPECT_FALSE(swe::basic_str_equals<char16_t>(u"Stra\u00DFe", u"STRASSE", string_compare_type::ordinal_ignore_case));
+    EXPECT_TRUE(swe::basic_str_starts_with<char16_t>(u"\u00C9cole", u"\u00E9C", string_compare_type::ordinal_ignore_case));
+    EXPECT_FALSE(swe::basic_str_starts_with<char16_t>(u"\u00C9cole", u"\u00E9C", string_compare_type::ordinal_ignore_case_ascii));
+    EXPECT_TRUE(swe::basic_str_ends_with<char32_t>(U"\u00C9COLE", U"\u00E9cole", string_compare_type::ordinal_ignore_case));
+    EXPECT_TRUE(swe::basic_str_ends_with<char32_t>(U"\u00C9COLE", U"Ole", string_compare_type::ordinal_ignore_case_ascii));
+    EXPECT_FALSE(swe::basic_str_equals<char32_t>(U"a", U"A", string_compare_type::ordinal));
+
+    // An unpaired surrogate only matches itself
+    const char16_t lone[] = {0xD801, 0};
+    const char16_t pair[] = {0xD801, 0xDC28, 0};
+    EXPECT_TRUE(swe::basic_str_equals<char16_t>(lone, lone, string_compare_type::ordinal_ignore_case));
+    EXPECT_FALSE(swe::basic_str_equals<char16_t>(lone, pair, string_compare_type::ordinal_ignore_case));
+}
+
+TEST(BasicStringTest, SearchAndSplit)
+{
+    const std::u16string text = u"\u03B1,\u03B2;\u03B3,\u03B1";
+    EXPECT_EQ(swe::basic_str_find<char16_t>(text, u"\u03B1"), 0u);
+    EXPECT_EQ(swe::basic_str_find<char16_t>(text, u"\u03B1", 1), 6u);
+    EXPECT_EQ(swe::basic_str_find<char16_t>(text, u"\u03B4"), swe::u16string_view::npos);
+    EXPECT_EQ(swe::basic_str_count<char16_t>(text, u"\u03B1"), 2u);
+    EXPECT_TRUE(swe::basic_str_contains<char16_t>(text, u";\u03B3"));
+    EXPECT_EQ(swe::basic_str_split(text, u','), (std::vector<std::u16string>{u"\u03B1", u"\u03B2;\u03B3", u"\u03B1"}));
+    EXPECT_EQ(swe::basic_str_split_any<char16_t>(text, u",;"), (std::vector<std::u16string>{u"\u03B1", u"\u03B2", u"\u03B3", u"\u03B1"}));
+    EXPECT_EQ(swe::basic_str_split_whitespace<char32_t>(U"  one\ttwo "), (std::vector<std::u32string>{U"one", U"two"}));
+
+    std::u16string joined = u"[";
+    swe::basic_str_join_append(joined, std::vector<swe::u16string_view>{u"a", u"b"}, u", ");
+    EXPECT_EQ(joined, u"[a, b");
+    const char32_t* parts[] = {U"x", U"y"};
+    EXPECT_EQ(swe::basic_str_join<char32_t>(std::begin(parts), std::end(parts), U"+"), U"x+y");
+}
+
+TEST(BasicStringTest, WrappersMatchTemplates)
+{
+    const std::string narrow = "  Hello World, \xC3\x84rger!  ";
+    EXPECT_EQ(swe::str_to_lower(narrow), swe::basic_str_to_lower(narrow));
+    EXPECT_EQ(swe::str_to_title(narrow), swe::basic_str_to_title(narrow));
+    EXPECT_EQ(swe::str_trim_view(narrow), swe::basic_str_trim_view<char>(narrow));
+    EXPECT_EQ(swe::str_equals(narrow, "  HELLO WORLD, \xC3\xA4RGER!  ", swe::string_compare_type::ordinal_ignore_case),
+              swe::basic_str_equals<char>(narrow, "  HELLO WORLD, \xC3\xA4RGER!  ", swe::string_compare_type::ordinal_ignore_case));
+
+    const std::wstring wide = L"  Hello World  ";
+    EXPECT_EQ(swe::wstr_to_upper(wide), swe::basic_str_to_upper(wide));
+    EXPECT_EQ(swe::wstr_to_slug(wide, L'-'), swe::basic_str_to_slug(wide, L'-'));
+    EXPECT_EQ(swe::wstr_find(wide, L"World"), swe::basic_str_find<wchar_t>(wide, L"World"));
+}
+
+#if defined(__cpp_char8_t) && defined(__cpp_lib_char8_t)
+TEST(BasicStringTest, Utf8CharStrings)
+{
+    EXPECT_EQ(swe::basic_str_to_upper(std::u8string(u8"\u00E4rger")), u8"\u00C4RGER");
+    EXPECT_EQ(swe::basic_str_to_slug(std::u8string(u8" Hello, World ")), u8"hello_world");
+    EXPECT_TRUE(swe::basic_str_equals<char8_t>(u8"\u00C4rger", u8"\u00E4RGER", swe::string_compare_type::ordinal_ignore_case));
+    EXPECT_EQ(swe::basic_str_find<char8_t>(u8"abc\u00E4", u8"\u00E4"), 3u);
+}
+#endif
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,375 @@
+#include "../include/swe/utf.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Random code points from every UTF-8 length class, weighted towards ASCII runs
+    std::u32string random_code_points(std::mt19937& rng, size_t count)
+    {
+        std::u32string result;
+        for (size_t i = 0; i < count; ++i)
+        {
+            char32_t cp;
+            switch (rng() % 6)
+            {
+            case 0:
+            case 1:
+            case 2:
+                cp = static_cast<char32_t>(rng() % 0x80);
+                break;
+            case 3:
+                cp = static_cast<char32_t>(0x80 + rng() % (0x800 - 0x80));
+                break;
+            case 4:
+                cp = static_cast<char32_t>(0x800 + rng() % (0x10000 - 0x800 - 0x800));
+                if (cp >= 0xD800)
+                    cp += 0x800;
+                break;
+            default:
+                cp = static_cast<char32_t>(0x10000 + rng() % (0x110000 - 0x10000));
+                break;
+            }
+            result += cp;
+        }
+        return result;
+    }
+
+    std::string encode(const std::u32string& code_points)
+    {
+        std::string result;
+        for (char32_t cp : code_points)
+        {
+            char buffer[4];
+            swe::detail::utf8_encode(cp, buffer);
+            result.append(buffer, swe::detail::utf8_length(cp));
+        }
+        return result;
+    }
+
+    std::vector<swe::detail::utf8_validate_kernel> validate_kernels()
+    {
+        std::vector<swe::detail::utf8_validate_kernel> kernels;
+        kernels.push_back(&swe::detail::utf8_validate_scalar);
+#if SWE_HAS_X86_SIMD
+        const swe::detail::cpu_features& features = swe::detail::get_cpu_features();
+        if (features.ssse3)
+            kernels.push_back(&swe::detail::utf8_validate_ssse3);
+        if (features.avx2)
+            kernels.push_back(&swe::detail::utf8_validate_avx2);
+        if (features.avx512bw)
+            kernels.push_back(&swe::detail::utf8_validate_avx512bw);
+#endif
+        return kernels;
+    }
+} // namespace
+
+TEST(UtfTest, ValidateKernelsRejectEveryMalformedForm)
+{
+    const char* malformed[] = {
+        "\x80",             // Continuation without a lead
+        "\xBF\x80",         // Two continuations
+        "\xC3",             // Truncated two-byte sequence
+        "\xC3\x41",         // Lead followed by ASCII
+        "\xC0\xAF",         // Overlong two-byte form
+        "\xC1\xBF",         // Overlong two-byte form
+        "\xE0\x9F\xBF",     // Overlong three-byte form
+        "\xE2\x82",         // Truncated three-byte sequence
+        "\xED\xA0\x80",     // High surrogate
+        "\xED\xBF\xBF",     // Low surrogate
+        "\xF0\x8F\xBF\xBF", // Overlong four-byte form
+        "\xF4\x90\x80\x80", // Above U+10FFFF
+        "\xF5\x80\x80\x80", // Invalid lead
+        "\xFF",             // Invalid lead
+        "\xF0\x9F\x98",     // Truncated four-byte sequence
+        "\xE2\x82\xAC\xAC", // Extra continuation
+    };
+    const char* well_formed[] = {"\xC2\x80", "\xDF\xBF", "\xE0\xA0\x80", "\xED\x9F\xBF", "\xEE\x80\x80", "\xEF\xBF\xBF", "\xF0\x90\x80\x80", "\xF4\x8F\xBF\xBF"};
+
+    // Every case at every offset around the 16, 32 and 64 byte block boundaries, and at the end of the input
+    for (swe::detail::utf8_validate_kernel kernel : validate_kernels())
+    {
+        for (size_t offset = 0; offset < 70; ++offset)
+        {
+            for (size_t padding : {size_t(0), size_t(1), size_t(40)})
+            {
+                for (const char* bytes : malformed)
+                {
+                    const std::string text = std::string(offset, 'a') + bytes + std::string(padding, 'b');
+                    EXPECT_FALSE(kernel(text.data(), text.size())) << offset << ' ' << padding;
+                }
+                for (const char* bytes : well_formed)
+                {
+                    const std::string text = std::string(offset, 'a') + bytes + std::string(padding, 'b');
+                    EXPECT_TRUE(kernel(text.data(), text.size())) << offset << ' ' << padding;
+                }
+            }
+        }
+    }
+}
+
+TEST(UtfTest, ValidateKernelsMatchScalarOnCorruptedText)
+{
+    std::mt19937 rng(12);
+    const std::vector<swe::detail::utf8_validate_kernel> kernels = validate_kernels();
+    for (int round = 0; round < 2000; ++round)
+    {
+        std::string text = encode(random_code_points(rng, rng() % 80));
+        EXPECT_TRUE(swe::utf8_is_valid(text));
+        if (!text.empty() && round % 2)
+            text[rng() % text.size()] = static_cast<char>(rng());
+        const bool expected = swe::detail::utf8_validate_scalar(text.data(), text.size());
+        for (swe::detail::utf8_validate_kernel kernel : kernels)
+            EXPECT_EQ(kernel(text.data(), text.size()), expected) << round;
+    }
+}
+
+TEST(UtfTest, SimdKernelsMatchScalar)
+{
+    std::mt19937 rng(5);
+    for (int round = 0; round < 500; ++round)
+    {
+        // Long ASCII runs reach the vector loops of the widening and narrowing kernels
+        std::u32string code_points = round % 2 ? std::u32string(rng() % 100, U'x') : std::u32string();
+        code_points += random_code_points(rng, rng() % 100);
+        const std::string utf8 = encode(code_points);
+        const std::u16string utf16 = swe::utf8_to_utf16(utf8);
+
+        std::vector<swe::detail::utf8_count_kernel> count_kernels(1, &swe::detail::utf8_count_scalar);
+        std::vector<swe::detail::widen_ascii_kernel<char16_t>> widen16(1, &swe::detail::widen_ascii_scalar<char16_t>);
+        std::vector<swe::detail::widen_ascii_kernel<char32_t>> widen32(1, &swe::detail::widen_ascii_scalar<char32_t>);
+        std::vector<swe::detail::narrow_ascii_kernel<char16_t>> narrow16(1, &swe::detail::narrow_ascii_scalar<char16_t>);
+        std::vector<swe::detail::narrow_ascii_kernel<char32_t>> narrow32(1, &swe::detail::narrow_ascii_scalar<char32_t>);
+        std::vector<swe::detail::utf16_measure_kernel<char16_t>> measure16(1, &swe::detail::utf16_measure_scalar<char16_t>);
+#if SWE_HAS_X86_SIMD
+        const swe::detail::cpu_features& features = swe::detail::get_cpu_features();
+        if (features.sse2)
+        {
+            count_kernels.push_back(&swe::detail::utf8_count_sse2);
+            widen16.push_back(&swe::detail::widen_ascii_sse2<char16_t>);
+            widen32.push_back(&swe::detail::widen_ascii_sse2<char32_t>);
+            narrow16.push_back(&swe::detail::narrow_ascii_sse2<char16_t>);
+            narrow32.push_back(&swe::detail::narrow_ascii_sse2<char32_t>);
+            measure16.push_back(&swe::detail::utf16_measure_sse2<char16_t>);
+        }
+        if (features.avx2)
+        {
+            count_kernels.push_back(&swe::detail::utf8_count_avx2);
+            widen16.push_back(&swe::detail::widen_ascii_avx2<char16_t>);
+            widen32.push_back(&swe::detail::widen_ascii_avx2<char32_t>);
+            narrow16.push_back(&swe::detail::narrow_ascii_avx2<char16_t>);
+            narrow32.push_back(&swe::detail::narrow_ascii_avx2<char32_t>);
+            measure16.push_back(&swe::detail::utf16_measure_avx2<char16_t>);
+        }
+        if (features.avx512bw)
+            count_kernels.push_back(&swe::detail::utf8_count_avx512bw);
+#endif
+
+        for (swe::detail::utf8_count_kernel kernel : count_kernels)
+        {
+            EXPECT_EQ(kernel(utf8.data(), utf8.size(), false), code_points.size());
+            EXPECT_EQ(kernel(utf8.data(), utf8.size(), true), utf16.size());
+        }
+
+        std::u16string wide16(utf8.size(), u'\0'), expected16(utf8.size(), u'\0');
+        std::u32string wide32(utf8.size(), U'\0'), expected32(utf8.size(), U'\0');
+        const size_t run = swe::detail::widen_ascii_scalar(utf8.data(), utf8.size(), &expected16[0]);
+        swe::detail::widen_ascii_scalar(utf8.data(), utf8.size(), &expected32[0]);
+        for (swe::detail::widen_ascii_kernel<char16_t> kernel : widen16)
+        {
+            EXPECT_EQ(kernel(utf8.data(), utf8.size(), &wide16[0]), run);
+            EXPECT_EQ(wide16, expected16);
+        }
+        for (swe::detail::widen_ascii_kernel<char32_t> kernel : widen32)
+        {
+            EXPECT_EQ(kernel(utf8.data(), utf8.size(), &wide32[0]), run);
+            EXPECT_EQ(wide32, expected32);
+        }
+
+        std::string narrow(utf8.size(), '\0');
+        for (swe::detail::narrow_ascii_kernel<char16_t> kernel : narrow16)
+        {
+            EXPECT_EQ(kernel(utf16.data(), utf16.size(), &narrow[0]), run);
+            EXPECT_EQ(narrow.substr(0, run), utf8.substr(0, run));
+        }
+        for (swe::detail::narrow_ascii_kernel<char32_t> kernel : narrow32)
+        {
+            EXPECT_EQ(kernel(code_points.data(), code_points.size(), &narrow[0]), run);
+            EXPECT_EQ(narrow.substr(0, run), utf8.substr(0, run));
+        }
+
+        for (swe::detail::utf16_measure_kernel<char16_t> kernel : measure16)
+        {
+            bool has_surrogates = false;
+            EXPECT_EQ(kernel(utf16.data(), utf16.size(), has_surrogates), utf8.size());
+            EXPECT_EQ(has_surrogates, utf16.size() != code_points.size());
+        }
+    }
+}
+
+TEST(UtfTest, TranscodingKernelsMatchScalar)
+{
+    std::mt19937 rng(21);
+    for (int round = 0; round < 1000; ++round)
+    {
+        // Runs of one sequence length at a time reach every vector step, including the all three-byte one
+        std::u32string code_points;
+        while (code_points.size() < 200)
+        {
+            const std::u32string sample = random_code_points(rng, 64);
+            const size_t length = swe::detail::utf8_length(sample[rng() % sample.size()]);
+            for (char32_t cp : sample)
+            {
+                if (swe::detail::utf8_length(cp) == length || rng() % 16 == 0)
+                    code_points += cp;
+            }
+        }
+        std::string utf8 = encode(code_points);
+        std::u16string utf16 = swe::utf8_to_utf16(utf8);
+        if (round % 3 == 0)
+        {
+            utf8[rng() % utf8.size()] = static_cast<char>(rng());
+            utf16[rng() % utf16.size()] = static_cast<char16_t>(0xD800 + rng() % 0x800);
+            code_points[rng() % code_points.size()] = static_cast<char32_t>(rng());
+        }
+
+        std::vector<swe::detail::utf8_to_units_kernel<char16_t>> to16(1, &swe::detail::utf8_to_units_scalar<char16_t>);
+        std::vector<swe::detail::utf8_to_units_kernel<char32_t>> to32(1, &swe::detail::utf8_to_units_scalar<char32_t>);
+        std::vector<swe::detail::units_to_utf8_kernel<char16_t>> from16(1, &swe::detail::units_to_utf8_scalar<char16_t>);
+        std::vector<swe::detail::units_to_utf8_kernel<char32_t>> from32(1, &swe::detail::units_to_utf8_scalar<char32_t>);
+#if SWE_HAS_X86_SIMD
+        if (swe::detail::get_cpu_features().ssse3)
+        {
+            to16.push_back(&swe::detail::utf8_to_units_ssse3<char16_t>);
+            to32.push_back(&swe::detail::utf8_to_units_ssse3<char32_t>);
+            from16.push_back(&swe::detail::units_to_utf8_ssse3<char16_t>);
+            from32.push_back(&swe::detail::units_to_utf8_ssse3<char32_t>);
+        }
+#endif
+
+        // Exactly sized buffers, so that a vector store past the end of the output is caught by sanitizers
+        std::u16string expected16(swe::utf16_length_from_utf8(utf8), u'\0');
+        swe::detail::utf8_to_units_scalar(utf8.data(), utf8.size(), &expected16[0]);
+        for (swe::detail::utf8_to_units_kernel<char16_t> kernel : to16)
+        {
+            std::vector<char16_t> out(expected16.size());
+            ASSERT_EQ(kernel(utf8.data(), utf8.size(), out.data()), out.size());
+            EXPECT_EQ(std::u16string(out.begin(), out.end()), expected16);
+        }
+        std::u32string expected32(swe::utf32_length_from_utf8(utf8), U'\0');
+        swe::detail::utf8_to_units_scalar(utf8.data(), utf8.size(), &expected32[0]);
+        for (swe::detail::utf8_to_units_kernel<char32_t> kernel : to32)
+        {
+            std::vector<char32_t> out(expected32.size());
+            ASSERT_EQ(kernel(utf8.data(), utf8.size(), out.data()), out.size());
+            EXPECT_EQ(std::u32string(out.begin(), out.end()), expected32);
+        }
+
+        std::string expected(swe::utf8_length_from_utf16(utf16), '\0');
+        swe::detail::units_to_utf8_scalar(utf16.data(), utf16.size(), &expected[0]);
+        for (swe::detail::units_to_utf8_kernel<char16_t> kernel : from16)
+        {
+            std::vector<char> out(expected.size());
+            ASSERT_EQ(kernel(utf16.data(), utf16.size(), out.data()), out.size());
+            EXPECT_EQ(std::string(out.begin(), out.end()), expected);
+        }
+        expected.assign(swe::utf8_length_from_utf32(code_points), '\0');
+        swe::detail::units_to_utf8_scalar(code_points.data(), code_points.size(), &expected[0]);
+        for (swe::detail::units_to_utf8_kernel<char32_t> kernel : from32)
+        {
+            std::vector<char> out(expected.size());
+            ASSERT_EQ(kernel(code_points.data(), code_points.size(), out.data()), out.size());
+            EXPECT_EQ(std::string(out.begin(), out.end()), expected);
+        }
+    }
+}
+
+TEST(UtfTest, ConvertsKnownText)
+{
+    const std::string utf8 = "h\xC3\xA9llo \xE2\x82\xAC \xF0\x9D\x84\x9E";
+    const std::u16string utf16 = u"héllo € \U0001D11E";
+    const std::u32string utf32 = U"héllo € \U0001D11E";
+    const std::wstring wide = L"héllo € \U0001D11E";
+
+    EXPECT_EQ(swe::utf8_to_utf16(utf8), utf16);
+    EXPECT_EQ(swe::utf8_to_utf32(utf8), utf32);
+    EXPECT_EQ(swe::utf8_to_wide(utf8), wide);
+    EXPECT_EQ(swe::utf16_to_utf8(utf16), utf8);
+    EXPECT_EQ(swe::utf32_to_utf8(utf32), utf8);
+    EXPECT_EQ(swe::wide_to_utf8(wide), utf8);
+
+    EXPECT_EQ(swe::utf16_length_from_utf8(utf8), utf16.size());
+    EXPECT_EQ(swe::utf32_length_from_utf8(utf8), utf32.size());
+    EXPECT_EQ(swe::wide_length_from_utf8(utf8), wide.size());
+    EXPECT_EQ(swe::utf8_length_from_utf16(utf16), utf8.size());
+    EXPECT_EQ(swe::utf8_length_from_utf32(utf32), utf8.size());
+    EXPECT_EQ(swe::utf8_length_from_wide(wide), utf8.size());
+
+    EXPECT_EQ(swe::utf8_to_utf16(""), u"");
+    EXPECT_EQ(swe::wide_to_utf8(L""), "");
+}
+
+TEST(UtfTest, ReplacesMalformedInput)
+{
+    const std::string replacement = "\xEF\xBF\xBD";
+
+    // One replacement per invalid byte; the valid bytes around them are kept
+    EXPECT_EQ(swe::utf8_to_utf16("a\xC3" "b"), u"a�b");
+    EXPECT_EQ(swe::utf8_to_utf32("\xED\xA0\x80"), U"���");
+    EXPECT_EQ(swe::utf8_to_utf32("\xF0\x9F\x98"), U"���");
+
+    const char16_t lone_high[] = {u'a', 0xD800, u'b', 0};
+    const char16_t lone_low[] = {0xDC00, 0};
+    const char16_t reversed[] = {0xDC00, 0xD800, 0};
+    EXPECT_FALSE(swe::utf16_is_valid(lone_high));
+    EXPECT_EQ(swe::utf16_to_utf8(lone_high), "a" + replacement + "b");
+    EXPECT_EQ(swe::utf16_to_utf8(lone_low), replacement);
+    EXPECT_EQ(swe::utf16_to_utf8(reversed), replacement + replacement);
+    EXPECT_EQ(swe::utf8_length_from_utf16(reversed), 6u);
+
+    const char32_t out_of_range[] = {0x110000, 0xDFFF, U'z', 0};
+    EXPECT_FALSE(swe::utf32_is_valid(out_of_range));
+    EXPECT_EQ(swe::utf32_to_utf8(out_of_range), replacement + replacement + "z");
+}
+
+TEST(UtfTest, LengthsMatchOutputAndRoundTrip)
+{
+    std::mt19937 rng(8);
+    for (int round = 0; round < 1000; ++round)
+    {
+        const std::u32string code_points = random_code_points(rng, rng() % 120);
+        std::string utf8 = encode(code_points);
+
+        const std::u16string utf16 = swe::utf8_to_utf16(utf8);
+        EXPECT_TRUE(swe::utf16_is_valid(utf16));
+        EXPECT_EQ(swe::utf8_to_utf32(utf8), code_points);
+        EXPECT_EQ(swe::utf16_to_utf8(utf16), utf8);
+        EXPECT_EQ(swe::utf32_to_utf8(code_points), utf8);
+        EXPECT_EQ(swe::wide_to_utf8(swe::utf8_to_wide(utf8)), utf8);
+
+        // Corrupted input: the measured lengths are exactly what the buffer forms write
+        if (!utf8.empty())
+            utf8[rng() % utf8.size()] = static_cast<char>(rng());
+        std::u16string buffer16(swe::utf16_length_from_utf8(utf8), u'\0');
+        EXPECT_EQ(swe::utf8_to_utf16(utf8, &buffer16[0]), buffer16.size());
+        std::u32string buffer32(swe::utf32_length_from_utf8(utf8), U'\0');
+        EXPECT_EQ(swe::utf8_to_utf32(utf8, &buffer32[0]), buffer32.size());
+        std::wstring buffer_wide(swe::wide_length_from_utf8(utf8), L'\0');
+        EXPECT_EQ(swe::utf8_to_wide(utf8, &buffer_wide[0]), buffer_wide.size());
+
+        std::u16string units = utf16;
+        if (!units.empty())
+            units[rng() % units.size()] = static_cast<char16_t>(0xD800 + rng() % 0x800);
+        std::string bytes(swe::utf8_length_from_utf16(units), '\0');
+        EXPECT_EQ(swe::utf16_to_utf8(units, &bytes[0]), bytes.size());
+        EXPECT_TRUE(swe::utf8_is_valid(bytes));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
\ No newline at end of file
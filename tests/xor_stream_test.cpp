@@ -0,0 +1,187 @@
+#include "../include/swe/xor_stream.hpp"
+#include "../include/swe/string.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Kernels the running CPU supports, paired with a name for failure messages
+    std::vector<std::pair<const char*, swe::detail::xor_kernel>> supported_xor_kernels()
+    {
+        std::vector<std::pair<const char*, swe::detail::xor_kernel>> kernels = {{"scalar", &swe::detail::xor_scalar}};
+#if SWE_HAS_X86_SIMD
+        const swe::detail::cpu_features& features = swe::detail::get_cpu_features();
+        if (features.sse2)
+            kernels.emplace_back("sse2", &swe::detail::xor_sse2);
+        if (features.avx2)
+            kernels.emplace_back("avx2", &swe::detail::xor_avx2);
+        if (features.avx512bw)
+            kernels.emplace_back("avx512bw", &swe::detail::xor_avx512bw);
+#endif
+        return kernels;
+    }
+
+    std::string reference_xor(std::string data, const std::string& key)
+    {
+        for (size_t i = 0; i < data.size(); ++i)
+            data[i] = static_cast<char>(data[i] ^ key[i % key.size()]);
+        return data;
+    }
+
+    std::string random_bytes(std::mt19937& rng, size_t length)
+    {
+        std::uniform_int_distribution<int> byte(0, 255);
+        std::string result(length, '\0');
+        for (char& c : result)
+            c = static_cast<char>(byte(rng));
+        return result;
+    }
+
+    std::string read_file(const std::string& path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    void write_file(const std::string& path, const std::string& content)
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+} // namespace
+
+TEST(XorStreamTest, KernelsMatchReferenceAtEveryPhase)
+{
+    std::mt19937 rng(1234);
+    for (const auto& kernel : supported_xor_kernels())
+    {
+        for (size_t key_size : {1u, 3u, 7u, 16u, 63u, 64u, 65u, 200u})
+        {
+            const std::string key = random_bytes(rng, key_size);
+            std::vector<unsigned char> keystream;
+            swe::detail::xor_expand_keystream(reinterpret_cast<const unsigned char*>(key.data()), key.size(), keystream);
+            const size_t cycle = swe::detail::xor_keystream_cycle(key.size());
+            for (size_t length : {0u, 1u, 15u, 64u, 130u, 1000u})
+            {
+                const std::string data = random_bytes(rng, length);
+                for (size_t phase = 0; phase < key.size(); phase += 1 + key.size() / 5)
+                {
+                    const std::string expected = reference_xor(std::string(phase, '\0') + data, key).substr(phase);
+                    std::string actual(length, '\0');
+                    const size_t next = kernel.second(reinterpret_cast<const unsigned char*>(data.data()), reinterpret_cast<unsigned char*>(&actual[0]),
+                                                      length, keystream.data(), cycle, phase);
+                    EXPECT_EQ(actual, expected) << kernel.first << " key " << key_size << " length " << length << " phase " << phase;
+                    EXPECT_EQ(next % key.size(), (phase + length) % key.size()) << kernel.first;
+                    EXPECT_LT(next, cycle) << kernel.first;
+                }
+            }
+        }
+    }
+}
+
+TEST(XorStreamTest, ChunkedCallsMatchSingleCall)
+{
+    std::mt19937 rng(42);
+    const std::string key = "asset-pack-key";
+    const std::string data = random_bytes(rng, 5000);
+    const std::string expected = reference_xor(data, key);
+
+    swe::xor_stream stream(key);
+    std::string chunked = data;
+    std::uniform_int_distribution<size_t> chunk(0, 150);
+    for (size_t pos = 0; pos < chunked.size();)
+    {
+        const size_t count = std::min(chunk(rng), chunked.size() - pos);
+        stream.apply(&chunked[pos], count);
+        pos += count;
+    }
+    EXPECT_EQ(chunked, expected);
+
+    std::string copy(data.size(), '\0');
+    stream.reset();
+    stream.apply(data.data(), &copy[0], data.size());
+    EXPECT_EQ(copy, expected);
+}
+
+TEST(XorStreamTest, SeekResumesMidStream)
+{
+    const std::string key = "0123456789";
+    const std::string data(300, 'x');
+    const std::string expected = reference_xor(data, key);
+
+    swe::xor_stream stream(key);
+    std::string tail = data.substr(123);
+    stream.seek(123);
+    stream.apply(tail);
+    EXPECT_EQ(tail, expected.substr(123));
+}
+
+TEST(XorStreamTest, MatchesStrObfuscateAndRoundTrips)
+{
+    std::mt19937 rng(7);
+    for (size_t key_size : {1u, 5u, 64u, 100u})
+    {
+        const std::string key = random_bytes(rng, key_size);
+        const std::string data = random_bytes(rng, 777);
+        std::string streamed = data;
+        swe::xor_stream(key).apply(streamed);
+        EXPECT_EQ(streamed, swe::str_obfuscate(data, key));
+        EXPECT_EQ(streamed, reference_xor(data, key));
+        swe::xor_stream(key).apply(streamed);
+        EXPECT_EQ(streamed, data);
+    }
+}
+
+TEST(XorStreamTest, EmptyKeyLeavesDataUnchanged)
+{
+    swe::xor_stream stream;
+    EXPECT_TRUE(stream.empty());
+    std::string data = "unchanged";
+    stream.apply(data);
+    EXPECT_EQ(data, "unchanged");
+
+    std::string copy(data.size(), '\0');
+    swe::xor_stream(swe::string_view()).apply(data.data(), &copy[0], data.size());
+    EXPECT_EQ(copy, data);
+    EXPECT_EQ(swe::str_obfuscate(data, ""), data);
+}
+
+TEST(XorStreamTest, XorFileInPlaceAndCopy)
+{
+    const std::string path = "xor_stream_test_source.bin";
+    const std::string copy_path = "xor_stream_test_copy.bin";
+    std::mt19937 rng(99);
+    const std::string data = random_bytes(rng, 3 * 1024 * 1024 + 17);
+    const std::string key = "file-key";
+    write_file(path, data);
+
+    ASSERT_TRUE(swe::xor_file(path, key));
+    EXPECT_EQ(read_file(path), reference_xor(data, key));
+
+    ASSERT_TRUE(swe::xor_file(path, copy_path, key));
+    EXPECT_EQ(read_file(copy_path), data);
+
+    ASSERT_TRUE(swe::xor_file(path, key));
+    EXPECT_EQ(read_file(path), data);
+
+    write_file(path, std::string());
+    EXPECT_TRUE(swe::xor_file(path, key));
+    EXPECT_TRUE(read_file(path).empty());
+
+    std::remove(path.c_str());
+    std::remove(copy_path.c_str());
+    EXPECT_FALSE(swe::xor_file(path, key));
+    EXPECT_FALSE(swe::xor_file(path, copy_path, key));
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
\ No newline at end of file
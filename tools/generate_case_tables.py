@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+"""Generates include/swe/detail/unicode_case_tables.hpp from Python's unicodedata.
+
+The tables hold the Unicode simple (one code point to one code point) case mappings used by the
+UTF-8 aware narrow string functions. Each mapping is stored as runs of code points that share the
+same delta and are evenly spaced (stride 1, or stride 2 for the alternating upper/lower pairs of
+the Latin Extended and Cyrillic blocks), which keeps the tables to a few hundred entries.
+
+Usage: python3 tools/generate_case_tables.py > include/swe/detail/unicode_case_tables.hpp
+"""
+
+import sys
+import unicodedata
+
+MAX_RUN = 0xFFFF
+
+
+def single(mapped, cp):
+    """Returns the mapped code point when the mapping is one-to-one, otherwise None."""
+    return ord(mapped) if len(mapped) == 1 and ord(mapped) != cp else None
+
+
+def mappings():
+    lower, upper, title, fold = {}, {}, {}, {}
+    for cp in range(0x110000):
+        if 0xD800 <= cp <= 0xDFFF:
+            continue
+        c = chr(cp)
+        lo = single(c.lower(), cp)
+        up = single(c.upper(), cp)
+        # Where the full mapping expands, recover the simple one: U+0130 lowers to 'i' plus a combining
+        # dot, and the Greek letters with ypogegrammeni upper-case to their title-case forms
+        if lo is None and len(c.lower()) > 1 and all(unicodedata.category(m) == "Mn" for m in c.lower()[1:]):
+            lo = single(c.lower()[0], cp)
+        if up is None and len(c.upper()) > 1:
+            up = single(c.title(), cp)
+        ti = single(c.title(), cp)
+        # Simple folding: the full folding when it is a single code point, otherwise the simple lower case
+        fo = single(c.casefold(), cp)
+        if fo is None and len(c.casefold()) > 1:
+            fo = single(c.lower(), cp)
+        if lo is not None:
+            lower[cp] = lo
+        if up is not None:
+            upper[cp] = up
+        # Title case is stored only where it differs from upper case
+        if (ti if ti is not None else cp) != (up if up is not None else cp):
+            title[cp] = ti if ti is not None else cp
+        if fo is not None:
+            fold[cp] = fo
+    return lower, upper, title, fold
+
+
+def runs(mapping):
+    result = []
+    for cp in sorted(mapping):
+        delta = mapping[cp] - cp
+        if result:
+            first, count, stride, run_delta = result[-1]
+            last = first + (count - 1) * stride
+            if run_delta == delta and count < MAX_RUN:
+                if count == 1 and cp - last in (1, 2):
+                    result[-1] = [first, 2, cp - last, delta]
+                    continue
+                if cp - last == stride:
+                    result[-1][1] += 1
+                    continue
+        result.append([cp, 1, 1, delta])
+    return result
+
+
+def emit(name, table, description):
+    print("        /**")
+    print("         * @brief %s" % description)
+    print("         */")
+    print("        inline case_table %s() noexcept" % name)
+    print("        {")
+    print("            static const case_run runs[] = {")
+    for first, count, stride, delta in table:
+        print("                {0x%05X, %d, %d, %d}," % (first, count, stride, delta))
+    print("            };")
+    print("            const case_table table = {runs, sizeof(runs) / sizeof(runs[0])};")
+    print("            return table;")
+    print("        }")
+
+
+def main():
+    lower, upper, title, fold = mappings()
+    print("""/**
+ * @file unicode_case_tables.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Generated Unicode %s simple case mapping tables for the SWE library.
+ *
+ * Do not edit: generated by tools/generate_case_tables.py. Each run maps count code points,
+ * starting at first and spaced stride apart, by adding delta. It is an implementation detail and
+ * should not be included directly by user code.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace swe
+{
+    namespace detail
+    {
+        /**
+         * @brief Run of code points sharing one case mapping delta.
+         */
+        struct case_run
+        {
+            std::uint32_t first;  ///< First code point of the run.
+            std::uint16_t count;  ///< Number of code points in the run.
+            std::uint16_t stride; ///< Distance between consecutive code points of the run.
+            std::int32_t delta;   ///< Value added to a code point of the run to map it.
+        };
+
+        /**
+         * @brief Sorted runs of one case mapping.
+         */
+        struct case_table
+        {
+            const case_run* runs;
+            std::size_t size;
+        };
+""" % unicodedata.unidata_version)
+    emit("lower_case_table", runs(lower), "Simple lower-case mapping.")
+    print()
+    emit("upper_case_table", runs(upper), "Simple upper-case mapping.")
+    print()
+    emit("title_case_table", runs(title), "Simple title-case mapping, for the code points whose title case differs from their upper case.")
+    print()
+    emit("fold_case_table", runs(fold), "Simple case folding (CaseFolding.txt statuses C and S).")
+    print("""    } // namespace detail
+} // namespace swe""", end="")
+
+
+if __name__ == "__main__":
+    sys.exit(main())
\ No newline at end of file
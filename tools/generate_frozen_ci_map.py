@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+"""Generates the constant initializer of a swe::frozen_ci_map for C++11 code.
+
+In C++14 and later, swe::make_frozen_ci_map() builds the map at compile time. C++11 cannot run it in a
+constant expression, so this script places the keys with the same perfect hash and prints the tables as
+an aggregate initializer, which the compiler stores as constant data.
+
+The input has one entry per line: a key, then optionally whitespace and a C++ expression for its value.
+Entries without a value get their zero-based line index, which suits an enum of keywords. Empty lines
+and lines starting with '#' are skipped. Keys must be ASCII and distinct ignoring case.
+
+Usage: python3 tools/generate_frozen_ci_map.py --name http_headers [--type int] [--namespace app]
+       [--include swe/frozen_ci_map.hpp] keys.txt > http_headers.hpp
+"""
+
+import argparse
+import sys
+
+MASK64 = (1 << 64) - 1
+SEED = 0x9E3779B97F4A7C15
+MULTIPLIER = 0xBF58476D1CE4E5B9
+STEP = 0x94D049BB133111EB
+MAX_DISPLACEMENT = 1 << 16
+
+
+def finish(h):
+    h ^= h >> 33
+    h = (h * 0xFF51AFD7ED558CCD) & MASK64
+    h ^= h >> 33
+    h = (h * 0xC4CEB9FE1A85EC53) & MASK64
+    h ^= h >> 33
+    return h
+
+
+def mix(h, word):
+    h = ((h ^ word) * MULTIPLIER) & MASK64
+    return h ^ (h >> 31)
+
+
+def word(data):
+    w = 0
+    for i, c in enumerate(data):
+        if 0x41 <= c <= 0x5A:
+            c |= 0x20
+        w |= c << (8 * i)
+    return w
+
+
+def frozen_hash(key):
+    """Mirrors swe::detail::frozen_hash."""
+    h = SEED
+    full = len(key) - len(key) % 8
+    for i in range(0, full, 8):
+        h = mix(h, word(key[i:i + 8]))
+    if full < len(key):
+        h = mix(h, word(key[full:]))
+    return finish((h + len(key)) & MASK64)
+
+
+def frozen_slot(h, displacement, mask):
+    """Mirrors swe::detail::frozen_slot."""
+    if displacement < 0:
+        return -(displacement + 1)
+    return finish((h + displacement * STEP) & MASK64) & mask
+
+
+def table_size(count):
+    size = 1
+    while size < count:
+        size *= 2
+    return size
+
+
+def build(keys):
+    """Mirrors swe::make_frozen_ci_map; returns the key index of every slot and the displacements."""
+    size = table_size(len(keys))
+    mask = size - 1
+    hashes = [frozen_hash(key) for key in keys]
+    if len(set(hashes)) != len(hashes):
+        raise ValueError("duplicate key")
+    buckets = [[] for _ in range(size)]
+    for i, h in enumerate(hashes):
+        buckets[h & mask].append(i)
+
+    slots = [None] * size
+    displacements = [0] * size
+    for bucket_size in range(len(keys), 1, -1):
+        for bucket, members in enumerate(buckets):
+            if len(members) != bucket_size:
+                continue
+            for displacement in range(MAX_DISPLACEMENT):
+                placed = [frozen_slot(hashes[i], displacement, mask) for i in members]
+                if len(set(placed)) == len(placed) and all(slots[p] is None for p in placed):
+                    break
+            else:
+                raise ValueError("no perfect hash found")
+            displacements[bucket] = displacement
+            for i, p in zip(members, placed):
+                slots[p] = i
+
+    next_free = 0
+    for i, h in enumerate(hashes):
+        bucket = h & mask
+        if len(buckets[bucket]) != 1:
+            continue
+        while slots[next_free] is not None:
+            next_free += 1
+        slots[next_free] = i
+        displacements[bucket] = -(next_free + 1)
+    return slots, displacements
+
+
+def literal(key):
+    # Octal escapes are at most three digits long, so a following digit cannot extend them
+    out = []
+    for c in key:
+        if c in (0x22, 0x5C):
+            out.append("\\" + chr(c))
+        elif 0x20 <= c < 0x7F:
+            out.append(chr(c))
+        else:
+            out.append("\\%03o" % c)
+    return '"%s"' % "".join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("input")
+    parser.add_argument("--name", required=True)
+    parser.add_argument("--type", default="int")
+    parser.add_argument("--namespace")
+    parser.add_argument("--include", default="swe/frozen_ci_map.hpp")
+    args = parser.parse_args()
+
+    keys = []
+    values = []
+    with open(args.input, "rb") as f:
+        for line in f.read().splitlines():
+            line = line.strip()
+            if not line or line.startswith(b"#"):
+                continue
+            parts = line.split(None, 1)
+            if any(c >= 0x80 for c in parts[0]):
+                raise ValueError("keys must be ASCII: %r" % parts[0])
+            keys.append(parts[0])
+            values.append(parts[1].decode("ascii") if len(parts) > 1 else str(len(values)))
+    if not keys:
+        raise ValueError("no keys in %s" % args.input)
+
+    slots, displacements = build(keys)
+    indent = "    " if args.namespace else ""
+    out = sys.stdout
+    out.write("""/**
+ * @file %s.hpp
+ * @brief Generated swe::frozen_ci_map with %d keys.
+ *
+ * Do not edit: generated by tools/generate_frozen_ci_map.py from %s.
+ */
+#pragma once
+
+#include "%s"
+
+""" % (args.name, len(keys), args.input.replace("\\", "/").split("/")[-1], args.include))
+    if args.namespace:
+        out.write("namespace %s\n{\n" % args.namespace)
+    out.write("%sconstexpr swe::frozen_ci_map<%s, %d> %s = {\n" % (indent, args.type, len(keys), args.name))
+    out.write("%s    {\n" % indent)
+    for i in slots:
+        if i is None:
+            out.write("%s        {nullptr, swe::detail::frozen_no_key, {}},\n" % indent)
+        else:
+            out.write("%s        {%s, %d, %s},\n" % (indent, literal(keys[i]), len(keys[i]), values[i]))
+    out.write("%s    },\n" % indent)
+    out.write("%s    {%s},\n" % (indent, ", ".join(str(d) for d in displacements)))
+    out.write("%s};\n" % indent)
+    if args.namespace:
+        out.write("} // namespace %s\n" % args.namespace)
+
+
+if __name__ == "__main__":
+    main()
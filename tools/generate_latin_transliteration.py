@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+"""Generates include/swe/detail/latin_transliteration.hpp from Python's unicodedata.
+
+The table spells every code point of the Latin-1 Supplement and Latin Extended-A blocks (U+00C0 to
+U+017F) in lower-case ASCII for the slug utilities. Letters with a canonical decomposition map to
+their base letter; the letters without one (ligatures, stroked letters, thorn, eszett and so on)
+use the conventional spellings listed in SPECIAL.
+
+Usage: python3 tools/generate_latin_transliteration.py > include/swe/detail/latin_transliteration.hpp
+"""
+
+import sys
+import unicodedata
+
+FIRST = 0xC0
+COUNT = 0xC0
+
+SPECIAL = {
+    0x00C6: "ae", 0x00E6: "ae", 0x00D0: "d", 0x00F0: "d", 0x00D8: "o", 0x00F8: "o",
+    0x00DE: "th", 0x00FE: "th", 0x00DF: "ss", 0x0110: "d", 0x0111: "d", 0x0126: "h",
+    0x0127: "h", 0x0131: "i", 0x0132: "ij", 0x0133: "ij", 0x0138: "k", 0x013F: "l",
+    0x0140: "l", 0x0141: "l", 0x0142: "l", 0x0149: "n", 0x014A: "n", 0x014B: "n",
+    0x0152: "oe", 0x0153: "oe", 0x0166: "t", 0x0167: "t", 0x017F: "s",
+    # The multiplication and division signs are not letters and become separators
+    0x00D7: "", 0x00F7: "",
+}
+
+
+def spelling(cp):
+    if cp in SPECIAL:
+        return SPECIAL[cp]
+    base = unicodedata.normalize("NFD", chr(cp))[0]
+    if not (base.isascii() and base.isalpha()):
+        raise ValueError("no transliteration for U+%04X" % cp)
+    return base.lower()
+
+
+def main():
+    spellings = [spelling(cp) for cp in range(FIRST, FIRST + COUNT)]
+    print("""/**
+ * @file latin_transliteration.hpp
+ * @author Stellar Wolf Entertainment (SWE)
+ * @brief Generated ASCII transliteration of accented Latin letters for the SWE slug utilities.
+ *
+ * Do not edit: generated by tools/generate_latin_transliteration.py. The table spells the letters of
+ * the Latin-1 Supplement and Latin Extended-A blocks (U+00C0 to U+017F) in lower-case ASCII, by their
+ * base letter or a conventional spelling such as "ss" for U+00DF and "ae" for U+00E6. It is an
+ * implementation detail and should not be included directly by user code.
+ *
+ * @copyright MIT License
+ * @date created 2025-05-16
+ * @version 1.0
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace swe
+{
+    namespace detail
+    {
+        /**
+         * @brief First code point covered by the transliteration table.
+         */
+        static const std::uint32_t latin_transliteration_first = 0x%X;
+
+        /**
+         * @brief Number of code points covered by the transliteration table.
+         */
+        static const std::uint32_t latin_transliteration_count = 0x%X;
+
+        /**
+         * @brief ASCII spelling of a Latin code point: at most two lower-case letters, empty for the
+         * multiplication and division signs. Returns nullptr for code points outside the table.
+         */
+        inline const char* latin_transliteration(std::uint32_t cp) noexcept
+        {
+            static const char table[latin_transliteration_count][3] = {""" % (FIRST, COUNT))
+    for row in range(0, COUNT, 16):
+        cells = ", ".join('"%s"' % s for s in spellings[row:row + 16])
+        print("                %s, // U+%04X" % (cells, FIRST + row))
+    print("""            };
+            return cp - latin_transliteration_first < latin_transliteration_count ? table[cp - latin_transliteration_first] : nullptr;
+        }
+    } // namespace detail
+} // namespace swe""", end="")
+
+
+if __name__ == "__main__":
+    sys.exit(main())